@@ -0,0 +1,96 @@
+"""
+CPython extension runner for the benchmark suite (benchmarks/suite.zig)
+
+Times CompiledSchema.validate_batch (dicts) and validate_json (raw bytes)
+over the datasets `zig build bench` wrote, and stores results in the
+suite's record format so the next `zig build bench` compares them too:
+
+    zig build bench                       # writes zig-out/bench/data/*.json
+    python benchmarks/bench_python.py     # writes zig-out/bench/python.json
+    zig build bench                       # compares zig, c and python results
+"""
+
+import argparse
+import json
+import os
+import sys
+import time
+
+from dhi import HAS_NATIVE_EXT, compile_schema
+
+DATASETS = ["valid", "invalid_heavy", "long_strings", "nested"]
+WARMUP_BATCHES = 3
+
+# Same fields and bounds as field_specs in benchmarks/suite.zig
+FIELD_SPECS = {
+    "id": ("int_non_negative",),
+    "name": ("string", 1, 64),
+    "email": ("email",),
+    "age": ("int", 18, 120),
+}
+
+
+def percentile(sorted_samples, p):
+    """Nearest-rank percentile, as in suite.zig"""
+    rank = (len(sorted_samples) * p + 99) // 100
+    return float(sorted_samples[max(rank, 1) - 1])
+
+
+def measure(bench, dataset, run, items, size, batches):
+    for _ in range(WARMUP_BATCHES):
+        run()
+    samples = []
+    for _ in range(batches):
+        start = time.perf_counter_ns()
+        run()
+        samples.append(time.perf_counter_ns() - start)
+    samples.sort()
+
+    p50 = percentile(samples, 50)
+    return {
+        "lang": "python",
+        "bench": bench,
+        "dataset": dataset,
+        "items": items,
+        "bytes": size,
+        "batches": batches,
+        "ns_per_item": p50 / items,
+        "items_per_sec": items * 1e9 / p50,
+        "bytes_per_sec": size * 1e9 / p50,
+        # CPython exposes no per-call allocation counter
+        "allocs_per_batch": None,
+        "p50_ns": p50,
+        "p99_ns": percentile(samples, 99),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--out", default=os.path.join("zig-out", "bench"), help="suite output directory")
+    parser.add_argument("--batches", type=int, default=50)
+    args = parser.parse_args()
+
+    if not HAS_NATIVE_EXT:
+        sys.exit("dhi native extension not built")
+    schema = compile_schema(FIELD_SPECS)
+
+    records = []
+    for dataset in DATASETS:
+        path = os.path.join(args.out, "data", f"{dataset}.json")
+        with open(path, "rb") as f:
+            raw = f.read()
+        items = json.loads(raw)
+
+        records.append(measure("validate_batch", dataset, lambda: schema.validate_batch(items),
+                               len(items), len(raw), args.batches))
+        records.append(measure("validate_json", dataset, lambda: schema.validate_json(raw),
+                               len(items), len(raw), args.batches))
+        for record in records[-2:]:
+            print(f"python/{record['bench']}/{dataset}: {record['ns_per_item']:.2f} ns/item")
+
+    with open(os.path.join(args.out, "python.json"), "w") as f:
+        json.dump(records, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,419 @@
+/// Cross-language benchmark suite (`zig build bench`)
+/// Generates the seeded datasets every runner shares, times the Zig core and
+/// the C API over them, and compares all results against a stored baseline:
+///
+///   zig build bench                              run, compare, exit 1 on regression
+///   zig build bench -- --update-baseline         store current results as the baseline
+///   zig build bench -- --items 50000 --threshold 5
+///
+/// Datasets go to <out>/data/<name>.json (JSON arrays of user records) and
+/// results to <out>/zig.json. The Python and WASM runners
+/// (benchmarks/bench_python.py, js-bindings/benchmark-suite.ts) read those
+/// datasets and write <out>/python.json and <out>/wasm.json in the same
+/// record format; every <out>/*.json is part of the comparison.
+const std = @import("std");
+const json_validator = @import("json_batch_validator");
+
+/// One benchmark over one dataset; the format shared by every runner
+pub const Record = struct {
+    lang: []const u8,
+    bench: []const u8,
+    dataset: []const u8,
+    items: u64,
+    bytes: u64,
+    batches: u64,
+    ns_per_item: f64,
+    items_per_sec: f64,
+    bytes_per_sec: f64,
+    /// Allocator calls per batch where the runner can count them
+    allocs_per_batch: ?f64 = null,
+    p50_ns: f64,
+    p99_ns: f64,
+};
+
+const Options = struct {
+    items: usize = 10_000,
+    batches: usize = 50,
+    out_dir: []const u8 = "zig-out/bench",
+    baseline: []const u8 = "benchmarks/baseline.json",
+    update_baseline: bool = false,
+    /// Slowdown in percent of ns_per_item that counts as a regression
+    threshold: f64 = 10.0,
+};
+
+const warmup_batches = 3;
+const seed: u64 = 0x5eed_da7a;
+
+pub const DatasetKind = enum {
+    /// Every record valid
+    valid,
+    /// About half the records fail, on a different field each time
+    invalid_heavy,
+    /// 48-64 byte names, 100-160 byte emails and a 1-2 KB unvalidated bio
+    long_strings,
+    /// Valid records behind unvalidated nested objects and lists to skip
+    nested,
+};
+
+/// Schema of every dataset; same fields and bounds in every runner
+const field_specs = [_]json_validator.FieldSpec{
+    .{ .name = "id", .validator_type = .IntNonNegative },
+    .{ .name = "name", .validator_type = .String, .param1 = 1, .param2 = 64 },
+    .{ .name = "email", .validator_type = .Email },
+    .{ .name = "age", .validator_type = .Int, .param1 = 18, .param2 = 120 },
+};
+
+/// JSON array of `items` records for `kind`; identical for a given seed
+pub fn generate(allocator: std.mem.Allocator, kind: DatasetKind, items: usize) ![]u8 {
+    var prng = std.Random.DefaultPrng.init(seed +% @intFromEnum(kind));
+    const rand = prng.random();
+
+    var out: std.ArrayList(u8) = .empty;
+    errdefer out.deinit(allocator);
+    try out.append(allocator, '[');
+    for (0..items) |i| {
+        if (i > 0) try out.appendSlice(allocator, ",\n");
+        try out.append(allocator, '{');
+        if (kind == .nested) {
+            try out.print(allocator, "\"address\": {{\"street\": \"{d} Main St\", \"city\": \"City{d}\", " ++
+                "\"geo\": {{\"lat\": {d}.5, \"lng\": -{d}.25}}}}, \"tags\": [\"t{d}\", \"t{d}\", {{\"k\": [1, 2, 3]}}], ", .{
+                rand.uintLessThan(u32, 10_000), i % 97, rand.uintLessThan(u8, 90), rand.uintLessThan(u8, 180), i % 7, i % 11,
+            });
+        }
+        // Faults: 0 empty name, 1 bad email, 2 age too low, 3 age missing
+        const fault: ?u2 = if (kind == .invalid_heavy and rand.boolean()) rand.int(u2) else null;
+
+        try out.print(allocator, "\"id\": {d}, \"name\": \"", .{i});
+        if (!hasFault(fault, 0)) {
+            const len = if (kind == .long_strings) rand.intRangeAtMost(usize, 48, 64) else rand.intRangeAtMost(usize, 3, 16);
+            try appendLetters(allocator, &out, rand, len);
+        }
+        try out.appendSlice(allocator, "\", \"email\": \"");
+        if (kind == .long_strings) {
+            try appendLetters(allocator, &out, rand, rand.intRangeAtMost(usize, 88, 148));
+            try out.appendSlice(allocator, "@example.com");
+        } else if (hasFault(fault, 1)) {
+            try out.print(allocator, "user{d}.example.com", .{i});
+        } else {
+            try out.print(allocator, "user{d}@example.com", .{i});
+        }
+        try out.append(allocator, '"');
+        if (hasFault(fault, 2)) {
+            try out.print(allocator, ", \"age\": {d}", .{rand.uintLessThan(u8, 18)});
+        } else if (!hasFault(fault, 3)) {
+            try out.print(allocator, ", \"age\": {d}", .{rand.intRangeAtMost(u8, 18, 120)});
+        }
+        if (kind == .long_strings) {
+            try out.appendSlice(allocator, ", \"bio\": \"");
+            try appendLetters(allocator, &out, rand, rand.intRangeAtMost(usize, 1024, 2048));
+            try out.append(allocator, '"');
+        }
+        try out.append(allocator, '}');
+    }
+    try out.appendSlice(allocator, "]\n");
+    return out.toOwnedSlice(allocator);
+}
+
+fn hasFault(fault: ?u2, which: u2) bool {
+    return if (fault) |f| f == which else false;
+}
+
+fn appendLetters(allocator: std.mem.Allocator, out: *std.ArrayList(u8), rand: std.Random, len: usize) !void {
+    for (0..len) |_| try out.append(allocator, 'a' + rand.uintLessThan(u8, 26));
+}
+
+/// Counts allocator calls of the code under test (alloc and remap)
+const CountingAllocator = struct {
+    child: std.mem.Allocator,
+    count: usize = 0,
+
+    fn allocator(self: *CountingAllocator) std.mem.Allocator {
+        return .{ .ptr = self, .vtable = &.{ .alloc = alloc, .resize = resize, .remap = remap, .free = free } };
+    }
+
+    fn alloc(ctx: *anyopaque, len: usize, alignment: std.mem.Alignment, ret_addr: usize) ?[*]u8 {
+        const self: *CountingAllocator = @ptrCast(@alignCast(ctx));
+        self.count += 1;
+        return self.child.rawAlloc(len, alignment, ret_addr);
+    }
+
+    fn resize(ctx: *anyopaque, memory: []u8, alignment: std.mem.Alignment, new_len: usize, ret_addr: usize) bool {
+        const self: *CountingAllocator = @ptrCast(@alignCast(ctx));
+        return self.child.rawResize(memory, alignment, new_len, ret_addr);
+    }
+
+    fn remap(ctx: *anyopaque, memory: []u8, alignment: std.mem.Alignment, new_len: usize, ret_addr: usize) ?[*]u8 {
+        const self: *CountingAllocator = @ptrCast(@alignCast(ctx));
+        self.count += 1;
+        return self.child.rawRemap(memory, alignment, new_len, ret_addr);
+    }
+
+    fn free(ctx: *anyopaque, memory: []u8, alignment: std.mem.Alignment, ret_addr: usize) void {
+        const self: *CountingAllocator = @ptrCast(@alignCast(ctx));
+        self.child.rawFree(memory, alignment, ret_addr);
+    }
+};
+
+/// Zig core: json_batch_validator straight over the bytes
+const ZigRunner = struct {
+    json: []const u8,
+    results: []u8,
+    counter: CountingAllocator,
+
+    fn run(self: *ZigRunner) !usize {
+        const Sink = struct {
+            results: []u8,
+
+            pub fn put(sink: *@This(), index: usize, result: json_validator.ValidationResult) !void {
+                sink.results[index] = @intFromBool(result.is_valid);
+            }
+        };
+        var sink: Sink = .{ .results = self.results };
+        return json_validator.validateJsonArrayStream(self.json, &field_specs, self.counter.allocator(), &sink);
+    }
+};
+
+/// Mirrors JsonFieldSpec in src/c_api.zig (kind uses column_validator.Kind)
+const CFieldSpec = extern struct {
+    name: [*]const u8,
+    name_len: usize,
+    kind: u8,
+    param1: i64,
+    param2: i64,
+    pattern: ?*const anyopaque = null,
+};
+
+extern fn satya_validate_json_array(
+    json: [*]const u8,
+    json_len: usize,
+    specs: [*]const CFieldSpec,
+    num_specs: usize,
+    results: [*]u8,
+    max_results: usize,
+) isize;
+
+/// C API: satya_validate_json_array from libsatya_static, as bindings call it
+const CRunner = struct {
+    json: []const u8,
+    results: []u8,
+
+    const specs = [_]CFieldSpec{
+        .{ .name = "id", .name_len = 2, .kind = 6, .param1 = 0, .param2 = 0 }, // IntNonNegative
+        .{ .name = "name", .name_len = 4, .kind = 8, .param1 = 1, .param2 = 64 }, // String
+        .{ .name = "email", .name_len = 5, .kind = 9, .param1 = 0, .param2 = 0 }, // Email
+        .{ .name = "age", .name_len = 3, .kind = 0, .param1 = 18, .param2 = 120 }, // Int
+    };
+
+    fn run(self: *CRunner) !usize {
+        const count = satya_validate_json_array(self.json.ptr, self.json.len, &specs, specs.len, self.results.ptr, self.results.len);
+        if (count < 0) return error.ValidationFailed;
+        return @intCast(count);
+    }
+};
+
+/// Nearest-rank percentile of sorted samples
+fn percentile(sorted: []const u64, p: usize) f64 {
+    const rank = (sorted.len * p + 99) / 100;
+    return @floatFromInt(sorted[@max(rank, 1) - 1]);
+}
+
+/// Time `opts.batches` runs of `runner` over `json` (after a short warm-up)
+fn measure(
+    allocator: std.mem.Allocator,
+    opts: Options,
+    lang: []const u8,
+    bench: []const u8,
+    kind: DatasetKind,
+    json: []const u8,
+    runner: anytype,
+    counter: ?*const CountingAllocator,
+) !Record {
+    const samples = try allocator.alloc(u64, opts.batches);
+    defer allocator.free(samples);
+
+    for (0..warmup_batches) |_| {
+        if (try runner.run() != opts.items) return error.UnexpectedItemCount;
+    }
+    const allocs_before = if (counter) |c| c.count else 0;
+    for (samples) |*sample| {
+        var timer = try std.time.Timer.start();
+        _ = try runner.run();
+        sample.* = timer.read();
+    }
+    std.mem.sort(u64, samples, {}, std.sort.asc(u64));
+
+    const p50 = percentile(samples, 50);
+    const items: f64 = @floatFromInt(opts.items);
+    const batches: f64 = @floatFromInt(opts.batches);
+    return .{
+        .lang = lang,
+        .bench = bench,
+        .dataset = @tagName(kind),
+        .items = opts.items,
+        .bytes = json.len,
+        .batches = opts.batches,
+        .ns_per_item = p50 / items,
+        .items_per_sec = items * 1e9 / p50,
+        .bytes_per_sec = @as(f64, @floatFromInt(json.len)) * 1e9 / p50,
+        .allocs_per_batch = if (counter) |c| @as(f64, @floatFromInt(c.count - allocs_before)) / batches else null,
+        .p50_ns = p50,
+        .p99_ns = percentile(samples, 99),
+    };
+}
+
+fn parseArgs(args: []const []const u8) !Options {
+    var opts: Options = .{};
+    var i: usize = 1;
+    while (i < args.len) : (i += 1) {
+        const arg = args[i];
+        if (std.mem.eql(u8, arg, "--update-baseline")) {
+            opts.update_baseline = true;
+            continue;
+        }
+        if (i + 1 == args.len) return error.MissingArgumentValue;
+        const value = args[i + 1];
+        i += 1;
+        if (std.mem.eql(u8, arg, "--items")) {
+            opts.items = try std.fmt.parseInt(usize, value, 10);
+        } else if (std.mem.eql(u8, arg, "--batches")) {
+            opts.batches = @max(1, try std.fmt.parseInt(usize, value, 10));
+        } else if (std.mem.eql(u8, arg, "--out")) {
+            opts.out_dir = value;
+        } else if (std.mem.eql(u8, arg, "--baseline")) {
+            opts.baseline = value;
+        } else if (std.mem.eql(u8, arg, "--threshold")) {
+            opts.threshold = try std.fmt.parseFloat(f64, value);
+        } else {
+            std.debug.print("unknown option '{s}'\n", .{arg});
+            return error.UnknownOption;
+        }
+    }
+    return opts;
+}
+
+fn writeRecords(allocator: std.mem.Allocator, dir: std.fs.Dir, path: []const u8, records: []const Record) !void {
+    const text = try std.json.Stringify.valueAlloc(allocator, records, .{ .whitespace = .indent_2 });
+    defer allocator.free(text);
+    try dir.writeFile(.{ .sub_path = path, .data = text });
+}
+
+/// Records of every *.json in `dir` (zig.json plus whatever the other runners wrote)
+fn loadResults(allocator: std.mem.Allocator, dir: std.fs.Dir, list: *std.ArrayList(Record)) !void {
+    var it = dir.iterate();
+    while (try it.next()) |entry| {
+        if (entry.kind != .file or !std.mem.endsWith(u8, entry.name, ".json")) continue;
+        const text = try dir.readFileAlloc(allocator, entry.name, 64 << 20);
+        const parsed = std.json.parseFromSliceLeaky([]Record, allocator, text, .{ .ignore_unknown_fields = true }) catch |err| {
+            std.debug.print("skipping {s}: {s}\n", .{ entry.name, @errorName(err) });
+            continue;
+        };
+        try list.appendSlice(allocator, parsed);
+    }
+}
+
+fn sameKey(a: Record, b: Record) bool {
+    return std.mem.eql(u8, a.lang, b.lang) and std.mem.eql(u8, a.bench, b.bench) and std.mem.eql(u8, a.dataset, b.dataset);
+}
+
+/// Print every result next to its baseline; returns the number of regressions
+fn compare(current: []const Record, baseline: []const Record, threshold: f64) usize {
+    var regressions: usize = 0;
+    for (current) |record| {
+        std.debug.print("{s}/{s}/{s}: {d:.2} ns/item, p99 {d:.0} us/batch", .{
+            record.lang, record.bench, record.dataset, record.ns_per_item, record.p99_ns / 1000,
+        });
+        const base = for (baseline) |b| {
+            if (sameKey(record, b)) break b;
+        } else {
+            std.debug.print(" (new)\n", .{});
+            continue;
+        };
+        const delta = (record.ns_per_item / base.ns_per_item - 1) * 100;
+        const sign: []const u8 = if (delta >= 0) "+" else "";
+        std.debug.print(" vs {d:.2} ({s}{d:.1}%)", .{ base.ns_per_item, sign, delta });
+        if (delta > threshold) {
+            regressions += 1;
+            std.debug.print("  REGRESSION\n", .{});
+        } else {
+            std.debug.print("\n", .{});
+        }
+    }
+    return regressions;
+}
+
+pub fn main() !void {
+    var arena_state = std.heap.ArenaAllocator.init(std.heap.smp_allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    const opts = try parseArgs(try std.process.argsAlloc(arena));
+    const cwd = std.fs.cwd();
+    try cwd.makePath(opts.out_dir);
+    var out_dir = try cwd.openDir(opts.out_dir, .{ .iterate = true });
+    defer out_dir.close();
+    try out_dir.makePath("data");
+
+    var records: std.ArrayList(Record) = .empty;
+    const results = try arena.alloc(u8, opts.items);
+
+    for (std.enums.values(DatasetKind)) |kind| {
+        const json = try generate(arena, kind, opts.items);
+        const data_path = try std.fmt.allocPrint(arena, "data/{s}.json", .{@tagName(kind)});
+        try out_dir.writeFile(.{ .sub_path = data_path, .data = json });
+
+        var zig_runner: ZigRunner = .{ .json = json, .results = results, .counter = .{ .child = std.heap.smp_allocator } };
+        try records.append(arena, try measure(arena, opts, "zig", "json_array", kind, json, &zig_runner, &zig_runner.counter));
+        var c_runner: CRunner = .{ .json = json, .results = results };
+        try records.append(arena, try measure(arena, opts, "c", "satya_validate_json_array", kind, json, &c_runner, null));
+    }
+    try writeRecords(arena, out_dir, "zig.json", records.items);
+
+    var current: std.ArrayList(Record) = .empty;
+    try loadResults(arena, out_dir, &current);
+
+    if (opts.update_baseline) {
+        try writeRecords(arena, cwd, opts.baseline, current.items);
+        std.debug.print("baseline {s} updated ({d} results)\n", .{ opts.baseline, current.items.len });
+        return;
+    }
+
+    const baseline_text = cwd.readFileAlloc(arena, opts.baseline, 64 << 20) catch |err| switch (err) {
+        error.FileNotFound => {
+            _ = compare(current.items, &.{}, opts.threshold);
+            std.debug.print("no baseline at {s}; store one with --update-baseline\n", .{opts.baseline});
+            return;
+        },
+        else => return err,
+    };
+    const baseline = try std.json.parseFromSliceLeaky([]Record, arena, baseline_text, .{ .ignore_unknown_fields = true });
+
+    const regressions = compare(current.items, baseline, opts.threshold);
+    if (regressions > 0) {
+        std.debug.print("{d} regression(s) over {d:.0}%\n", .{ regressions, opts.threshold });
+        std.process.exit(1);
+    }
+}
+
+test "generate - seeded datasets are reproducible and match their intent" {
+    const allocator = std.testing.allocator;
+    const a = try generate(allocator, .invalid_heavy, 200);
+    defer allocator.free(a);
+    const b = try generate(allocator, .invalid_heavy, 200);
+    defer allocator.free(b);
+    try std.testing.expectEqualStrings(a, b);
+
+    const valid = try json_validator.validateJsonArray(a, &field_specs, allocator);
+    defer allocator.free(valid);
+    var invalid: usize = 0;
+    for (valid) |r| invalid += @intFromBool(!r.is_valid);
+    try std.testing.expect(invalid > 60 and invalid < 140);
+
+    inline for (.{ DatasetKind.valid, DatasetKind.long_strings, DatasetKind.nested }) |kind| {
+        const json = try generate(allocator, kind, 50);
+        defer allocator.free(json);
+        const all = try json_validator.validateJsonArray(json, &field_specs, allocator);
+        defer allocator.free(all);
+        try std.testing.expectEqual(@as(usize, 50), all.len);
+        for (all) |r| try std.testing.expect(r.is_valid);
+    }
+}
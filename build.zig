@@ -3,6 +3,11 @@ const std = @import("std");
 pub fn build(b: *std.Build) void {
     const target = b.standardTargetOptions(.{});
     const optimize = b.standardOptimizeOption(.{});
+    const schema_path = b.option([]const u8, "schema", "JSON schema description to compile specialized validators for (see src/schema_codegen.zig)");
+    const generated_schemas_mod = generatedSchemasModule(b, schema_path);
+    const stats = b.option(bool, "stats", "Per-validator counters in the C library (see src/stats.zig)") orelse false;
+    const build_options = b.addOptions();
+    build_options.addOption(bool, "stats", stats);
 
     // Create validator module
     const validator_mod = b.addModule("validator", .{
@@ -45,8 +50,28 @@ pub fn build(b: *std.Build) void {
         .linkage = .dynamic,
     });
     c_lib.root_module.addImport("validator", validator_mod);
+    c_lib.root_module.addImport("generated_schemas", generated_schemas_mod);
+    c_lib.root_module.addOptions("build_options", build_options);
     b.installArtifact(c_lib);
 
+    // Static variant for linking straight into the CPython extension (setup.py
+    // prefers it); no libsatya to load and no PLT hop per call
+    const c_static_lib = b.addLibrary(.{
+        .name = "satya_static",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/c_api.zig"),
+            .target = target,
+            .optimize = optimize,
+            .pic = true,
+        }),
+        .linkage = .static,
+    });
+    c_static_lib.root_module.addImport("validator", validator_mod);
+    c_static_lib.root_module.addImport("generated_schemas", generated_schemas_mod);
+    c_static_lib.root_module.addOptions("build_options", build_options);
+    c_static_lib.bundle_compiler_rt = true;
+    b.installArtifact(c_static_lib);
+
     // Build WASM library for JavaScript bindings
     const wasm_lib = b.addExecutable(.{
         .name = "dhi",
@@ -59,10 +84,56 @@ pub fn build(b: *std.Build) void {
             .optimize = optimize,
         }),
     });
+    wasm_lib.root_module.addImport("generated_schemas", generated_schemas_mod);
     wasm_lib.entry = .disabled;
     wasm_lib.rdynamic = true;
     b.installArtifact(wasm_lib);
 
+    // SIMD128 variant of the WASM library (@Vector kernels lower to v128 ops)
+    const wasm_simd_lib = b.addExecutable(.{
+        .name = "dhi-simd",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/wasm_api.zig"),
+            .target = b.resolveTargetQuery(.{
+                .cpu_arch = .wasm32,
+                .os_tag = .freestanding,
+                .cpu_features_add = std.Target.wasm.featureSet(&.{.simd128}),
+            }),
+            .optimize = optimize,
+        }),
+    });
+    wasm_simd_lib.root_module.addImport("generated_schemas", generated_schemas_mod);
+    wasm_simd_lib.entry = .disabled;
+    wasm_simd_lib.rdynamic = true;
+    b.installArtifact(wasm_simd_lib);
+
+    // Worker-pool variant (js-bindings/threads.ts): SIMD128 plus atomics over
+    // an imported shared memory that the main JS thread reads and writes.
+    // Every worker instantiates it over its own memory, so each instance stays
+    // single-threaded (wasm_allocator requires that) with a private stack.
+    const wasm_threads_lib = b.addExecutable(.{
+        .name = "dhi-threads",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/wasm_api.zig"),
+            .target = b.resolveTargetQuery(.{
+                .cpu_arch = .wasm32,
+                .os_tag = .freestanding,
+                .cpu_features_add = std.Target.wasm.featureSet(&.{ .simd128, .atomics, .bulk_memory }),
+            }),
+            .optimize = optimize,
+            .single_threaded = true,
+        }),
+    });
+    wasm_threads_lib.root_module.addImport("generated_schemas", generated_schemas_mod);
+    wasm_threads_lib.entry = .disabled;
+    wasm_threads_lib.rdynamic = true;
+    wasm_threads_lib.import_memory = true;
+    wasm_threads_lib.shared_memory = true;
+    // Keep in sync with the WebAssembly.Memory limits in js-bindings/threads.ts
+    wasm_threads_lib.initial_memory = 256 * 65536;
+    wasm_threads_lib.max_memory = 16384 * 65536;
+    b.installArtifact(wasm_threads_lib);
+
     // Export module for use as a dependency
     const satya_module = b.addModule("satya", .{
         .root_source_file = b.path("src/root.zig"),
@@ -163,11 +234,172 @@ pub fn build(b: *std.Build) void {
 
     const run_json_validator_tests = b.addRunArtifact(json_validator_tests);
 
+    // Tests for batch_validator module
+    const batch_validator_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/batch_validator.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_batch_validator_tests = b.addRunArtifact(batch_validator_tests);
+
+    // Tests for column_validator module
+    const column_validator_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/column_validator.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_column_validator_tests = b.addRunArtifact(column_validator_tests);
+
+    // Tests for bitmap module
+    const bitmap_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/bitmap.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_bitmap_tests = b.addRunArtifact(bitmap_tests);
+
+    // Tests for json_batch_validator module
+    const json_batch_validator_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/json_batch_validator.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_json_batch_validator_tests = b.addRunArtifact(json_batch_validator_tests);
+
+    // Tests for stats module
+    const stats_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/stats.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_stats_tests = b.addRunArtifact(stats_tests);
+
+    // Tests for the benchmark suite's dataset generator
+    const json_batch_validator_mod = b.createModule(.{
+        .root_source_file = b.path("src/json_batch_validator.zig"),
+    });
+    const bench_suite_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("benchmarks/suite.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+    bench_suite_tests.root_module.addImport("json_batch_validator", json_batch_validator_mod);
+
+    const run_bench_suite_tests = b.addRunArtifact(bench_suite_tests);
+
+    // Tests for json_structural module
+    const json_structural_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/json_structural.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_json_structural_tests = b.addRunArtifact(json_structural_tests);
+
+    // Tests for file_validator module
+    const file_validator_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/file_validator.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_file_validator_tests = b.addRunArtifact(file_validator_tests);
+
+    // Tests for simd_validators module
+    const simd_validators_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/simd_validators.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_simd_validators_tests = b.addRunArtifact(simd_validators_tests);
+
+    // Tests for regex module
+    const regex_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/regex.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_regex_tests = b.addRunArtifact(regex_tests);
+
+    // Tests for error_report module
+    const error_report_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/error_report.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_error_report_tests = b.addRunArtifact(error_report_tests);
+
+    // Tests for schema_codegen module
+    const schema_codegen_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/schema_codegen.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+
+    const run_schema_codegen_tests = b.addRunArtifact(schema_codegen_tests);
+
+    // Tests for the WASM exports (run natively with the testing allocator)
+    const wasm_api_tests = b.addTest(.{
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/wasm_api.zig"),
+            .target = target,
+            .optimize = optimize,
+        }),
+    });
+    wasm_api_tests.root_module.addImport("generated_schemas", generated_schemas_mod);
+
+    const run_wasm_api_tests = b.addRunArtifact(wasm_api_tests);
+
     // Test step runs all tests
     const test_step = b.step("test", "Run unit tests");
     test_step.dependOn(&run_validator_tests.step);
     test_step.dependOn(&run_combinators_tests.step);
     test_step.dependOn(&run_json_validator_tests.step);
+    test_step.dependOn(&run_batch_validator_tests.step);
+    test_step.dependOn(&run_column_validator_tests.step);
+    test_step.dependOn(&run_bitmap_tests.step);
+    test_step.dependOn(&run_json_batch_validator_tests.step);
+    test_step.dependOn(&run_json_structural_tests.step);
+    test_step.dependOn(&run_file_validator_tests.step);
+    test_step.dependOn(&run_schema_codegen_tests.step);
+    test_step.dependOn(&run_simd_validators_tests.step);
+    test_step.dependOn(&run_regex_tests.step);
+    test_step.dependOn(&run_error_report_tests.step);
+    test_step.dependOn(&run_stats_tests.step);
+    test_step.dependOn(&run_bench_suite_tests.step);
+    test_step.dependOn(&run_wasm_api_tests.step);
 
     // Benchmark executable
     const benchmark = b.addExecutable(.{
@@ -183,6 +415,124 @@ pub fn build(b: *std.Build) void {
     benchmark.root_module.addImport("json_validator", json_validator_mod);
 
     const run_benchmark = b.addRunArtifact(benchmark);
-    const bench_step = b.step("bench", "Run performance benchmarks");
-    bench_step.dependOn(&run_benchmark.step);
+    const bench_micro_step = b.step("bench-micro", "Run the single-validator micro benchmarks");
+    bench_micro_step.dependOn(&run_benchmark.step);
+
+    // Cross-language suite (benchmarks/suite.zig): seeded datasets shared
+    // with the Python and WASM runners, JSON results, baseline comparison.
+    // The C API is timed through its own ReleaseFast libsatya_static.
+    const bench_c_lib = b.addLibrary(.{
+        .name = "satya_bench",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/c_api.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+        }),
+        .linkage = .static,
+    });
+    bench_c_lib.root_module.addImport("validator", validator_mod);
+    bench_c_lib.root_module.addImport("generated_schemas", generated_schemas_mod);
+    bench_c_lib.root_module.addOptions("build_options", build_options);
+
+    const bench_suite = b.addExecutable(.{
+        .name = "bench-suite",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("benchmarks/suite.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+        }),
+    });
+    bench_suite.root_module.addImport("json_batch_validator", json_batch_validator_mod);
+    bench_suite.root_module.linkLibrary(bench_c_lib);
+
+    const run_bench_suite = b.addRunArtifact(bench_suite);
+    run_bench_suite.addArgs(&.{
+        "--out",
+        b.getInstallPath(.prefix, "bench"),
+        "--baseline",
+        b.pathFromRoot("benchmarks/baseline.json"),
+    });
+    if (b.args) |args| run_bench_suite.addArgs(args);
+    const bench_step = b.step("bench", "Run the benchmark suite and compare with benchmarks/baseline.json");
+    bench_step.dependOn(&run_bench_suite.step);
+}
+
+/// Module `generated_schemas` for src/schema_codegen.zig
+/// Without -Dschema the list is empty, so no kernels are exported.
+fn generatedSchemasModule(b: *std.Build, schema_path: ?[]const u8) *std.Build.Module {
+    var src: std.ArrayList(u8) = .empty;
+    src.appendSlice(b.allocator,
+        \\// Generated by build.zig from -Dschema; do not edit
+        \\pub const Field = struct { name: [:0]const u8, kind: []const u8, param1: i64 = 0, param2: i64 = 0 };
+        \\pub const Schema = struct { name: [:0]const u8, fields: []const Field };
+        \\pub const schemas = [_]Schema{
+        \\
+    ) catch @panic("OOM");
+
+    if (schema_path) |path| {
+        const text = b.build_root.handle.readFileAlloc(b.allocator, path, 16 << 20) catch |err|
+            std.debug.panic("cannot read schema file '{s}': {s}", .{ path, @errorName(err) });
+        const parsed = std.json.parseFromSlice(std.json.Value, b.allocator, text, .{}) catch |err|
+            std.debug.panic("schema file '{s}' is not valid JSON: {s}", .{ path, @errorName(err) });
+
+        const list: []const std.json.Value = switch (parsed.value) {
+            .array => |array| array.items,
+            .object => (&parsed.value)[0..1],
+            else => std.debug.panic("schema file '{s}': expected an object or an array of objects", .{path}),
+        };
+        for (list) |schema| appendSchema(b, &src, schema);
+    }
+
+    src.appendSlice(b.allocator, "};\n") catch @panic("OOM");
+    const files = b.addWriteFiles();
+    return b.createModule(.{ .root_source_file = files.add("generated_schemas.zig", src.items) });
+}
+
+fn appendSchema(b: *std.Build, src: *std.ArrayList(u8), schema: std.json.Value) void {
+    const name = if (schema == .object) schema.object.get("name") else null;
+    const fields = if (schema == .object) schema.object.get("fields") else null;
+    if (name == null or name.? != .string or fields == null or fields.? != .object)
+        @panic("schema: every entry needs a string \"name\" and a \"fields\" object");
+    // The name becomes part of exported C symbols
+    for (name.?.string, 0..) |c, i| {
+        if (!(std.ascii.isAlphabetic(c) or c == '_' or (i > 0 and std.ascii.isDigit(c))))
+            std.debug.panic("schema name '{s}' is not a valid C identifier", .{name.?.string});
+    }
+
+    src.print(b.allocator, "    .{{ .name = \"{s}\", .fields = &.{{\n", .{name.?.string}) catch @panic("OOM");
+    var it = fields.?.object.iterator();
+    while (it.next()) |entry| {
+        // "field": "kind" or "field": ["kind", param1, param2]
+        const spec = entry.value_ptr.*;
+        const parts: []const std.json.Value = switch (spec) {
+            .string => (&spec)[0..1],
+            .array => |array| array.items,
+            else => &.{},
+        };
+        if (parts.len == 0 or parts.len > 3 or parts[0] != .string)
+            std.debug.panic("schema field '{s}': expected \"kind\" or [\"kind\", param1, param2]", .{entry.key_ptr.*});
+        var params = [2]i64{ 0, 0 };
+        for (parts[1..], 0..) |param, i| {
+            if (param != .integer) std.debug.panic("schema field '{s}': parameters must be integers", .{entry.key_ptr.*});
+            params[i] = param.integer;
+        }
+
+        src.appendSlice(b.allocator, "        .{ .name = \"") catch @panic("OOM");
+        appendEscaped(b, src, entry.key_ptr.*);
+        src.appendSlice(b.allocator, "\", .kind = \"") catch @panic("OOM");
+        appendEscaped(b, src, parts[0].string);
+        src.print(b.allocator, "\", .param1 = {d}, .param2 = {d} }},\n", .{ params[0], params[1] }) catch @panic("OOM");
+    }
+    src.appendSlice(b.allocator, "    } },\n") catch @panic("OOM");
+}
+
+/// Zig string literal body for arbitrary bytes
+fn appendEscaped(b: *std.Build, src: *std.ArrayList(u8), bytes: []const u8) void {
+    for (bytes) |c| {
+        if (c == '"' or c == '\\' or c < 0x20 or c >= 0x7f) {
+            src.print(b.allocator, "\\x{x:0>2}", .{c}) catch @panic("OOM");
+        } else {
+            src.append(b.allocator, c) catch @panic("OOM");
+        }
+    }
 }
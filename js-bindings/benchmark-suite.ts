@@ -0,0 +1,76 @@
+/**
+ * WASM runner for the benchmark suite (benchmarks/suite.zig)
+ *
+ * Times validateBatch and validateBatchBitmap over the datasets
+ * `zig build bench` wrote and stores results in the suite's record format,
+ * so the next `zig build bench` compares them too:
+ *
+ *   zig build bench              # writes zig-out/bench/data/*.json
+ *   bun benchmark-suite.ts       # writes zig-out/bench/wasm.json
+ */
+
+import { readFileSync, writeFileSync } from "fs";
+import { join } from "path";
+import { validateBatch, validateBatchBitmap, z } from "./index";
+
+const DATASETS = ["valid", "invalid_heavy", "long_strings", "nested"];
+const WARMUP_BATCHES = 3;
+const outDir = process.argv[2] ?? join(import.meta.dir, "..", "zig-out", "bench");
+const batches = Number(process.argv[3] ?? 50);
+
+// Closest index.ts schema to field_specs in suite.zig: there are no int
+// bounds here, so age is only checked for being positive and id is skipped
+const schema = {
+  name: z.string(1, 64),
+  email: z.email(),
+  age: z.positive(),
+};
+
+// Nearest-rank percentile, as in suite.zig
+function percentile(sorted: number[], p: number): number {
+  const rank = Math.floor((sorted.length * p + 99) / 100);
+  return sorted[Math.max(rank, 1) - 1];
+}
+
+function measure(bench: string, dataset: string, run: () => unknown, items: number, bytes: number) {
+  for (let i = 0; i < WARMUP_BATCHES; i++) run();
+  const samples: number[] = [];
+  for (let i = 0; i < batches; i++) {
+    const start = process.hrtime.bigint();
+    run();
+    samples.push(Number(process.hrtime.bigint() - start));
+  }
+  samples.sort((a, b) => a - b);
+
+  const p50 = percentile(samples, 50);
+  return {
+    lang: "wasm",
+    bench,
+    dataset,
+    items,
+    bytes,
+    batches,
+    ns_per_item: p50 / items,
+    items_per_sec: (items * 1e9) / p50,
+    bytes_per_sec: (bytes * 1e9) / p50,
+    // Allocations happen inside WASM memory and are not observable here
+    allocs_per_batch: null,
+    p50_ns: p50,
+    p99_ns: percentile(samples, 99),
+  };
+}
+
+const records = [];
+for (const dataset of DATASETS) {
+  const raw = readFileSync(join(outDir, "data", `${dataset}.json`), "utf8");
+  const items = JSON.parse(raw);
+  const bytes = Buffer.byteLength(raw);
+
+  records.push(measure("validateBatch", dataset, () => validateBatch(items, schema), items.length, bytes));
+  records.push(measure("validateBatchBitmap", dataset, () => validateBatchBitmap(items, schema), items.length, bytes));
+  for (const record of records.slice(-2)) {
+    console.log(`wasm/${record.bench}/${dataset}: ${record.ns_per_item.toFixed(2)} ns/item`);
+  }
+}
+
+writeFileSync(join(outDir, "wasm.json"), JSON.stringify(records, null, 2));
@@ -0,0 +1,63 @@
+/**
+ * Pool worker for threads.ts: one dhi-threads.wasm instance over the shared
+ * memory it was handed, serving requests posted in its control words
+ */
+
+import { parentPort, workerData } from "node:worker_threads";
+import { ARGS, DONE, OP, Op, REQUEST, RESULT, STATE } from "./threads.js";
+
+const { memory, control: controlBuffer, wasmBytes } = workerData as {
+  memory: WebAssembly.Memory;
+  control: SharedArrayBuffer;
+  wasmBytes: Uint8Array;
+};
+const { instance } = await WebAssembly.instantiate(wasmBytes, { env: { memory } });
+const wasm = instance.exports as any;
+const control = new Int32Array(controlBuffer);
+
+// Grow-only input arena the main thread writes into (same policy as index.ts)
+let arenaPtr = 0;
+let arenaSize = 0;
+
+function reserve(size: number): number {
+  if (size > arenaSize) {
+    const grown = Math.max(size, arenaSize * 2, 4096);
+    const ptr = wasm.alloc(grown) as number;
+    if (!ptr) return 0;
+    if (arenaSize) wasm.dealloc(arenaPtr, arenaSize);
+    arenaPtr = ptr;
+    arenaSize = grown;
+  }
+  return arenaPtr;
+}
+
+function serve(op: number, a: number, b: number, c: number, d: number): number {
+  switch (op) {
+    case Op.reserve:
+      return reserve(a);
+    case Op.compilePattern:
+      return wasm.pattern_compile(a, b);
+    case Op.compileSchema:
+      return wasm.compile_schema(a, b);
+    case Op.validate:
+      return d ? wasm.validate_shape_with_bitmap(a, b, c) : wasm.validate_shape_with(a, b, c);
+    case Op.freeSchema:
+      wasm.free_schema(a);
+      return 0;
+    case Op.freePattern:
+      wasm.pattern_free(a);
+      return 0;
+  }
+  return 0;
+}
+
+parentPort!.postMessage("ready");
+
+// This thread only ever serves requests, so it blocks between them
+for (;;) {
+  let state: number;
+  while ((state = Atomics.load(control, STATE)) !== REQUEST) Atomics.wait(control, STATE, state);
+  control[RESULT] = serve(control[OP], control[ARGS], control[ARGS + 1], control[ARGS + 2], control[ARGS + 3]);
+  Atomics.store(control, STATE, DONE);
+  Atomics.notify(control, STATE);
+}
@@ -4,12 +4,19 @@
  * Universal WASM implementation - works everywhere!
  */
 
-import { readFileSync } from "fs";
+import { existsSync, readFileSync } from "fs";
+import { availableParallelism } from "os";
 import { join } from "path";
-
-// Load WASM module
-const wasmPath = join(import.meta.dir || __dirname, "dhi.wasm");
-const wasmBytes = readFileSync(wasmPath);
+import { Op, WorkerPool } from "./threads.js";
+
+// Load WASM module (prefer the SIMD128 build when present and supported)
+const wasmDir = import.meta.dir || __dirname;
+const simdPath = join(wasmDir, "dhi-simd.wasm");
+const simdBytes = existsSync(simdPath) ? readFileSync(simdPath) : null;
+const wasmBytes =
+  simdBytes && WebAssembly.validate(simdBytes)
+    ? simdBytes
+    : readFileSync(join(wasmDir, "dhi.wasm"));
 const wasmModule = await WebAssembly.instantiate(wasmBytes, {});
 const wasm = wasmModule.instance.exports as any;
 
@@ -26,29 +33,89 @@ const ValidatorType = {
   isoDatetime: 5,
   base64: 6,
   string: 7,
+  positive: 8,
+  pattern: 9,
+  boolean: 10,
 } as const;
 
 // Cached field specs for batch validation
 const schemaCache = new WeakMap<Schema, CachedSchema>();
 
+// WASM schema handles (and the patterns they reference) are freed when
+// their schema is collected, in the worker pool too. Finalizers can run at any
+// await of an async batch, whose workers are then mid-request, so worker-side
+// frees wait in pendingWorkerFrees until it settles.
+const schemaRegistry = new FinalizationRegistry((cached: CachedSchema) => {
+  wasm.free_schema(cached.handle);
+  for (const pattern of cached.patterns) wasm.pattern_free(pattern);
+  if (!cached.pool || cached.pool !== pool) return;
+  if (poolBusy) pendingWorkerFrees.push(cached);
+  else freeWorkerSchemas(cached);
+});
+const pendingWorkerFrees: CachedSchema[] = [];
+
 interface CachedSchema {
   fields: Array<{
     name: string;
     type: number;
     param1: number;
     param2: number;
+    // Regex source of pattern fields (param1 is its handle in this instance)
+    pattern?: string;
   }>;
   specBuffer: Uint8Array;
+  // compile_schema handle: parsed field specs plus a reusable results region
+  handle: number;
+  patterns: number[];
+  // The same schema compiled in every worker of `pool` (see workerSchemas)
+  pool?: WorkerPool;
+  workerHandles?: number[];
+  workerPatterns?: number[][];
+}
+
+// Build spec buffer: [num_fields][type][param1][param2]...
+// `patternHandle` resolves pattern sources for the target instance
+function encodeSpec(fields: CachedSchema["fields"], patternHandle: (source: string) => number): Uint8Array {
+  const specBuffer = new Uint8Array(1 + fields.length * 9);
+  const view = new DataView(specBuffer.buffer);
+  specBuffer[0] = fields.length;
+  let offset = 1;
+
+  for (const field of fields) {
+    specBuffer[offset++] = field.type;
+    // param1 (4 bytes)
+    view.setInt32(offset, field.pattern !== undefined ? patternHandle(field.pattern) : field.param1, true);
+    offset += 4;
+    // param2 (4 bytes)
+    view.setInt32(offset, field.param2, true);
+    offset += 4;
+  }
+  return specBuffer;
 }
 
 function cacheSchema(schema: Schema): CachedSchema {
   const cached = schemaCache.get(schema);
   if (cached) return cached;
 
+  // One DFA per distinct pattern in this schema, compiled once
+  const patterns = new Map<string, number>();
+  const compilePattern = (source: string): number => {
+    let handle = patterns.get(source);
+    if (handle === undefined) {
+      const { ptr, len } = passString(source);
+      handle = wasm.pattern_compile(ptr, len) as number;
+      freeString(ptr, len);
+      if (!handle) throw new Error(`Invalid or unsupported pattern: ${source}`);
+      patterns.set(source, handle);
+    }
+    return handle;
+  };
+
   const fields = Object.entries(schema).map(([name, validator]) => {
     let type = 0;
     let param1 = 0;
     let param2 = 0;
+    let pattern: string | undefined;
 
     switch (validator.type) {
       case "email":
@@ -77,27 +144,34 @@ function cacheSchema(schema: Schema): CachedSchema {
         param1 = validator.min;
         param2 = validator.max;
         break;
+      case "pattern":
+        type = ValidatorType.pattern;
+        param1 = compilePattern(validator.pattern);
+        pattern = validator.pattern;
+        break;
+      case "positive":
+        type = ValidatorType.positive;
+        break;
+      case "boolean":
+        type = ValidatorType.boolean;
+        break;
     }
 
-    return { name, type, param1, param2 };
+    return { name, type, param1, param2, pattern };
   });
 
-  // Build spec buffer: [num_fields][type][param1][param2]...
-  const specBuffer = new Uint8Array(1 + fields.length * 9);
-  specBuffer[0] = fields.length;
-  let offset = 1;
-
-  for (const field of fields) {
-    specBuffer[offset++] = field.type;
-    // param1 (4 bytes)
-    new DataView(specBuffer.buffer).setInt32(offset, field.param1, true);
-    offset += 4;
-    // param2 (4 bytes)
-    new DataView(specBuffer.buffer).setInt32(offset, field.param2, true);
-    offset += 4;
+  const specBuffer = encodeSpec(fields, compilePattern);
+  const specPtr = wasm.alloc(specBuffer.length);
+  new Uint8Array(wasm.memory.buffer).set(specBuffer, specPtr);
+  const handle = wasm.compile_schema(specPtr, specBuffer.length) as number;
+  wasm.dealloc(specPtr, specBuffer.length);
+  if (!handle) {
+    for (const pattern of patterns.values()) wasm.pattern_free(pattern);
+    throw new Error("compile_schema: out of memory");
   }
 
-  const result = { fields, specBuffer };
+  const result: CachedSchema = { fields, specBuffer, handle, patterns: [...patterns.values()] };
+  schemaRegistry.register(schema, result);
   schemaCache.set(schema, result);
   return result;
 }
@@ -197,7 +271,9 @@ export type Validator =
   | { type: "isoDatetime" }
   | { type: "base64" }
   | { type: "string"; min: number; max: number }
-  | { type: "positive" };
+  | { type: "pattern"; pattern: string }
+  | { type: "positive" }
+  | { type: "boolean" };
 
 // Single item validation
 export function validate(data: any, schema: Schema): ValidationResult {
@@ -248,6 +324,21 @@ export function validate(data: any, schema: Schema): ValidationResult {
         if (!valid)
           errors.push(`${field.name}: String length must be ${field.param1}-${field.param2}`);
         break;
+      case ValidatorType.pattern: {
+        const { ptr, len } = passString(value);
+        valid = Boolean(wasm.pattern_match(field.param1, ptr, len));
+        freeString(ptr, len);
+        if (!valid) errors.push(`${field.name}: Does not match pattern`);
+        break;
+      }
+      case ValidatorType.positive:
+        valid = isPositive(value);
+        if (!valid) errors.push(`${field.name}: Must be a positive number`);
+        break;
+      case ValidatorType.boolean:
+        valid = isBoolean(value);
+        if (!valid) errors.push(`${field.name}: Must be a boolean`);
+        break;
     }
   }
 
@@ -257,70 +348,462 @@ export function validate(data: any, schema: Schema): ValidationResult {
   };
 }
 
-// OPTIMIZED: Batch validation with single WASM call
-export function validateBatch(items: any[], schema: Schema): ValidationResult[] {
-  const cached = cacheSchema(schema);
+// Positive and boolean rules of validateField (wasm_api.zig), which judges
+// the text writeShape sends: a number must be > 0, text must parse as a
+// positive decimal i64 (sign and '_' separators as std.fmt.parseInt allows)
+function isPositive(value: any): boolean {
+  if (typeof value === "number") return value > 0;
+  const text = shapeText(value, ValidatorType.positive);
+  if (text === null || !/^[+-]?\d(?:[\d_]*\d)?$/.test(text)) return false;
+  const num = BigInt(text.replace(/_/g, ""));
+  return num > 0n && num <= 0x7fffffffffffffffn;
+}
 
-  // Build items buffer: [count][field1_len][field1_data][field2_len][field2_data]...
-  let totalSize = 4; // item count
-  const itemBuffers: Uint8Array[] = [];
+function isBoolean(value: any): boolean {
+  if (typeof value === "boolean") return true;
+  const text = shapeText(value, ValidatorType.boolean);
+  return text === "true" || text === "false";
+}
+
+// Grow-only input arena in WASM memory, shared by every batch call
+// (calls are synchronous, so one region is enough)
+let arenaPtr = 0;
+let arenaSize = 0;
+
+// Address of at least `size` arena bytes
+function reserveArena(size: number): number {
+  if (size > arenaSize) {
+    const grown = Math.max(size, arenaSize * 2, 4096);
+    const ptr = wasm.alloc(grown) as number;
+    if (!ptr) throw new Error("dhi: out of WASM memory");
+    if (arenaSize) wasm.dealloc(arenaPtr, arenaSize);
+    arenaPtr = ptr;
+    arenaSize = grown;
+  }
+  return arenaPtr;
+}
 
-  for (const item of items) {
+// Values sent as UTF-8. String and format fields get String(value || ""), as
+// the text encoding always sent them, so numbers arrive as their decimal text
+// and absent values as "". Positive and boolean fields get strings, bigints,
+// Dates, ... in their String() form and everything else as a typed value.
+function shapeText(value: any, type: number): string | null {
+  if (typeof value === "string") return value;
+  if (type !== ValidatorType.positive && type !== ValidatorType.boolean) return String(value || "");
+  if (value === undefined || value === null || typeof value === "number" || typeof value === "boolean") return null;
+  return String(value);
+}
+
+// Shape-encode items[start, end) (see Encoding in src/wasm_api.zig) straight
+// into an arena: numbers and booleans as raw f64 / u8, strings through
+// encodeInto, so a batch is one contiguous write with no intermediate buffers.
+// `reserve` returns the arena address inside `target` (this instance's
+// memory by default, or a pool worker's)
+function writeShape(
+  items: any[],
+  cached: CachedSchema,
+  start = 0,
+  end = items.length,
+  target: WebAssembly.Memory = wasm.memory,
+  reserve: (size: number) => number = reserveArena
+): { ptr: number; len: number } {
+  // Upper bound: tag + f64, or tag + length + 3 UTF-8 bytes per UTF-16 unit
+  let bound = 4;
+  for (let i = start; i < end; i++) {
+    const item = items[i];
     for (const field of cached.fields) {
-      const value = String(item[field.name] || "");
-      const bytes = encoder.encode(value);
-      totalSize += 4 + bytes.length; // length + data
-      itemBuffers.push(bytes);
+      const text = shapeText(item[field.name], field.type);
+      bound += text === null ? 9 : 5 + 3 * text.length;
     }
   }
 
-  const itemsBuffer = new Uint8Array(totalSize);
-  const view = new DataView(itemsBuffer.buffer);
-  view.setUint32(0, items.length, true);
+  const ptr = reserve(bound);
+  if (!ptr) throw new Error("dhi: out of WASM memory");
+  const memory = new Uint8Array(target.buffer, ptr, bound);
+  const view = new DataView(target.buffer, ptr, bound);
+  view.setUint32(0, end - start, true);
 
   let offset = 4;
-  let bufferIdx = 0;
-  for (let i = 0; i < items.length; i++) {
-    for (let f = 0; f < cached.fields.length; f++) {
-      const bytes = itemBuffers[bufferIdx++];
-      view.setUint32(offset, bytes.length, true);
-      offset += 4;
-      itemsBuffer.set(bytes, offset);
-      offset += bytes.length;
+  for (let i = start; i < end; i++) {
+    const item = items[i];
+    for (const field of cached.fields) {
+      const value = item[field.name];
+      const text = shapeText(value, field.type);
+      if (text !== null) {
+        const { written } = encoder.encodeInto(text, memory.subarray(offset + 5));
+        memory[offset] = 1;
+        view.setUint32(offset + 1, written!, true);
+        offset += 5 + written!;
+      } else if (typeof value === "number") {
+        memory[offset] = 2;
+        view.setFloat64(offset + 1, value, true);
+        offset += 9;
+      } else if (typeof value === "boolean") {
+        memory[offset] = 3;
+        memory[offset + 1] = value ? 1 : 0;
+        offset += 2;
+      } else {
+        memory[offset++] = 0; // undefined / null
+      }
     }
   }
+  return { ptr, len: offset };
+}
 
-  // Allocate WASM memory
-  const specPtr = wasm.alloc(cached.specBuffer.length);
-  const itemsPtr = wasm.alloc(itemsBuffer.length);
+// Worker pool for large batches; null until enableThreads() resolves
+let pool: WorkerPool | null = null;
+// Set while an async batch owns the pool; other batches then run on this thread
+let poolBusy = false;
+
+// Batches this large are split across the pool; below it thread hand-off
+// costs more than it saves
+const PARALLEL_MIN_ITEMS = 16384;
+
+// Start `workers` threads (default: one per spare core), each with its own
+// dhi-threads.wasm instance. From then on validateBatch and
+// validateBatchBitmap split large batches across them and this thread.
+// Resolves to the pool size; 0 when dhi-threads.wasm is not available.
+export async function enableThreads(workers = availableParallelism() - 1): Promise<number> {
+  await disableThreads();
+  const threadsPath = join(wasmDir, "dhi-threads.wasm");
+  if (workers < 1 || !existsSync(threadsPath)) return 0;
+  const threadsBytes = readFileSync(threadsPath);
+  if (!WebAssembly.validate(threadsBytes)) return 0;
+
+  pool = await WorkerPool.create(threadsBytes, workers);
+  return pool.size;
+}
 
-  const memory = new Uint8Array(wasm.memory.buffer);
-  memory.set(cached.specBuffer, specPtr);
-  memory.set(itemsBuffer, itemsPtr);
-
-  // Call optimized batch validation
-  const resultsPtr = wasm.validate_batch_optimized(
-    specPtr,
-    cached.specBuffer.length,
-    itemsPtr,
-    itemsBuffer.length
-  );
-
-  // Read results
-  const results: ValidationResult[] = [];
-  const resultsMemory = new Uint8Array(wasm.memory.buffer);
+// Stop the pool; batches run on this thread only again.
+// Await pending validateBatchAsync calls first.
+export async function disableThreads(): Promise<void> {
+  const stopping = pool;
+  pool = null;
+  if (stopping) await stopping.terminate();
+}
+
+// Schema handles of `cached` in every pool worker, compiled on first use
+function workerSchemas(cached: CachedSchema, workers: WorkerPool): number[] {
+  if (cached.pool === workers) return cached.workerHandles!;
+  cached.pool = workers;
+  cached.workerHandles = [];
+  cached.workerPatterns = [];
+
+  for (let k = 0; k < workers.size; k++) {
+    // Pattern handles are per instance, so patterns are compiled again here
+    const patterns = new Map<string, number>();
+    cached.workerPatterns.push([]);
+    const upload = (bytes: Uint8Array): number => {
+      const ptr = workers.call(k, Op.reserve, bytes.length);
+      if (!ptr) throw new Error("dhi: out of WASM memory");
+      new Uint8Array(workers.memory(k).buffer).set(bytes, ptr);
+      return ptr;
+    };
+    const spec = encodeSpec(cached.fields, (source) => {
+      let handle = patterns.get(source);
+      if (handle === undefined) {
+        const bytes = encoder.encode(source);
+        handle = workers.call(k, Op.compilePattern, upload(bytes), bytes.length);
+        patterns.set(source, handle);
+        cached.workerPatterns![k].push(handle);
+      }
+      return handle;
+    });
+    const handle = workers.call(k, Op.compileSchema, upload(spec), spec.length);
+    if (!handle) throw new Error("compile_schema: out of memory");
+    cached.workerHandles.push(handle);
+  }
+  return cached.workerHandles;
+}
+
+// Worker-side frees deferred while an async batch owned the pool
+function flushWorkerFrees() {
+  for (const cached of pendingWorkerFrees.splice(0)) {
+    if (cached.pool === pool) freeWorkerSchemas(cached);
+  }
+}
+
+function freeWorkerSchemas(cached: CachedSchema) {
+  const workers = cached.pool!;
+  cached.workerHandles!.forEach((handle, k) => workers.call(k, Op.freeSchema, handle));
+  cached.workerPatterns!.forEach((handles, k) => {
+    for (const handle of handles) workers.call(k, Op.freePattern, handle);
+  });
+}
+
+// Result bytes of a whole batch: one per item, or packed bits when `bitmap`.
+// With a pool, chunk 0 runs here while chunk k runs on worker k - 1; chunks
+// are multiples of 8 items so packed bits concatenate bytewise.
+function runBatch(items: any[], cached: CachedSchema, bitmap: boolean): Uint8Array {
+  const n = items.length;
+  const bytes = (count: number) => (bitmap ? (count + 7) >> 3 : count);
+  const out = new Uint8Array(bytes(n));
+  const workers = pool;
+  const parts = workers && !poolBusy && n >= PARALLEL_MIN_ITEMS ? workers.size + 1 : 1;
+  const chunk = parts > 1 ? Math.ceil(n / parts / 8) * 8 : n;
+
+  const pending: Array<{ k: number; start: number; end: number }> = [];
+  if (parts > 1) {
+    const handles = workerSchemas(cached, workers!);
+    for (let k = 0; k < workers!.size; k++) {
+      const start = (k + 1) * chunk;
+      const end = Math.min(n, start + chunk);
+      if (start >= end) break;
+      const reserve = (size: number) => workers!.call(k, Op.reserve, size);
+      const input = writeShape(items, cached, start, end, workers!.memory(k), reserve);
+      workers!.begin(k, Op.validate, handles[k], input.ptr, input.len, bitmap ? 1 : 0);
+      pending.push({ k, start, end });
+    }
+  }
 
+  const end = Math.min(n, chunk);
+  const input = writeShape(items, cached, 0, end);
+  // Results live in the schema's output region until its next call
+  const resultsPtr = bitmap
+    ? wasm.validate_shape_with_bitmap(cached.handle, input.ptr, input.len)
+    : wasm.validate_shape_with(cached.handle, input.ptr, input.len);
+  if (!resultsPtr) throw new Error("validate_shape_with: out of memory");
+  out.set(new Uint8Array(wasm.memory.buffer, resultsPtr, bytes(end)), 0);
+
+  // Collect every worker before reporting a failure so none is left busy
+  let failed = false;
+  for (const { k, start, end } of pending) {
+    const ptr = workers!.finish(k);
+    if (!ptr) failed = true;
+    else out.set(new Uint8Array(workers!.memory(k).buffer, ptr, bytes(end - start)), bytes(start));
+  }
+  if (failed) throw new Error("validate_shape_with: out of memory");
+  return out;
+}
+
+// Items per chunk of validateBatchAsync / validateBatchBitmapAsync
+const ASYNC_CHUNK_ITEMS = 16384;
+
+const yieldToEventLoop = () => new Promise<void>((resolve) => setImmediate(resolve));
+
+// runBatch in chunks of about `chunk` items (rounded up to a multiple of 8),
+// without holding the event loop for more than one chunk: with a free pool,
+// every worker takes chunks in turn while this thread only encodes them;
+// otherwise chunks run here with a turn of the event loop between them.
+async function runBatchAsync(items: any[], cached: CachedSchema, bitmap: boolean, chunk: number): Promise<Uint8Array> {
+  const n = items.length;
+  const bytes = (count: number) => (bitmap ? (count + 7) >> 3 : count);
+  const out = new Uint8Array(bytes(n));
+  const size = Math.max(8, Math.ceil(chunk / 8) * 8);
+  const workers = pool && !poolBusy ? pool : null;
+
+  if (!workers) {
+    for (let start = 0; start < n; start += size) {
+      const end = Math.min(n, start + size);
+      const input = writeShape(items, cached, start, end);
+      const resultsPtr = bitmap
+        ? wasm.validate_shape_with_bitmap(cached.handle, input.ptr, input.len)
+        : wasm.validate_shape_with(cached.handle, input.ptr, input.len);
+      if (!resultsPtr) throw new Error("validate_shape_with: out of memory");
+      out.set(new Uint8Array(wasm.memory.buffer, resultsPtr, bytes(end - start)), bytes(start));
+      if (end < n) await yieldToEventLoop();
+    }
+    return out;
+  }
+
+  poolBusy = true;
+  try {
+    const handles = workerSchemas(cached, workers);
+    let next = 0;
+    const drain = async (k: number) => {
+      while (next < n) {
+        const start = next;
+        const end = Math.min(n, start + size);
+        next = end;
+        const reserve = (bound: number) => workers.call(k, Op.reserve, bound);
+        const input = writeShape(items, cached, start, end, workers.memory(k), reserve);
+        workers.begin(k, Op.validate, handles[k], input.ptr, input.len, bitmap ? 1 : 0);
+        const ptr = await workers.finishAsync(k);
+        if (!ptr) throw new Error("validate_shape_with: out of memory");
+        out.set(new Uint8Array(workers.memory(k).buffer, ptr, bytes(end - start)), bytes(start));
+      }
+    };
+    // Settle every worker before reporting a failure so none is left busy
+    const settled = await Promise.allSettled(Array.from({ length: workers.size }, (_, k) => drain(k)));
+    const failure = settled.find((result) => result.status === "rejected");
+    if (failure) throw (failure as PromiseRejectedResult).reason;
+  } finally {
+    poolBusy = false;
+    flushWorkerFrees();
+  }
+  return out;
+}
+
+// OPTIMIZED: Batch validation with single WASM call (per thread, see enableThreads)
+export function validateBatch(items: any[], schema: Schema): ValidationResult[] {
+  const cached = cacheSchema(schema);
+  const bytes = runBatch(items, cached, false);
+
+  const results: ValidationResult[] = [];
   for (let i = 0; i < items.length; i++) {
-    const valid = resultsMemory[resultsPtr + i] === 1;
+    const valid = bytes[i] === 1;
     results.push({ valid, errors: valid ? undefined : ["Validation failed"] });
   }
+  return results;
+}
 
-  // Cleanup
-  wasm.dealloc(specPtr, cached.specBuffer.length);
-  wasm.dealloc(itemsPtr, itemsBuffer.length);
-  wasm.dealloc(resultsPtr, items.length);
+// Packed batch results: bit i (LSB-first) of bits[i >> 3] is 1 when item i is valid
+export class ValidationBitmap {
+  constructor(readonly bits: Uint8Array, readonly length: number) {}
 
-  return results;
+  isValid(i: number): boolean {
+    return ((this.bits[i >> 3] >> (i & 7)) & 1) === 1;
+  }
+
+  validCount(): number {
+    let count = 0;
+    for (let b of this.bits) {
+      // Popcount per byte
+      b = b - ((b >> 1) & 0x55);
+      b = (b & 0x33) + ((b >> 2) & 0x33);
+      count += (b + (b >> 4)) & 0x0f;
+    }
+    return count;
+  }
+
+  firstInvalid(): number | null {
+    const next = this.invalidIndices().next();
+    return next.done ? null : next.value;
+  }
+
+  *invalidIndices(): Generator<number> {
+    for (let byte = 0; byte < this.bits.length; byte++) {
+      // Skip fully valid bytes
+      if (this.bits[byte] === 0xff) continue;
+      const end = Math.min(this.length, (byte + 1) * 8);
+      for (let i = byte * 8; i < end; i++) {
+        if (!this.isValid(i)) yield i;
+      }
+    }
+  }
+}
+
+// Batch validation returning packed results (1 bit per item instead of an object)
+export function validateBatchBitmap(items: any[], schema: Schema): ValidationBitmap {
+  // Copied out of the schema's output regions (reused by their next call)
+  return new ValidationBitmap(runBatch(items, cacheSchema(schema), true), items.length);
+}
+
+export interface AsyncBatchOptions {
+  // Items per chunk; the event loop is held for at most one chunk at a time
+  chunk?: number;
+}
+
+// validateBatch for servers: chunks run on the worker pool when enabled (the
+// event loop keeps serving I/O meanwhile) or here, yielding between chunks.
+// Only one async batch uses the pool at a time; others run on this thread.
+export async function validateBatchAsync(
+  items: any[],
+  schema: Schema,
+  { chunk = ASYNC_CHUNK_ITEMS }: AsyncBatchOptions = {},
+): Promise<ValidationResult[]> {
+  const bytes = await runBatchAsync(items, cacheSchema(schema), false, chunk);
+  return Array.from(bytes, (b) => (b === 1 ? { valid: true } : { valid: false, errors: ["Validation failed"] }));
+}
+
+// validateBatchBitmap, in chunks as in validateBatchAsync
+export async function validateBatchBitmapAsync(
+  items: any[],
+  schema: Schema,
+  { chunk = ASYNC_CHUNK_ITEMS }: AsyncBatchOptions = {},
+): Promise<ValidationBitmap> {
+  return new ValidationBitmap(await runBatchAsync(items, cacheSchema(schema), true, chunk), items.length);
+}
+
+// Error codes of the packed error report (see src/error_report.zig)
+export const ErrorCode = {
+  1: "missing",
+  2: "wrong_type",
+  3: "too_small",
+  4: "too_large",
+  5: "not_multiple",
+  6: "invalid_format",
+  7: "pattern_mismatch",
+  8: "not_an_object",
+  9: "not_allowed",
+  10: "invalid_nested",
+} as const;
+
+export interface Violation {
+  index: number;
+  field: string | null;
+  code: (typeof ErrorCode)[keyof typeof ErrorCode];
+  param: number;
+}
+
+// Every violation of a batch as struct-of-arrays views over one buffer;
+// Violation objects are only built for the entries that are read
+export class ValidationErrorReport {
+  readonly itemIndex: Uint32Array;
+  readonly param: Int32Array;
+  readonly fieldIndex: Uint16Array;
+  readonly code: Uint8Array;
+
+  constructor(
+    buffer: ArrayBuffer,
+    readonly length: number,
+    readonly count: number,
+    readonly validCount: number,
+    private readonly fieldNames: string[]
+  ) {
+    const n = length;
+    this.itemIndex = new Uint32Array(buffer, 0, n);
+    this.param = new Int32Array(buffer, 4 * n, n);
+    this.fieldIndex = new Uint16Array(buffer, 8 * n, n);
+    this.code = new Uint8Array(buffer, 10 * n, n);
+  }
+
+  get(i: number): Violation {
+    const field = this.fieldIndex[i];
+    return {
+      index: this.itemIndex[i],
+      field: field === 0xffff ? null : this.fieldNames[field],
+      code: ErrorCode[this.code[i] as keyof typeof ErrorCode],
+      param: this.param[i],
+    };
+  }
+
+  // Violations of item `index` (entries are sorted by item)
+  forItem(index: number): Violation[] {
+    let lo = 0;
+    let hi = this.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >> 1;
+      if (this.itemIndex[mid] < index) lo = mid + 1;
+      else hi = mid;
+    }
+    const out: Violation[] = [];
+    for (let i = lo; i < this.length && this.itemIndex[i] === index; i++) out.push(this.get(i));
+    return out;
+  }
+
+  *[Symbol.iterator](): Generator<Violation> {
+    for (let i = 0; i < this.length; i++) yield this.get(i);
+  }
+}
+
+// Batch validation collecting every failing field of every item
+export function validateBatchErrors(items: any[], schema: Schema): ValidationErrorReport {
+  const cached = cacheSchema(schema);
+  const input = writeShape(items, cached);
+
+  const reportPtr = wasm.validate_shape_with_errors(cached.handle, input.ptr, input.len);
+  if (!reportPtr) throw new Error("validate_shape_with_errors: out of memory");
+
+  const header = new DataView(wasm.memory.buffer, reportPtr, 8);
+  const violations = header.getUint32(0, true);
+  const validCount = header.getUint32(4, true);
+  // Copy out of the schema's output region (reused by its next call, and
+  // WASM memory may grow and detach views)
+  const buffer = new Uint8Array(wasm.memory.buffer, reportPtr + 8, 11 * violations).slice().buffer;
+
+  const names = cached.fields.map((field) => field.name);
+  return new ValidationErrorReport(buffer, violations, items.length, validCount, names);
 }
 
 // Zod-like API
@@ -338,9 +821,23 @@ export const z = {
   isoDate: () => ({ type: "isoDate" as const }),
   isoDatetime: () => ({ type: "isoDatetime" as const }),
   base64: () => ({ type: "base64" as const }),
+  // Regex source (see src/regex.zig for the supported syntax)
+  pattern: (pattern: string) => ({ type: "pattern" as const, pattern }),
 
   positive: () => ({ type: "positive" as const }),
+  boolean: () => ({ type: "boolean" as const }),
 };
 
 // Export for convenience
-export default { validate, validateBatch, validators, z };
+export default {
+  validate,
+  validateBatch,
+  validateBatchBitmap,
+  validateBatchAsync,
+  validateBatchBitmapAsync,
+  validateBatchErrors,
+  enableThreads,
+  disableThreads,
+  validators,
+  z,
+};
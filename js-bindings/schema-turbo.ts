@@ -3,14 +3,37 @@
  * Uses WASM batch APIs to avoid encoding overhead
  */
 
-import { readFileSync } from "fs";
+import { existsSync, readFileSync } from "fs";
 import { join } from "path";
 
-const wasmPath = join(import.meta.dir || __dirname, "dhi.wasm");
-const wasmBytes = readFileSync(wasmPath);
+// Prefer the SIMD128 build (vectorized batch kernels) when present and supported
+const wasmDir = import.meta.dir || __dirname;
+const simdPath = join(wasmDir, "dhi-simd.wasm");
+const simdBytes = existsSync(simdPath) ? readFileSync(simdPath) : null;
+const wasmBytes =
+  simdBytes && WebAssembly.validate(simdBytes)
+    ? simdBytes
+    : readFileSync(join(wasmDir, "dhi.wasm"));
 const wasmModule = await WebAssembly.instantiate(wasmBytes, {});
 const wasm = wasmModule.instance.exports as any;
 
+// Grow-only scratch region in WASM memory for batch inputs and results
+// (calls are synchronous, so one region is enough)
+let scratchPtr = 0;
+let scratchSize = 0;
+
+function scratch(size: number): number {
+  if (size > scratchSize) {
+    const grown = Math.max(size, scratchSize * 2, 4096);
+    const ptr = wasm.alloc(grown) as number;
+    if (!ptr) throw new Error("dhi: out of WASM memory");
+    if (scratchSize) wasm.dealloc(scratchPtr, scratchSize);
+    scratchPtr = ptr;
+    scratchSize = grown;
+  }
+  return scratchPtr;
+}
+
 export type ValidationResult<T> = 
   | { success: true; data: T }
   | { success: false; error: string };
@@ -44,9 +67,9 @@ export function stringLength(min: number, max: number) {
   return new TurboSchema<string>((items: string[]) => {
     const count = items.length;
     
-    // Allocate arrays in WASM
-    const lengthsPtr = wasm.alloc(count * 4); // u32 array
-    const resultsPtr = wasm.alloc(count);      // u8 array
+    // u32 lengths, then u8 results, in the scratch region
+    const lengthsPtr = scratch(count * 5);
+    const resultsPtr = lengthsPtr + count * 4;
     
     // Write lengths directly
     const lengthsArray = new Uint32Array(wasm.memory.buffer, lengthsPtr, count);
@@ -59,13 +82,7 @@ export function stringLength(min: number, max: number) {
     
     // Read results
     const resultsArray = new Uint8Array(wasm.memory.buffer, resultsPtr, count);
-    const results = Array.from(resultsArray, v => v === 1);
-    
-    // Cleanup
-    wasm.dealloc(lengthsPtr, count * 4);
-    wasm.dealloc(resultsPtr, count);
-    
-    return results;
+    return Array.from(resultsArray, v => v === 1);
   });
 }
 
@@ -74,9 +91,9 @@ export function numberRange(min: number, max: number) {
   return new TurboSchema<number>((items: number[]) => {
     const count = items.length;
     
-    // Allocate arrays in WASM
-    const numbersPtr = wasm.alloc(count * 8); // f64 array
-    const resultsPtr = wasm.alloc(count);      // u8 array
+    // f64 numbers, then u8 results, in the scratch region (8-byte aligned)
+    const numbersPtr = scratch(count * 9);
+    const resultsPtr = numbersPtr + count * 8;
     
     // Write numbers directly
     const numbersArray = new Float64Array(wasm.memory.buffer, numbersPtr, count);
@@ -87,13 +104,7 @@ export function numberRange(min: number, max: number) {
     
     // Read results
     const resultsArray = new Uint8Array(wasm.memory.buffer, resultsPtr, count);
-    const results = Array.from(resultsArray, v => v === 1);
-    
-    // Cleanup
-    wasm.dealloc(numbersPtr, count * 8);
-    wasm.dealloc(resultsPtr, count);
-    
-    return results;
+    return Array.from(resultsArray, v => v === 1);
   });
 }
 
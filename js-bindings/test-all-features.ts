@@ -4,6 +4,7 @@
  */
 
 import { z, infer as zodInfer } from "./schema";
+import { validate, validateBatch, validateBatchBitmap, z as batch } from "./index";
 
 console.log("🧪 Testing All Features");
 console.log("=".repeat(80));
@@ -456,6 +457,47 @@ test("type inference", () => {
   schema.parse(user);
 });
 
+// ============================================================================
+// Batch API
+// ============================================================================
+
+console.log("\n📦 Batch API");
+console.log("-".repeat(80));
+
+test("validateBatch() coerces string fields with String(value || \"\")", () => {
+  const schema = { code: batch.string(1, 10), note: batch.string(), count: batch.positive() };
+  const items = [
+    { code: 12345, count: 3 },         // number as "12345"; absent note as ""
+    { code: "", note: "x", count: 3 },
+    { code: "ok", count: 0 },          // positive fields get the number itself
+    { code: "ok" },
+  ];
+  const expected = [true, false, false, false];
+  const results = validateBatch(items, schema).map((result) => result.valid);
+  if (JSON.stringify(results) !== JSON.stringify(expected)) throw new Error(`Got ${results}`);
+  const bits = validateBatchBitmap(items, schema);
+  if (expected.some((valid, i) => bits.isValid(i) !== valid)) throw new Error("Bitmap differs");
+});
+
+test("validate() and validateBatch() agree on positive and boolean fields", () => {
+  const schema = { age: batch.positive(), active: batch.boolean() };
+  const items = [
+    { age: 5, active: true },
+    { age: "5", active: "false" },     // text is parsed on both paths
+    { age: "0", active: true },
+    { age: "5.5", active: true },
+    { age: 5n, active: true },
+    { age: -1, active: true },
+    { age: 5, active: "yes" },
+    { age: 5, active: 1 },
+  ];
+  const batchResults = validateBatch(items, schema).map((result) => result.valid);
+  const singleResults = items.map((item) => validate(item, schema).valid);
+  const expected = [true, true, false, false, true, false, false, false];
+  if (JSON.stringify(batchResults) !== JSON.stringify(expected)) throw new Error(`Batch got ${batchResults}`);
+  if (JSON.stringify(singleResults) !== JSON.stringify(expected)) throw new Error(`Single got ${singleResults}`);
+});
+
 // ============================================================================
 // Summary
 // ============================================================================
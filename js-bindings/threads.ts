@@ -0,0 +1,137 @@
+/**
+ * Worker pool for large batches (see enableThreads in index.ts)
+ *
+ * Every worker instantiates dhi-threads.wasm over its own shared
+ * WebAssembly.Memory. The main thread writes shape-encoded input straight
+ * into that memory and reads results back out of it, so the only
+ * cross-thread traffic is a few control words per call. `finish` blocks
+ * in Atomics.wait until the worker stores DONE; `finishAsync` waits with
+ * Atomics.waitAsync instead, so the event loop keeps running.
+ */
+
+import { Worker } from "node:worker_threads";
+
+// Memory limits in 64 KiB pages; must match initial_memory / max_memory of
+// the dhi-threads artifact in build.zig
+const INITIAL_PAGES = 256;
+const MAXIMUM_PAGES = 16384;
+
+// Not in every runtime (nor in older TypeScript libs); polled otherwise
+const waitAsync: ((array: Int32Array, index: number, value: number) => { async: boolean; value: unknown }) | undefined =
+  (Atomics as any).waitAsync;
+
+// Control words (Int32Array over a SharedArrayBuffer per worker)
+export const STATE = 0;
+export const OP = 1;
+export const ARGS = 2; // four arguments
+export const RESULT = 6;
+export const CONTROL_WORDS = 7;
+
+export const IDLE = 0;
+export const REQUEST = 1;
+export const DONE = 2;
+
+// Requests understood by dhi-worker.ts
+export const Op = {
+  // (size) -> address of a grow-only input arena of at least size bytes
+  reserve: 1,
+  // (ptr, len) -> pattern_compile handle
+  compilePattern: 2,
+  // (ptr, len) -> compile_schema handle
+  compileSchema: 3,
+  // (handle, ptr, len, bitmap) -> address of the item or bitmap results
+  validate: 4,
+  // (handle) -> 0
+  freeSchema: 5,
+  // (handle) -> 0
+  freePattern: 6,
+} as const;
+
+interface PoolWorker {
+  worker: Worker;
+  memory: WebAssembly.Memory;
+  control: Int32Array;
+}
+
+export class WorkerPool {
+  private constructor(private readonly workers: PoolWorker[]) {}
+
+  // `size` workers, each running its own instance of `wasmBytes`
+  static async create(wasmBytes: Uint8Array, size: number): Promise<WorkerPool> {
+    return new WorkerPool(await Promise.all(Array.from({ length: size }, () => spawn(wasmBytes))));
+  }
+
+  get size(): number {
+    return this.workers.length;
+  }
+
+  // Worker k's memory; re-read .buffer after any call, the worker may grow it
+  memory(k: number): WebAssembly.Memory {
+    return this.workers[k].memory;
+  }
+
+  // Post a request to worker k without waiting for it. Refuses a worker that
+  // has not been finished yet: its control words still belong to that request.
+  begin(k: number, op: number, a = 0, b = 0, c = 0, d = 0): void {
+    const control = this.workers[k].control;
+    if (Atomics.load(control, STATE) !== IDLE) throw new Error(`dhi: pool worker ${k} is busy`);
+    control[OP] = op;
+    control[ARGS] = a;
+    control[ARGS + 1] = b;
+    control[ARGS + 2] = c;
+    control[ARGS + 3] = d;
+    Atomics.store(control, STATE, REQUEST);
+    Atomics.notify(control, STATE);
+  }
+
+  // Wait for worker k's pending request and return its result
+  finish(k: number): number {
+    const control = this.workers[k].control;
+    while (Atomics.load(control, STATE) !== DONE) Atomics.wait(control, STATE, REQUEST);
+    const result = control[RESULT];
+    Atomics.store(control, STATE, IDLE);
+    return result;
+  }
+
+  // finish without blocking this thread
+  async finishAsync(k: number): Promise<number> {
+    const control = this.workers[k].control;
+    while (Atomics.load(control, STATE) !== DONE) {
+      if (waitAsync) {
+        const wait = waitAsync(control, STATE, REQUEST);
+        if (wait.async) await wait.value;
+      } else {
+        await new Promise((resolve) => setTimeout(resolve, 0));
+      }
+    }
+    return this.finish(k);
+  }
+
+  // begin + finish; throws (through begin) when worker k is busy
+  call(k: number, op: number, a = 0, b = 0, c = 0, d = 0): number {
+    this.begin(k, op, a, b, c, d);
+    return this.finish(k);
+  }
+
+  async terminate(): Promise<void> {
+    await Promise.all(this.workers.map(({ worker }) => worker.terminate()));
+  }
+}
+
+async function spawn(wasmBytes: Uint8Array): Promise<PoolWorker> {
+  const memory = new WebAssembly.Memory({ initial: INITIAL_PAGES, maximum: MAXIMUM_PAGES, shared: true });
+  const control = new Int32Array(new SharedArrayBuffer(CONTROL_WORDS * 4));
+  // Bun runs the sources directly; the published package ships dist/*.js
+  const script = import.meta.url.endsWith(".ts") ? "./dhi-worker.ts" : "./dhi-worker.js";
+  const worker = new Worker(new URL(script, import.meta.url), {
+    workerData: { memory, control: control.buffer, wasmBytes },
+  });
+
+  await new Promise<void>((resolve, reject) => {
+    worker.once("message", () => resolve());
+    worker.once("error", reject);
+  });
+  // An idle pool must not keep the process alive
+  worker.unref();
+  return { worker, memory, control };
+}
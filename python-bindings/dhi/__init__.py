@@ -19,6 +19,10 @@ from .validator import (
 
 from .batch import (
     BatchValidationResult,
+    compile_schema,
+    native_stats,
+    validate_batch_async,
+    validation_errors,
     validate_users_batch,
     validate_ints_batch,
     validate_strings_batch,
@@ -41,6 +45,10 @@ __all__ = [
     "_dhi_native",
     # Batch validation
     "BatchValidationResult",
+    "compile_schema",
+    "native_stats",
+    "validate_batch_async",
+    "validation_errors",
     "validate_users_batch",
     "validate_ints_batch",
     "validate_strings_batch",
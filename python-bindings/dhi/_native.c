@@ -5,6 +5,11 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <math.h>
 
 // External Zig functions from libsatya - COMPREHENSIVE VALIDATORS
 // Basic validators
@@ -38,6 +43,160 @@ extern int satya_validate_int_multiple_of(long value, long divisor);
 extern int satya_validate_float_gt(double value, double min);
 extern int satya_validate_float_finite(double value);
 
+// Regex patterns compiled to a DFA (src/regex.zig). Schemas keep a cache so
+// each distinct pattern is compiled once; matching is linear in the input.
+struct SatyaPattern;
+struct SatyaPatternCache;
+enum { SATYA_PATTERN_OK, SATYA_PATTERN_INVALID, SATYA_PATTERN_UNSUPPORTED, SATYA_PATTERN_TOO_COMPLEX, SATYA_PATTERN_NO_MEMORY };
+extern struct SatyaPatternCache* satya_pattern_cache_new(void);
+extern const struct SatyaPattern* satya_pattern_cache_get(struct SatyaPatternCache* cache, const char* pattern, size_t len,
+                                                          int32_t* status);
+extern void satya_pattern_cache_free(struct SatyaPatternCache* cache);
+extern int satya_pattern_match(const struct SatyaPattern* pattern, const char* ptr, size_t len);
+
+// Columnar batch validation (layout must match Column in src/column_validator.zig)
+struct SatyaColumn {
+    uint8_t kind;                   // enum ValidatorType
+    int64_t param1;
+    int64_t param2;
+    const int64_t* ints;            // Int kinds
+    const char* const* str_ptrs;    // String kinds: UTF-8 data
+    const size_t* str_lens;         //               byte lengths
+    const unsigned char* present;   // 0 = missing or wrong type
+    const struct SatyaPattern* pattern;  // VAL_PATTERN
+};
+extern size_t satya_validate_columns(const struct SatyaColumn* columns, size_t num_columns,
+                                     size_t count, unsigned char* results, size_t num_threads);
+extern size_t satya_validate_columns_bitmap(const struct SatyaColumn* columns, size_t num_columns,
+                                            size_t count, unsigned char* bits, size_t num_threads);
+extern size_t satya_cpu_count(void);
+
+// Packed results: bit i of bits[i / 8] = item i valid (matches src/bitmap.zig)
+extern size_t satya_bitmap_valid_count(const unsigned char* bits, size_t count);
+extern size_t satya_bitmap_next_invalid(const unsigned char* bits, size_t count, size_t from);
+
+// Streaming JSON array validation (layout must match JsonFieldSpec in src/c_api.zig)
+struct SatyaJsonFieldSpec {
+    const char* name;
+    size_t name_len;
+    uint8_t kind;                   // enum ValidatorType
+    int64_t param1;
+    int64_t param2;
+    const struct SatyaPattern* pattern;  // VAL_PATTERN
+};
+extern ptrdiff_t satya_validate_json_array(const char* json, size_t json_len,
+                                           const struct SatyaJsonFieldSpec* specs, size_t num_specs,
+                                           unsigned char* results, size_t max_results);
+
+// Memory-mapped JSON array / NDJSON file validation (matches FileValidationResult)
+// Every violation of a batch; data is violations * 11 bytes laid out as
+// item_index u32[n], param i32[n], field_index u16[n], code u8[n]
+struct SatyaErrorReport {
+    unsigned char* data;
+    size_t violations;
+    size_t count;
+    size_t valid_count;
+};
+extern ptrdiff_t satya_validate_json_array_errors(const char* json, size_t json_len,
+                                                  const struct SatyaJsonFieldSpec* specs, size_t num_specs,
+                                                  struct SatyaErrorReport* out);
+extern void satya_free_error_report(struct SatyaErrorReport* report);
+
+struct SatyaFileResult {
+    unsigned char* bits;            // Packed, owned by the library
+    size_t count;
+    size_t valid_count;
+};
+extern ptrdiff_t satya_validate_file(const char* path, size_t path_len,
+                                     const struct SatyaJsonFieldSpec* specs, size_t num_specs,
+                                     uint8_t mode, size_t max_threads, struct SatyaFileResult* out);
+extern void satya_free_file_result(struct SatyaFileResult* result);
+
+// One contiguous string column against any string kind (matches StringSpec in
+// src/column_validator.zig); packed results
+struct SatyaStringSpec {
+    uint8_t kind;                   // enum ValidatorType
+    int64_t param1;
+    int64_t param2;
+    const char* needle;             // VAL_CONTAINS / VAL_STARTS_WITH / VAL_ENDS_WITH
+    size_t needle_len;
+    const struct SatyaPattern* pattern;  // VAL_PATTERN
+    bool memo;                      // Cache results of repeated values within the call
+};
+extern size_t satya_validate_string_column32(const struct SatyaStringSpec* spec, const int32_t* offsets, size_t count,
+                                             const char* data, size_t data_len, const unsigned char* validity,
+                                             unsigned char* bits);
+extern size_t satya_validate_string_column64(const struct SatyaStringSpec* spec, const int64_t* offsets, size_t count,
+                                             const char* data, size_t data_len, const unsigned char* validity,
+                                             unsigned char* bits);
+
+// Length-aware string checks (same as the column kernels; no NUL scan)
+extern int satya_check_string(uint8_t kind, const char* ptr, size_t len, int64_t param1, int64_t param2);
+extern size_t satya_check_strings(uint8_t kind, int64_t param1, int64_t param2,
+                                  const char* const* ptrs, const size_t* lens, size_t count,
+                                  unsigned char* results);
+
+// Flat buffer / Arrow column kernels (validity: optional Arrow null bitmap)
+extern size_t satya_validate_int_values(uint8_t kind, int64_t param1, int64_t param2,
+                                        const int64_t* values, size_t count, const unsigned char* validity,
+                                        unsigned char* results, bool packed_results);
+extern size_t satya_validate_float_range(const double* values, size_t count, double min, double max,
+                                         const unsigned char* validity, unsigned char* results, bool packed_results);
+extern size_t satya_validate_string_offsets32(uint8_t kind, int64_t param1, int64_t param2,
+                                              const int32_t* offsets, size_t count,
+                                              const char* data, size_t data_len, const unsigned char* validity,
+                                              unsigned char* results, bool packed_results);
+extern size_t satya_validate_string_offsets64(uint8_t kind, int64_t param1, int64_t param2,
+                                              const int64_t* offsets, size_t count,
+                                              const char* data, size_t data_len, const unsigned char* validity,
+                                              unsigned char* results, bool packed_results);
+
+// Schemas specialized at build time (zig build -Dschema=..., see src/schema_codegen.zig)
+// Kernels take one SatyaColumn per field, in field order; kind/params are baked in.
+typedef size_t (*satya_generated_kernel)(const struct SatyaColumn* columns, size_t count, unsigned char* out);
+struct SatyaGeneratedField {
+    const char* name;
+    uint8_t kind;                   // enum ValidatorType
+    int64_t param1;
+    int64_t param2;
+};
+struct SatyaGeneratedSchema {
+    const char* name;
+    const struct SatyaGeneratedField* fields;
+    size_t num_fields;
+    satya_generated_kernel validate;         // 0/1 per item
+    satya_generated_kernel validate_bitmap;  // Packed
+};
+extern size_t satya_generated_schema_count(void);
+extern const struct SatyaGeneratedSchema* satya_generated_schema(size_t index);
+
+// Per-validator counters (src/stats.zig); slots 0-19 are the shared kinds
+struct SatyaStatsSnapshot {
+    uint64_t checks;
+    uint64_t failures;
+    uint64_t cycles;
+};
+extern bool satya_stats_enabled(void);
+extern size_t satya_stats_slot_count(void);
+extern const char* satya_stats_slot_name(size_t slot);
+extern size_t satya_stats_snapshot(struct SatyaStatsSnapshot* out, size_t len);
+extern void satya_stats_reset(void);
+struct SatyaMemoSnapshot {
+    uint64_t lookups;
+    uint64_t hits;
+};
+extern bool satya_stats_memo(struct SatyaMemoSnapshot* out);
+extern void satya_stats_memo_record(size_t lookups, size_t hits);
+extern uint64_t satya_stats_begin(void);
+extern void satya_stats_end(uint8_t slot, bool ok, uint64_t probe);
+
+// Batches below this size are validated in place without releasing the GIL
+// (keep in sync with min_items_per_thread in src/column_validator.zig)
+#define PARALLEL_MIN_ITEMS 4096
+
+// Default worker count for threads=0; set via set_num_threads()
+static Py_ssize_t default_num_threads = 0;
+
 // Python wrapper: validate_int(value, min, max) -> bool
 static PyObject* py_validate_int(PyObject* self, PyObject* args) {
     long value, min, max;
@@ -76,6 +235,7 @@ static PyObject* py_validate_email(PyObject* self, PyObject* args) {
 }
 
 // Validator type enum for fast dispatch
+// Values are shared with Kind in src/column_validator.zig
 enum ValidatorType {
     VAL_INT = 0,
     VAL_INT_GT,
@@ -93,7 +253,21 @@ enum ValidatorType {
     VAL_BASE64,
     VAL_ISO_DATE,
     VAL_ISO_DATETIME,
-    VAL_UNKNOWN
+    VAL_CONTAINS,       // Substring kinds: string columns only (need a needle)
+    VAL_STARTS_WITH,
+    VAL_ENDS_WITH,
+    VAL_PATTERN,        // ('pattern', regex): compiled once per schema
+    VAL_UNKNOWN,
+    // Python path only (not in the shared numbering): checked in check_value
+    VAL_FLOAT,          // ('float'[, min[, max]]): float or int; unbounded by default (NaN fails)
+    VAL_FLOAT_GT,
+    VAL_FLOAT_GTE,
+    VAL_FLOAT_LT,
+    VAL_FLOAT_LTE,
+    VAL_FLOAT_FINITE,
+    VAL_FLOAT_MULTIPLE_OF,
+    VAL_BOOL,           // True or False only
+    VAL_NESTED          // object / list / optional / nullable / default / one_of
 };
 
 // Convert string to enum (do this ONCE, not per item!)
@@ -116,6 +290,15 @@ static enum ValidatorType parse_validator_type(const char* type_str) {
         case 's':
             if (strcmp(type_str, "string") == 0) return VAL_STRING;
             break;
+        case 'f':
+            if (strcmp(type_str, "float") == 0) return VAL_FLOAT;
+            if (strcmp(type_str, "float_gt") == 0) return VAL_FLOAT_GT;
+            if (strcmp(type_str, "float_gte") == 0) return VAL_FLOAT_GTE;
+            if (strcmp(type_str, "float_lt") == 0) return VAL_FLOAT_LT;
+            if (strcmp(type_str, "float_lte") == 0) return VAL_FLOAT_LTE;
+            if (strcmp(type_str, "float_finite") == 0) return VAL_FLOAT_FINITE;
+            if (strcmp(type_str, "float_multiple_of") == 0) return VAL_FLOAT_MULTIPLE_OF;
+            break;
         case 'e':
             if (strcmp(type_str, "email") == 0) return VAL_EMAIL;
             break;
@@ -125,255 +308,2972 @@ static enum ValidatorType parse_validator_type(const char* type_str) {
             break;
         case 'b':
             if (strcmp(type_str, "base64") == 0) return VAL_BASE64;
+            if (strcmp(type_str, "bool") == 0) return VAL_BOOL;
+            break;
+        case 'p':
+            if (strcmp(type_str, "pattern") == 0) return VAL_PATTERN;
             break;
     }
     return VAL_UNKNOWN;
 }
 
+struct Instr;
+
+static inline int is_float_validator(enum ValidatorType type) {
+    return type >= VAL_FLOAT && type <= VAL_FLOAT_MULTIPLE_OF;
+}
+
 // Field spec with pre-parsed validator type AND cached PyObject
 struct FieldSpec {
     PyObject* field_name_obj;  // Cached PyObject* for fast dict lookup
+    Py_hash_t field_hash;      // Precomputed hash of field_name_obj
     const char* field_name;
     enum ValidatorType validator_type;
     long param1;
     long param2;
+    double fparam1;                      // Float kinds: bound or divisor
+    double fparam2;                      // VAL_FLOAT: max
+    const struct SatyaPattern* pattern;  // VAL_PATTERN: owned by the schema's pattern cache
+    const struct Instr* program;         // VAL_NESTED: owned by the schema's SpecStore
+    Py_ssize_t program_pc;               // VAL_NESTED: index of program while compiling
+    int missing_ok;                      // ('optional', ...) / ('default', ...): absent passes
 };
 
-// OPTIMIZED: validate_batch_direct with enum dispatch
-static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args) {
-    PyObject* items_list;
-    PyObject* field_specs_dict;
-    
-    if (!PyArg_ParseTuple(args, "O!O!", 
-                          &PyList_Type, &items_list,
-                          &PyDict_Type, &field_specs_dict)) {
+// Look up a field using its precomputed hash (skips rehashing the key per item).
+// Borrowed; NULL when the field is missing, or NULL with an exception set when
+// the lookup raised (a key's __eq__): callers check PyErr_Occurred() on NULL.
+static inline PyObject* lookup_field(PyObject* item, const struct FieldSpec* spec) {
+#if PY_VERSION_HEX < 0x030D0000
+    return _PyDict_GetItem_KnownHash(item, spec->field_name_obj, spec->field_hash);
+#else
+    return PyDict_GetItemWithError(item, spec->field_name_obj);
+#endif
+}
+
+// Nested specs ('object', 'list', 'optional', 'nullable', 'default', 'one_of') compile to a
+// flat instruction stream. Every instruction heads a block of `size`
+// instructions (itself and its operands), so operands start right after it and
+// the next sibling is `size` away; run_program recurses only as deep as the
+// schema nests.
+enum OpCode {
+    OP_CHECK,     // Leaf validator in `leaf`
+    OP_OBJECT,    // dict; followed by `count` OP_KEY blocks
+    OP_KEY,       // Key in `leaf` (name and hash); followed by its value block
+    OP_LIST,      // list of leaf.param1..leaf.param2 items; followed by the item block
+    OP_ONE_OF,    // Value in the `allowed` frozenset
+    OP_NULLABLE,  // None passes; anything else must match the following block
+};
+
+struct Instr {
+    uint8_t op;
+    uint8_t missing_ok;     // OP_KEY: the value spec is optional / default
+    uint32_t size;          // Instructions in this block, including this one
+    uint32_t count;         // OP_OBJECT: number of keys
+    struct FieldSpec leaf;  // OP_CHECK validator, OP_KEY key (owned), OP_LIST bounds
+    PyObject* allowed;      // OP_ONE_OF (owned)
+};
+
+#define MAX_SPEC_DEPTH 32
+
+// Everything compiled field specs point into: regex patterns and nested-spec
+// programs. Keep it alive, and stop compiling into it, while the specs are used.
+struct SpecStore {
+    struct SatyaPatternCache* patterns;
+    struct Instr* code;
+    size_t code_len;
+    size_t code_cap;
+};
+
+static void spec_store_clear(struct SpecStore* store) {
+    satya_pattern_cache_free(store->patterns);
+    for (size_t i = 0; i < store->code_len; i++) {
+        if (store->code[i].op == OP_KEY) Py_XDECREF(store->code[i].leaf.field_name_obj);
+        Py_XDECREF(store->code[i].allowed);
+    }
+    free(store->code);
+    memset(store, 0, sizeof(*store));
+}
+
+// Compiled form of the regex in `source` (a str) from *patterns, which is
+// created on first use. Returns NULL with an exception set on error.
+static const struct SatyaPattern* resolve_pattern(PyObject* source, struct SatyaPatternCache** patterns) {
+    static const char* const reasons[] = {
+        [SATYA_PATTERN_INVALID] = "invalid pattern",
+        [SATYA_PATTERN_UNSUPPORTED] = "unsupported pattern syntax (backreferences, lookaround, \\b, inner anchors)",
+        [SATYA_PATTERN_TOO_COMPLEX] = "pattern too complex",
+    };
+    if (!PyUnicode_Check(source)) {
+        PyErr_SetString(PyExc_TypeError, "pattern spec must be ('pattern', str)");
         return NULL;
     }
-    
-    Py_ssize_t count = PyList_Size(items_list);
-    if (count == 0) {
-        return Py_BuildValue("([]i)", 0);
+    Py_ssize_t len = 0;
+    const char* src = PyUnicode_AsUTF8AndSize(source, &len);
+    if (!src) return NULL;
+    if (!*patterns && !(*patterns = satya_pattern_cache_new())) {
+        PyErr_NoMemory();
+        return NULL;
     }
-    
-    // Pre-process field specs (convert strings to enums ONCE!)
-    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
-    struct FieldSpec* field_specs = malloc(num_fields * sizeof(struct FieldSpec));
-    if (!field_specs) {
-        return PyErr_NoMemory();
+
+    int32_t status = SATYA_PATTERN_OK;
+    const struct SatyaPattern* pattern = satya_pattern_cache_get(*patterns, src, (size_t)len, &status);
+    if (!pattern) {
+        if (status == SATYA_PATTERN_INVALID || status == SATYA_PATTERN_UNSUPPORTED || status == SATYA_PATTERN_TOO_COMPLEX) {
+            PyErr_Format(PyExc_ValueError, "%s: %R", reasons[status], source);
+        } else {
+            PyErr_NoMemory();
+        }
     }
-    
+    return pattern;
+}
+
+// Opcode of a nested spec type name, or -1 for leaf validators
+static int nested_op(const char* type_str) {
+    if (strcmp(type_str, "object") == 0) return OP_OBJECT;
+    if (strcmp(type_str, "list") == 0) return OP_LIST;
+    if (strcmp(type_str, "one_of") == 0) return OP_ONE_OF;
+    if (strcmp(type_str, "optional") == 0 || strcmp(type_str, "nullable") == 0 ||
+        strcmp(type_str, "default") == 0) {
+        return OP_NULLABLE;
+    }
+    return -1;
+}
+
+// ('optional', ...) and ('default', ...) specs also accept a missing key;
+// ('nullable', ...) only accepts None
+static int spec_missing_ok(PyObject* spec) {
+    if (!PyTuple_Check(spec) || PyTuple_GET_SIZE(spec) < 1 || !PyUnicode_Check(PyTuple_GET_ITEM(spec, 0))) {
+        return 0;
+    }
+    PyObject* type = PyTuple_GET_ITEM(spec, 0);
+    return PyUnicode_CompareWithASCIIString(type, "optional") == 0 ||
+           PyUnicode_CompareWithASCIIString(type, "default") == 0;
+}
+
+static Py_ssize_t compile_program(PyObject* spec, struct SpecStore* store, int depth);
+
+// Parse a (type, param1, param2) tuple into fs; missing params are 0 and
+// unknown types are a ValueError. ('pattern', regex) and nested specs are
+// compiled into *store; with store == NULL they become VAL_UNKNOWN.
+// fs->program of a VAL_NESTED spec is only set by compile_field_specs.
+// Returns -1 with an exception set on error.
+static int parse_spec(PyObject* spec, struct FieldSpec* fs, struct SpecStore* store) {
+    fs->validator_type = VAL_UNKNOWN;
+    fs->param1 = 0;
+    fs->param2 = 0;
+    fs->fparam1 = 0.0;
+    fs->fparam2 = 0.0;
+    fs->pattern = NULL;
+    fs->program = NULL;
+    fs->program_pc = -1;
+    fs->missing_ok = 0;
+    if (!PyTuple_Check(spec) || PyTuple_GET_SIZE(spec) < 1) {
+        PyErr_Format(PyExc_TypeError, "field specs must be (type, *params) tuples, got %R", spec);
+        return -1;
+    }
+
+    const char* type_str = PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec, 0));
+    if (!type_str) {
+        return -1;
+    }
+    if (nested_op(type_str) >= 0) {
+        if (!store) return 0;
+        fs->program_pc = compile_program(spec, store, 0);
+        if (fs->program_pc < 0) return -1;
+        fs->validator_type = VAL_NESTED;
+        fs->missing_ok = spec_missing_ok(spec);
+        return 0;
+    }
+    fs->validator_type = parse_validator_type(type_str);
+    if (fs->validator_type == VAL_UNKNOWN) {
+        PyErr_Format(PyExc_ValueError, "unknown validator type '%s'", type_str);
+        return -1;
+    }
+
+    if (is_float_validator(fs->validator_type)) {
+        fs->fparam1 = fs->validator_type == VAL_FLOAT ? -INFINITY : 0.0;
+        fs->fparam2 = INFINITY;
+        if (PyTuple_GET_SIZE(spec) >= 2) {
+            fs->fparam1 = PyFloat_AsDouble(PyTuple_GET_ITEM(spec, 1));
+        }
+        if (PyTuple_GET_SIZE(spec) >= 3) {
+            fs->fparam2 = PyFloat_AsDouble(PyTuple_GET_ITEM(spec, 2));
+        }
+        return PyErr_Occurred() ? -1 : 0;
+    }
+
+    if (fs->validator_type == VAL_PATTERN) {
+        if (PyTuple_GET_SIZE(spec) != 2) {
+            PyErr_SetString(PyExc_ValueError, "pattern spec must be ('pattern', str)");
+            return -1;
+        }
+        if (!store) {
+            fs->validator_type = VAL_UNKNOWN;
+            return 0;
+        }
+        fs->pattern = resolve_pattern(PyTuple_GET_ITEM(spec, 1), &store->patterns);
+        return fs->pattern ? 0 : -1;
+    }
+
+    if (PyTuple_GET_SIZE(spec) >= 2) {
+        fs->param1 = PyLong_AsLong(PyTuple_GET_ITEM(spec, 1));
+    }
+    if (PyTuple_GET_SIZE(spec) >= 3) {
+        fs->param2 = PyLong_AsLong(PyTuple_GET_ITEM(spec, 2));
+    }
+    return PyErr_Occurred() ? -1 : 0;
+}
+
+// Resolve a field_specs dict into a FieldSpec array (strings -> enums, params -> longs).
+// If intern_keys is set, keys are interned and the array holds a strong reference
+// to each of them; otherwise keys are borrowed from field_specs_dict.
+// Patterns and nested programs are compiled into *store (zero-initialized by
+// the caller, who clears it, also on error, and keeps it alive as long as field_specs).
+// Returns the number of fields, or -1 with an exception set.
+static Py_ssize_t compile_field_specs(PyObject* field_specs_dict, struct FieldSpec* field_specs, int intern_keys,
+                                      struct SpecStore* store) {
     PyObject *field_name, *spec;
     Py_ssize_t pos = 0;
     Py_ssize_t field_idx = 0;
-    
+
     while (PyDict_Next(field_specs_dict, &pos, &field_name, &spec)) {
-        field_specs[field_idx].field_name_obj = field_name;  // Cache PyObject* (borrowed ref)
-        field_specs[field_idx].field_name = PyUnicode_AsUTF8(field_name);
-        
-        if (PyTuple_Check(spec) && PyTuple_Size(spec) >= 1) {
-            const char* type_str = PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec, 0));
-            field_specs[field_idx].validator_type = parse_validator_type(type_str);
-            
-            // Extract params (do this once, not per item!)
-            field_specs[field_idx].param1 = 0;
-            field_specs[field_idx].param2 = 0;
-            if (PyTuple_Size(spec) >= 2) {
-                field_specs[field_idx].param1 = PyLong_AsLong(PyTuple_GET_ITEM(spec, 1));
-            }
-            if (PyTuple_Size(spec) >= 3) {
-                field_specs[field_idx].param2 = PyLong_AsLong(PyTuple_GET_ITEM(spec, 2));
-            }
-        } else {
-            field_specs[field_idx].validator_type = VAL_UNKNOWN;
+        if (!PyUnicode_Check(field_name)) {
+            PyErr_SetString(PyExc_TypeError, "field_specs keys must be str");
+            goto fail;
+        }
+
+        struct FieldSpec* fs = &field_specs[field_idx];
+        if (intern_keys) {
+            Py_INCREF(field_name);
+            PyUnicode_InternInPlace(&field_name);
         }
+        fs->field_name_obj = field_name;
         field_idx++;
+
+        fs->field_hash = PyObject_Hash(field_name);
+        fs->field_name = PyUnicode_AsUTF8(field_name);
+        if (fs->field_hash == -1 || !fs->field_name) {
+            goto fail;
+        }
+
+        // Extract type and params (do this once, not per item!)
+        if (parse_spec(spec, fs, store) < 0) {
+            goto fail;
+        }
     }
-    
-    // Allocate results array
-    unsigned char* results = malloc(count * sizeof(unsigned char));
-    if (!results) {
-        free(field_specs);
-        return PyErr_NoMemory();
+
+    // store->code only stops moving once every spec is compiled
+    for (Py_ssize_t f = 0; f < field_idx; f++) {
+        if (field_specs[f].validator_type == VAL_NESTED) {
+            field_specs[f].program = store->code + field_specs[f].program_pc;
+        }
     }
-    
-    // Initialize all as valid
-    for (Py_ssize_t i = 0; i < count; i++) {
-        results[i] = 1;
+    return field_idx;
+
+fail:
+    if (intern_keys) {
+        for (Py_ssize_t f = 0; f < field_idx; f++) {
+            Py_DECREF(field_specs[f].field_name_obj);
+        }
     }
-    
-    size_t valid_count = count;
-    
-    // Iterate through each item and validate all fields (OPTIMIZED with enum dispatch)
-    for (Py_ssize_t i = 0; i < count; i++) {
-        PyObject* item = PyList_GET_ITEM(items_list, i);  // Borrowed ref
-        
-        // Prefetch next item for better cache performance
-        if (i + 1 < count) {
-            __builtin_prefetch(PyList_GET_ITEM(items_list, i + 1), 0, 3);
+    return -1;
+}
+
+// ============================================================================
+// str -> UTF-8 without PyUnicode_AsUTF8, which caches a UTF-8 copy on every
+// non-ASCII str it sees (for the lifetime of the object)
+// ============================================================================
+
+// Bytes needed to encode a non-compact-ASCII str as UTF-8
+static inline size_t utf8_bound(PyObject* str) {
+    int kind = PyUnicode_KIND(str);
+    size_t per_char = kind == PyUnicode_1BYTE_KIND ? 2 : kind == PyUnicode_2BYTE_KIND ? 3 : 4;
+    return (size_t)PyUnicode_GET_LENGTH(str) * per_char;
+}
+
+// Encode from the UCS1/2/4 data; -1 for lone surrogates (not valid UTF-8)
+static Py_ssize_t encode_utf8(PyObject* str, char* out) {
+    int kind = PyUnicode_KIND(str);
+    const void* data = PyUnicode_DATA(str);
+    Py_ssize_t n = PyUnicode_GET_LENGTH(str);
+    unsigned char* p = (unsigned char*)out;
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_UCS4 ch = PyUnicode_READ(kind, data, i);
+        if (ch < 0x80) {
+            *p++ = (unsigned char)ch;
+        } else if (ch < 0x800) {
+            *p++ = (unsigned char)(0xC0 | (ch >> 6));
+            *p++ = (unsigned char)(0x80 | (ch & 0x3F));
+        } else if (ch < 0x10000) {
+            if (ch >= 0xD800 && ch <= 0xDFFF) return -1;
+            *p++ = (unsigned char)(0xE0 | (ch >> 12));
+            *p++ = (unsigned char)(0x80 | ((ch >> 6) & 0x3F));
+            *p++ = (unsigned char)(0x80 | (ch & 0x3F));
+        } else {
+            *p++ = (unsigned char)(0xF0 | (ch >> 18));
+            *p++ = (unsigned char)(0x80 | ((ch >> 12) & 0x3F));
+            *p++ = (unsigned char)(0x80 | ((ch >> 6) & 0x3F));
+            *p++ = (unsigned char)(0x80 | (ch & 0x3F));
         }
-        
-        // Fast dict check with branch prediction hint (usually true)
-        if (__builtin_expect(!PyDict_Check(item), 0)) {
-            free(field_specs);
-            free(results);
-            PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
-            return NULL;
+    }
+    return (Py_ssize_t)(p - (unsigned char*)out);
+}
+
+// UTF-8 bytes of `str`. Compact ASCII data is already UTF-8 and is used in
+// place (valid while `str` is alive); anything else is encoded into `buf`
+// (at least utf8_bound(str) bytes). Returns NULL for strings that cannot be
+// encoded, with an exception set only on errors (not for lone surrogates).
+static const char* str_utf8(PyObject* str, Py_ssize_t* len, char* buf) {
+#if PY_VERSION_HEX < 0x030C0000
+    if (PyUnicode_READY(str) < 0) return NULL;
+#endif
+    if (PyUnicode_IS_COMPACT_ASCII(str)) {
+        *len = PyUnicode_GET_LENGTH(str);
+        return (const char*)PyUnicode_DATA(str);
+    }
+    *len = encode_utf8(str, buf);
+    return *len < 0 ? NULL : buf;
+}
+
+// Non-moving bump allocator for the UTF-8 copies of one batch
+struct ScratchBlock {
+    struct ScratchBlock* next;
+    size_t used;
+    size_t cap;
+    char data[];
+};
+
+static char* scratch_alloc(struct ScratchBlock** head, size_t n) {
+    struct ScratchBlock* block = *head;
+    if (!block || block->cap - block->used < n) {
+        size_t cap = n > 65536 ? n : 65536;
+        block = malloc(sizeof(struct ScratchBlock) + cap);
+        if (!block) return NULL;
+        block->next = *head;
+        block->used = 0;
+        block->cap = cap;
+        *head = block;
+    }
+    char* p = block->data + block->used;
+    block->used += n;
+    return p;
+}
+
+static void scratch_free(struct ScratchBlock* head) {
+    while (head) {
+        struct ScratchBlock* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+static inline int is_int_validator(enum ValidatorType type) {
+    return type <= VAL_INT_MULTIPLE_OF;
+}
+
+// Same checks as checkInt in src/column_validator.zig; kept here so int
+// fields are compared inline instead of through a libsatya call
+static inline int check_int(enum ValidatorType type, long long value, long param1, long param2) {
+    switch (type) {
+        case VAL_INT:              return value >= param1 && value <= param2;
+        case VAL_INT_GT:           return value > param1;
+        case VAL_INT_GTE:          return value >= param1;
+        case VAL_INT_LT:           return value < param1;
+        case VAL_INT_LTE:          return value <= param1;
+        case VAL_INT_POSITIVE:     return value > 0;
+        case VAL_INT_NON_NEGATIVE: return value >= 0;
+        case VAL_INT_MULTIPLE_OF:  return param1 != 0 && (param1 == -1 || value % param1 == 0);
+        default:                   return 1;
+    }
+}
+
+// Float fields take exact floats and ints (not bools or subclasses); ints too
+// large for a double are invalid. Returns 1 with the value in *out, else 0.
+static inline int float_value(PyObject* value, double* out) {
+    if (PyFloat_CheckExact(value)) {
+        *out = PyFloat_AS_DOUBLE(value);
+        return 1;
+    }
+    if (!PyLong_CheckExact(value)) {
+        return 0;
+    }
+    *out = PyLong_AsDouble(value);
+    if (*out == -1.0 && PyErr_Occurred()) {
+        PyErr_Clear();
+        return 0;
+    }
+    return 1;
+}
+
+// value / divisor within 1e-9 (relative) of an integer, so 0.3 is a multiple of 0.1
+static inline int is_float_multiple(double value, double divisor) {
+    if (divisor == 0.0 || !isfinite(value)) return 0;
+    double q = value / divisor;
+    if (!isfinite(q)) return 0;
+    double aq = q < 0 ? -q : q;
+    if (aq >= 4503599627370496.0) return 1;  // 2^52: every double this large is an integer
+    double diff = q - (double)(long long)(q + (q < 0 ? -0.5 : 0.5));
+    return (diff < 0 ? -diff : diff) <= 1e-9 * (aq > 1.0 ? aq : 1.0);
+}
+
+// Float counterpart of check_int (satya_validate_float_gt / _finite semantics);
+// NaN fails every bound
+static inline int check_float(enum ValidatorType type, double value, double param1, double param2) {
+    switch (type) {
+        case VAL_FLOAT:             return value >= param1 && value <= param2;
+        case VAL_FLOAT_GT:          return value > param1;
+        case VAL_FLOAT_GTE:         return value >= param1;
+        case VAL_FLOAT_LT:          return value < param1;
+        case VAL_FLOAT_LTE:         return value <= param1;
+        case VAL_FLOAT_FINITE:      return isfinite(value);
+        case VAL_FLOAT_MULTIPLE_OF: return is_float_multiple(value, param1);
+        default:                    return 1;
+    }
+}
+
+// Check a str value against a string validator; *len gets its UTF-8 length.
+// Returns 1 if valid, 0 if invalid, -1 if it could not be encoded (no exception left set).
+static int check_string_value(const struct FieldSpec* fs, PyObject* value, Py_ssize_t* len) {
+    // Non-ASCII text is encoded on the stack (heap when long), never cached on the str
+    char local[256];
+    char* heap = NULL;
+    char* buf = local;
+    if (!PyUnicode_IS_COMPACT_ASCII(value) && utf8_bound(value) > sizeof(local)) {
+        buf = heap = malloc(utf8_bound(value));
+        if (!heap) return -1;
+    }
+    *len = 0;
+    const char* data = str_utf8(value, len, buf);
+    int is_valid = -1;
+    if (!data) {
+        PyErr_Clear();
+    } else if (fs->validator_type == VAL_PATTERN) {
+        is_valid = satya_pattern_match(fs->pattern, data, (size_t)*len);
+    } else {
+        is_valid = satya_check_string((uint8_t)fs->validator_type, data, (size_t)*len, fs->param1, fs->param2);
+    }
+    free(heap);
+    return is_valid;
+}
+
+static int run_program(const struct Instr* in, PyObject* value);
+
+// Check a present value against one field spec: 1 if valid, 0 if not, -1 with
+// an exception set when a nested lookup raised.
+// Ints must be exact int objects (not bools or subclasses) that fit in 64
+// bits and strings must be str, as in the columnar path.
+static int check_value(const struct FieldSpec* fs, PyObject* value) {
+    if (fs->validator_type == VAL_UNKNOWN) {
+        return 1;  // Skip unknown validators
+    }
+    if (fs->validator_type == VAL_NESTED) {
+        return run_program(fs->program, value);
+    }
+    if (is_int_validator(fs->validator_type)) {
+        int overflow = 0;
+        long long v = PyLong_CheckExact(value) ? PyLong_AsLongLongAndOverflow(value, &overflow) : 0;
+        return PyLong_CheckExact(value) && !overflow && check_int(fs->validator_type, v, fs->param1, fs->param2);
+    }
+    if (is_float_validator(fs->validator_type)) {
+        double v;
+        return float_value(value, &v) && check_float(fs->validator_type, v, fs->fparam1, fs->fparam2);
+    }
+    if (fs->validator_type == VAL_BOOL) {
+        return value == Py_True || value == Py_False;
+    }
+    if (!PyUnicode_Check(value)) {
+        return 0;
+    }
+    Py_ssize_t len;
+    return check_string_value(fs, value, &len) == 1;
+}
+
+// Run the block at `in` against `value`: 1 if valid, 0 if not, -1 on error
+static int run_program(const struct Instr* in, PyObject* value) {
+    switch (in->op) {
+        case OP_CHECK:
+            return check_value(&in->leaf, value);
+        case OP_NULLABLE:
+            return value == Py_None || run_program(in + 1, value);
+        case OP_ONE_OF: {
+            int found = PySet_Contains(in->allowed, value);
+            if (found < 0) PyErr_Clear();  // Unhashable values are never allowed
+            return found == 1;
         }
-        
-        // Iterate through pre-parsed field specs (ULTRA-FAST: use cached PyObject*)
-        for (Py_ssize_t f = 0; f < num_fields; f++) {
-            // Use PyDict_GetItem with cached PyObject* - FASTEST (borrowed ref, no refcount overhead)
-            PyObject* field_value = PyDict_GetItem(item, field_specs[f].field_name_obj);
-            
-            if (!field_value) {
-                // Missing field
-                if (results[i] == 1) {
-                    results[i] = 0;
-                    valid_count--;
-                }
-                break;  // Missing field, skip remaining validations
+        case OP_LIST: {
+            if (!PyList_Check(value)) return 0;
+            Py_ssize_t n = PyList_GET_SIZE(value);
+            if (n < in->leaf.param1 || n > in->leaf.param2) return 0;
+            for (Py_ssize_t i = 0; i < n; i++) {
+                int ok = run_program(in + 1, PyList_GET_ITEM(value, i));
+                if (ok != 1) return ok;
             }
-            
-            // Fast dispatch using switch/case (NO string comparisons!)
-            int is_valid = 1;
-            
-            switch (field_specs[f].validator_type) {
-                case VAL_INT: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int(value, field_specs[f].param1, field_specs[f].param2);
-                    break;
-                }
-                case VAL_INT_GT: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_gt(value, field_specs[f].param1);
-                    break;
-                }
-                case VAL_INT_GTE: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_gte(value, field_specs[f].param1);
-                    break;
-                }
-                case VAL_INT_LT: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_lt(value, field_specs[f].param1);
-                    break;
-                }
-                case VAL_INT_LTE: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_lte(value, field_specs[f].param1);
-                    break;
-                }
-                case VAL_INT_POSITIVE: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_positive(value);
-                    break;
-                }
-                case VAL_INT_NON_NEGATIVE: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_non_negative(value);
-                    break;
-                }
-                case VAL_INT_MULTIPLE_OF: {
-                    long value = PyLong_AsLong(field_value);
-                    is_valid = satya_validate_int_multiple_of(value, field_specs[f].param1);
-                    break;
-                }
-                case VAL_STRING: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_string_length(value, (size_t)field_specs[f].param1, (size_t)field_specs[f].param2);
-                    break;
-                }
-                case VAL_EMAIL: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_email(value);
-                    break;
-                }
-                case VAL_URL: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_url(value);
-                    break;
-                }
-                case VAL_UUID: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_uuid(value);
-                    break;
-                }
-                case VAL_IPV4: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_ipv4(value);
-                    break;
-                }
-                case VAL_BASE64: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_base64(value);
-                    break;
-                }
-                case VAL_ISO_DATE: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_iso_date(value);
-                    break;
+            return 1;
+        }
+        case OP_OBJECT: {
+            if (!PyDict_Check(value)) return 0;
+            const struct Instr* key = in + 1;
+            for (uint32_t k = 0; k < in->count; k++, key += key->size) {
+                PyObject* field = lookup_field(value, &key->leaf);
+                int ok = field ? run_program(key + 1, field) : PyErr_Occurred() ? -1 : key->missing_ok;
+                if (ok != 1) return ok;
+            }
+            return 1;
+        }
+        default:
+            return 1;
+    }
+}
+
+// Append one instruction to store->code; returns its index or -1 (MemoryError)
+static Py_ssize_t emit_instr(struct SpecStore* store, enum OpCode op) {
+    if (store->code_len == store->code_cap) {
+        size_t cap = store->code_cap ? store->code_cap * 2 : 16;
+        struct Instr* code = realloc(store->code, cap * sizeof(struct Instr));
+        if (!code) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        store->code = code;
+        store->code_cap = cap;
+    }
+    struct Instr* in = &store->code[store->code_len];
+    memset(in, 0, sizeof(*in));
+    in->op = (uint8_t)op;
+    in->leaf.validator_type = VAL_UNKNOWN;
+    return (Py_ssize_t)store->code_len++;
+}
+
+// Compile a spec (leaf or nested) into a block at the end of store->code.
+// Pointers into store->code go stale while compiling, hence indices throughout.
+// Returns the block's index, or -1 with an exception set.
+static Py_ssize_t compile_program(PyObject* spec, struct SpecStore* store, int depth) {
+    if (depth > MAX_SPEC_DEPTH) {
+        PyErr_Format(PyExc_ValueError, "field specs nest more than %d levels deep", MAX_SPEC_DEPTH);
+        return -1;
+    }
+    if (!PyTuple_Check(spec) || PyTuple_GET_SIZE(spec) < 1) {
+        PyErr_Format(PyExc_TypeError, "field specs must be (type, *params) tuples, got %R", spec);
+        return -1;
+    }
+    const char* type_str = PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec, 0));
+    if (!type_str) return -1;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(spec) - 1;
+    int op = nested_op(type_str);
+    Py_ssize_t pc = emit_instr(store, op < 0 ? OP_CHECK : (enum OpCode)op);
+    if (pc < 0) return -1;
+
+    switch (op) {
+        case -1: {
+            struct FieldSpec leaf;
+            if (parse_spec(spec, &leaf, store) < 0) return -1;
+            store->code[pc].leaf = leaf;
+            break;
+        }
+        case OP_OBJECT: {
+            PyObject* fields = nargs == 1 ? PyTuple_GET_ITEM(spec, 1) : NULL;
+            if (!fields || !PyDict_Check(fields)) {
+                PyErr_SetString(PyExc_TypeError, "object spec must be ('object', {field: spec})");
+                return -1;
+            }
+            PyObject *key, *value;
+            Py_ssize_t pos = 0;
+            while (PyDict_Next(fields, &pos, &key, &value)) {
+                if (!PyUnicode_Check(key)) {
+                    PyErr_SetString(PyExc_TypeError, "field_specs keys must be str");
+                    return -1;
                 }
-                case VAL_ISO_DATETIME: {
-                    const char* value = PyUnicode_AsUTF8(field_value);
-                    is_valid = satya_validate_iso_datetime(value);
-                    break;
+                Py_ssize_t k = emit_instr(store, OP_KEY);
+                if (k < 0) return -1;
+                struct FieldSpec* name = &store->code[k].leaf;
+                Py_INCREF(key);
+                PyUnicode_InternInPlace(&key);
+                name->field_name_obj = key;
+                name->field_hash = PyObject_Hash(key);
+                name->field_name = PyUnicode_AsUTF8(key);
+                if (name->field_hash == -1 || !name->field_name) return -1;
+                store->code[k].missing_ok = (uint8_t)spec_missing_ok(value);
+
+                if (compile_program(value, store, depth + 1) < 0) return -1;
+                store->code[k].size = (uint32_t)(store->code_len - k);
+                store->code[pc].count++;
+            }
+            break;
+        }
+        case OP_LIST: {
+            if (nargs < 1 || nargs > 3) {
+                PyErr_SetString(PyExc_TypeError, "list spec must be ('list', item_spec[, min_len[, max_len]])");
+                return -1;
+            }
+            long min_len = nargs >= 2 ? PyLong_AsLong(PyTuple_GET_ITEM(spec, 2)) : 0;
+            long max_len = nargs >= 3 ? PyLong_AsLong(PyTuple_GET_ITEM(spec, 3)) : LONG_MAX;
+            if (PyErr_Occurred()) return -1;
+            store->code[pc].leaf.param1 = min_len;
+            store->code[pc].leaf.param2 = max_len;
+            if (compile_program(PyTuple_GET_ITEM(spec, 1), store, depth + 1) < 0) return -1;
+            break;
+        }
+        case OP_ONE_OF: {
+            if (nargs != 1) {
+                PyErr_SetString(PyExc_TypeError, "one_of spec must be ('one_of', values)");
+                return -1;
+            }
+            store->code[pc].allowed = PyFrozenSet_New(PyTuple_GET_ITEM(spec, 1));
+            if (!store->code[pc].allowed) return -1;
+            break;
+        }
+        case OP_NULLABLE: {
+            int is_default = type_str[0] == 'd';
+            if (nargs != 1 + is_default) {
+                if (is_default) {
+                    PyErr_SetString(PyExc_TypeError, "default spec must be ('default', spec, value)");
+                } else {
+                    PyErr_Format(PyExc_TypeError, "%s spec must be ('%s', spec)", type_str, type_str);
                 }
-                case VAL_UNKNOWN:
-                default:
-                    is_valid = 1;  // Skip unknown validators
-                    break;
+                return -1;
             }
-            
-            // Update result if invalid (FAST: branch prediction - valid is common case)
-            if (__builtin_expect(!is_valid, 0)) {  // Hint: validation usually succeeds
-                if (results[i] == 1) {
-                    results[i] = 0;
-                    valid_count--;
+            if (compile_program(PyTuple_GET_ITEM(spec, 1), store, depth + 1) < 0) return -1;
+            store->code[pc].size = (uint32_t)(store->code_len - pc);
+            // A default that fails its own spec would only surface per item
+            if (is_default) {
+                int ok = run_program(&store->code[pc], PyTuple_GET_ITEM(spec, 2));
+                if (ok < 0) return -1;
+                if (!ok) {
+                    PyErr_Format(PyExc_ValueError, "default %R does not match its spec", PyTuple_GET_ITEM(spec, 2));
+                    return -1;
                 }
-                break;  // Already invalid, skip remaining validations
             }
+            break;
         }
     }
-    
-    // Convert results to Python list (FAST: use singleton bools, no allocations!)
-    PyObject* result_list = PyList_New(count);
-    for (Py_ssize_t i = 0; i < count; i++) {
-        PyObject* bool_obj = results[i] ? Py_True : Py_False;
-        Py_INCREF(bool_obj);  // Must incref singleton
-        PyList_SET_ITEM(result_list, i, bool_obj);
+    store->code[pc].size = (uint32_t)(store->code_len - pc);
+    return pc;
+}
+
+// Stats slot of a Python-path validator type (255 = not counted)
+static inline uint8_t stats_slot(enum ValidatorType type) {
+    if (type < VAL_UNKNOWN) return (uint8_t)type;  // Shared numbering
+    switch (type) {
+        case VAL_FLOAT: return 22;
+        case VAL_FLOAT_GT: return 23;
+        case VAL_FLOAT_GTE: return 24;
+        case VAL_FLOAT_LT: return 25;
+        case VAL_FLOAT_LTE: return 26;
+        case VAL_FLOAT_FINITE: return 27;
+        case VAL_FLOAT_MULTIPLE_OF: return 28;
+        case VAL_BOOL: return 29;
+        case VAL_NESTED: return 30;
+        default: return 255;
     }
-    
-    // Cleanup
-    free(field_specs);
-    free(results);
-    
-    // Return (results, valid_count)
-    return Py_BuildValue("(Ni)", result_list, (Py_ssize_t)valid_count);
 }
 
-// Method definitions
-static PyMethodDef DhiNativeMethods[] = {
-    {"validate_int", py_validate_int, METH_VARARGS, 
-     "Validate integer bounds (value, min, max) -> bool"},
-    {"validate_string_length", py_validate_string_length, METH_VARARGS,
-     "Validate string length (str, min_len, max_len) -> bool"},
-    {"validate_email", py_validate_email, METH_VARARGS,
-     "Validate email format (str) -> bool"},
-    {"validate_batch_direct", py_validate_batch_direct, METH_VARARGS,
-     "GENERAL batch validation: (items, field_specs) -> (list[bool], int)"},
-    {NULL, NULL, 0, NULL}
-};
+#ifdef DHI_STATS
+static inline int checked_value(const struct FieldSpec* fs, PyObject* value) {
+    uint64_t probe = satya_stats_begin();
+    int ok = check_value(fs, value);
+    satya_stats_end(stats_slot(fs->validator_type), ok == 1, probe);
+    return ok;
+}
+#else
+#define checked_value check_value
+#endif
 
-// Module definition
-static struct PyModuleDef dhi_native_module = {
-    PyModuleDef_HEAD_INIT,
-    "_dhi_native",
-    "Native Zig validators for dhi (CPython extension)",
-    -1,
-    DhiNativeMethods
+// ============================================================================
+// Per-batch result cache for repeated string values (memo=True)
+// ============================================================================
+
+#define VALUE_MEMO_SLOTS 256  // Power of two
+
+// Validators that cost more than a hash lookup (column_validator.isMemoized)
+static inline int is_memoized_type(enum ValidatorType type) {
+    switch (type) {
+        case VAL_EMAIL:
+        case VAL_URL:
+        case VAL_UUID:
+        case VAL_BASE64:
+        case VAL_ISO_DATE:
+        case VAL_ISO_DATETIME:
+        case VAL_PATTERN:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Direct-mapped by (str hash, field spec). Entries hold a reference, so a
+// value cannot be freed and its address reused while the batch runs.
+struct ValueMemo {
+    struct {
+        PyObject* value;
+        const struct FieldSpec* fs;
+        Py_hash_t hash;
+        int ok;
+    } entries[VALUE_MEMO_SLOTS];
+    size_t lookups;
+    size_t hits;
 };
 
-// Module initialization
-PyMODINIT_FUNC PyInit__dhi_native(void) {
-    return PyModule_Create(&dhi_native_module);
+// check_value through the cache: interned and repeated str objects hit on
+// identity, equal copies on hash and compare
+static int memo_check_value(struct ValueMemo* memo, const struct FieldSpec* fs, PyObject* value) {
+    if (!memo || !is_memoized_type(fs->validator_type) || !PyUnicode_CheckExact(value)) {
+        return checked_value(fs, value);
+    }
+    Py_hash_t hash = PyObject_Hash(value);  // Cached on the str after the first call
+    if (hash == -1) {
+        PyErr_Clear();
+        return checked_value(fs, value);
+    }
+    size_t slot = ((size_t)hash ^ ((uintptr_t)fs >> 4)) & (VALUE_MEMO_SLOTS - 1);
+    memo->lookups++;
+    if (memo->entries[slot].fs == fs && memo->entries[slot].hash == hash &&
+        (memo->entries[slot].value == value || PyUnicode_Compare(memo->entries[slot].value, value) == 0)) {
+        memo->hits++;
+        return memo->entries[slot].ok;
+    }
+    int ok = checked_value(fs, value);
+    Py_INCREF(value);
+    Py_XDECREF(memo->entries[slot].value);
+    memo->entries[slot].value = value;
+    memo->entries[slot].fs = fs;
+    memo->entries[slot].hash = hash;
+    memo->entries[slot].ok = ok;
+    return ok;
+}
+
+// Release the cached values and report the hit rate to the library's stats
+static void memo_finish(struct ValueMemo* memo) {
+    for (size_t k = 0; k < VALUE_MEMO_SLOTS; k++) {
+        Py_XDECREF(memo->entries[k].value);
+    }
+    if (memo->lookups) satya_stats_memo_record(memo->lookups, memo->hits);
+}
+
+// Validate one dict against pre-parsed field specs, through `memo` when set.
+// Returns 1 if valid, 0 if invalid (stops at the first failing field), -1
+// with an exception set when a lookup raised.
+static int validate_item(PyObject* item, const struct FieldSpec* field_specs, Py_ssize_t num_fields,
+                         struct ValueMemo* memo) {
+    // Iterate through pre-parsed field specs (ULTRA-FAST: use cached PyObject*)
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        const struct FieldSpec* fs = &field_specs[f];
+
+        // Known-hash lookup with cached PyObject* (borrowed ref, no refcount overhead)
+        PyObject* field_value = lookup_field(item, fs);
+        if (!field_value) {
+            if (__builtin_expect(PyErr_Occurred() != NULL, 0)) return -1;
+            if (fs->missing_ok) continue;
+            return 0;  // Missing field, skip remaining validations
+        }
+
+        // FAST: branch prediction - valid is common case
+        int ok = memo_check_value(memo, fs, field_value);
+        if (__builtin_expect(ok != 1, 0)) {
+            return ok;  // Already invalid (or an error), skip remaining validations
+        }
+    }
+    return 1;
+}
+
+// ============================================================================
+// Adaptive check order (CompiledSchema(..., adaptive=True))
+// ============================================================================
+
+// Items validated between re-sorts of a FieldOrder
+#define ADAPTIVE_REORDER_ITEMS 1024
+
+// Order in which the early-exit paths check a schema's fields. The fields
+// themselves never move, so error reports keep their field indices.
+struct FieldOrder {
+    Py_ssize_t* order;         // Field indices, most likely cheap failure first
+    uint64_t* reached;         // Per field: checks since the last re-sort (halved on each)
+    uint64_t* failed;          // Per field: items it was the first failure of
+    double* cost;              // Per field: relative cost of one check
+    double* score;             // Per field: sort key of the last re-sort
+    Py_ssize_t until_reorder;  // Items left before the next re-sort
+};
+
+// Relative cost of one check when the library keeps no counters
+static double static_check_cost(enum ValidatorType type) {
+    switch (type) {
+        case VAL_STRING: return 2.0;
+        case VAL_UUID:
+        case VAL_IPV4:
+        case VAL_ISO_DATE:
+        case VAL_CONTAINS:
+        case VAL_STARTS_WITH:
+        case VAL_ENDS_WITH: return 6.0;
+        case VAL_EMAIL:
+        case VAL_BASE64: return 10.0;
+        case VAL_URL:
+        case VAL_ISO_DATETIME: return 12.0;
+        case VAL_PATTERN: return 20.0;
+        case VAL_NESTED: return 30.0;
+        default: return 1.0;  // Int, float, bool and unchecked fields
+    }
+}
+
+// Per-check costs: ticks per check from the library's counters when every
+// field's validator has some, the static table otherwise
+static void field_order_costs(struct FieldOrder* fo, const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    struct SatyaStatsSnapshot slots[64];
+    size_t count = satya_stats_snapshot(slots, sizeof(slots) / sizeof(slots[0]));
+    int measured = count > 0;
+    for (Py_ssize_t f = 0; f < num_fields && measured; f++) {
+        uint8_t slot = stats_slot(field_specs[f].validator_type);
+        measured = slot < count && slots[slot].checks > 0 && slots[slot].cycles > 0;
+    }
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        if (measured) {
+            const struct SatyaStatsSnapshot* sn = &slots[stats_slot(field_specs[f].validator_type)];
+            fo->cost[f] = (double)sn->cycles / (double)sn->checks;
+        } else {
+            fo->cost[f] = static_check_cost(field_specs[f].validator_type);
+        }
+    }
+}
+
+// Re-sort by estimated failure rate per unit of cost (highest first), then
+// halve the counts so the order follows shifts in the data
+static void field_order_update(struct FieldOrder* fo, const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    field_order_costs(fo, field_specs, num_fields);
+    double* score = fo->score;
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        // Laplace-smoothed, so fields with few checks keep a neutral prior
+        double rate = (double)(fo->failed[f] + 1) / (double)(fo->reached[f] + 2);
+        score[f] = rate / fo->cost[f];
+        fo->reached[f] >>= 1;
+        fo->failed[f] >>= 1;
+    }
+    // Insertion sort: schemas are small, and the order is mostly sorted already
+    for (Py_ssize_t k = 1; k < num_fields; k++) {
+        Py_ssize_t f = fo->order[k];
+        Py_ssize_t j = k;
+        while (j > 0 && score[fo->order[j - 1]] < score[f]) {
+            fo->order[j] = fo->order[j - 1];
+            j--;
+        }
+        fo->order[j] = f;
+    }
+    fo->until_reorder = ADAPTIVE_REORDER_ITEMS;
+}
+
+static void field_order_free(struct FieldOrder* fo) {
+    if (!fo) return;
+    free(fo->order);
+    free(fo->reached);
+    free(fo->failed);
+    free(fo->cost);
+    free(fo->score);
+    free(fo);
+}
+
+static struct FieldOrder* field_order_new(const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    size_t n = num_fields ? (size_t)num_fields : 1;
+    struct FieldOrder* fo = calloc(1, sizeof(struct FieldOrder));
+    if (fo) {
+        fo->order = malloc(n * sizeof(Py_ssize_t));
+        fo->reached = calloc(n, sizeof(uint64_t));
+        fo->failed = calloc(n, sizeof(uint64_t));
+        fo->cost = malloc(n * sizeof(double));
+        fo->score = malloc(n * sizeof(double));
+    }
+    if (!fo || !fo->order || !fo->reached || !fo->failed || !fo->cost || !fo->score) {
+        field_order_free(fo);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (Py_ssize_t f = 0; f < num_fields; f++) fo->order[f] = f;
+    field_order_update(fo, field_specs, num_fields);  // Cheapest first to start with
+    return fo;
+}
+
+// validate_item in fo's order, counting which field stopped the item.
+// Callers hold the GIL, which also guards fo.
+static int validate_item_ordered(PyObject* item, const struct FieldSpec* field_specs, Py_ssize_t num_fields,
+                                 struct FieldOrder* fo, struct ValueMemo* memo) {
+    int is_valid = 1;
+    for (Py_ssize_t k = 0; k < num_fields; k++) {
+        Py_ssize_t f = fo->order[k];
+        const struct FieldSpec* fs = &field_specs[f];
+        fo->reached[f]++;
+
+        PyObject* field_value = lookup_field(item, fs);
+        int ok = field_value ? memo_check_value(memo, fs, field_value) : PyErr_Occurred() ? -1 : fs->missing_ok;
+        if (ok != 1) {
+            if (ok == 0) fo->failed[f]++;
+            is_valid = ok;
+            break;
+        }
+    }
+    if (--fo->until_reorder <= 0) field_order_update(fo, field_specs, num_fields);
+    return is_valid;
+}
+
+// ============================================================================
+// Collect-all-errors mode: every violation, packed struct-of-arrays
+// ============================================================================
+
+// Why a field failed; values are shared with Code in src/error_report.zig
+enum ErrorCode {
+    ERR_MISSING = 1,
+    ERR_WRONG_TYPE,
+    ERR_TOO_SMALL,         // param = bound
+    ERR_TOO_LARGE,         // param = bound
+    ERR_NOT_MULTIPLE,      // param = divisor
+    ERR_INVALID_FORMAT,
+    ERR_PATTERN_MISMATCH,
+    ERR_NOT_AN_OBJECT,     // field_index = ERROR_NO_FIELD
+    ERR_NOT_ALLOWED,       // Not one of a one_of spec's values
+    ERR_INVALID_NESTED,    // Some value inside a nested object or list failed
+    ERR_CODE_COUNT
+};
+
+#define ERROR_NO_FIELD 0xFFFF
+#define ERROR_BYTES_PER_VIOLATION 11
+
+struct Violation {
+    uint32_t item_index;
+    int32_t param;
+    uint16_t field_index;
+    uint8_t code;
+};
+
+struct ViolationList {
+    struct Violation* items;
+    size_t len;
+    size_t cap;
+};
+
+static int violation_add(struct ViolationList* list, Py_ssize_t item, Py_ssize_t field, int code, long long param) {
+    if (list->len == list->cap) {
+        size_t cap = list->cap ? list->cap * 2 : 64;
+        struct Violation* items = realloc(list->items, cap * sizeof(struct Violation));
+        if (!items) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        list->items = items;
+        list->cap = cap;
+    }
+    // Bounds outside the int32 range saturate, as in error_report.zig
+    struct Violation* v = &list->items[list->len++];
+    v->item_index = (uint32_t)item;
+    v->param = param > INT32_MAX ? INT32_MAX : param < INT32_MIN ? INT32_MIN : (int32_t)param;
+    v->field_index = (uint16_t)field;
+    v->code = (uint8_t)code;
+    return 0;
+}
+
+// Error code (and bound in *param) for an int that failed check_int
+static int int_failure(const struct FieldSpec* fs, long long value, long long* param) {
+    switch (fs->validator_type) {
+        case VAL_INT:
+            if (value < fs->param1) {
+                *param = fs->param1;
+                return ERR_TOO_SMALL;
+            }
+            *param = fs->param2;
+            return ERR_TOO_LARGE;
+        case VAL_INT_GT:
+        case VAL_INT_GTE:          *param = fs->param1; return ERR_TOO_SMALL;
+        case VAL_INT_LT:
+        case VAL_INT_LTE:          *param = fs->param1; return ERR_TOO_LARGE;
+        case VAL_INT_MULTIPLE_OF:  *param = fs->param1; return ERR_NOT_MULTIPLE;
+        default:                   return ERR_TOO_SMALL;  // positive / non_negative: bound 0
+    }
+}
+
+// Float bounds as an error param: truncated toward zero, saturating (NaN is 0)
+static long long float_param(double bound) {
+    if (bound != bound) return 0;
+    if (bound >= (double)INT32_MAX) return INT32_MAX;
+    if (bound <= (double)INT32_MIN) return INT32_MIN;
+    return (long long)bound;
+}
+
+// Error code (and bound in *param) for a float that failed check_float
+static int float_failure(const struct FieldSpec* fs, double value, long long* param) {
+    switch (fs->validator_type) {
+        case VAL_FLOAT:
+            if (value < fs->fparam1) {
+                *param = float_param(fs->fparam1);
+                return ERR_TOO_SMALL;
+            }
+            *param = float_param(fs->fparam2);
+            return ERR_TOO_LARGE;
+        case VAL_FLOAT_GT:
+        case VAL_FLOAT_GTE:          *param = float_param(fs->fparam1); return ERR_TOO_SMALL;
+        case VAL_FLOAT_LT:
+        case VAL_FLOAT_LTE:          *param = float_param(fs->fparam1); return ERR_TOO_LARGE;
+        case VAL_FLOAT_MULTIPLE_OF:  *param = float_param(fs->fparam1); return ERR_NOT_MULTIPLE;
+        default:                     return ERR_INVALID_FORMAT;  // finite: NaN or infinity
+    }
+}
+
+// Error code (and bound in *param) for a string of UTF-8 length `len` that failed its validator
+static int string_failure(const struct FieldSpec* fs, Py_ssize_t len, long long* param) {
+    switch (fs->validator_type) {
+        case VAL_STRING:
+            if (len < fs->param1) {
+                *param = fs->param1;
+                return ERR_TOO_SMALL;
+            }
+            *param = fs->param2;
+            return ERR_TOO_LARGE;
+        case VAL_PATTERN:
+            return ERR_PATTERN_MISMATCH;
+        default:
+            return ERR_INVALID_FORMAT;
+    }
+}
+
+static int program_failure(const struct Instr* in, PyObject* value, long long* param);
+
+// Error code (and bound in *param) for a present value, 0 if it is valid, or
+// -1 with an exception set when a nested lookup raised
+static int value_failure(const struct FieldSpec* fs, PyObject* value, long long* param) {
+    if (fs->validator_type == VAL_UNKNOWN) {
+        return 0;
+    }
+    if (fs->validator_type == VAL_NESTED) {
+        return program_failure(fs->program, value, param);
+    }
+    if (is_int_validator(fs->validator_type)) {
+        int overflow = 0;
+        if (!PyLong_CheckExact(value)) return ERR_WRONG_TYPE;
+        long long v = PyLong_AsLongLongAndOverflow(value, &overflow);
+        if (overflow) return overflow > 0 ? ERR_TOO_LARGE : ERR_TOO_SMALL;
+        return check_int(fs->validator_type, v, fs->param1, fs->param2) ? 0 : int_failure(fs, v, param);
+    }
+    if (is_float_validator(fs->validator_type)) {
+        double v;
+        if (!float_value(value, &v)) return ERR_WRONG_TYPE;
+        return check_float(fs->validator_type, v, fs->fparam1, fs->fparam2) ? 0 : float_failure(fs, v, param);
+    }
+    if (fs->validator_type == VAL_BOOL) {
+        return value == Py_True || value == Py_False ? 0 : ERR_WRONG_TYPE;
+    }
+    if (!PyUnicode_Check(value)) {
+        return ERR_WRONG_TYPE;
+    }
+    Py_ssize_t len;
+    int is_valid = check_string_value(fs, value, &len);
+    if (is_valid < 0) return ERR_WRONG_TYPE;  // Not encodable as UTF-8 (lone surrogates)
+    return is_valid ? 0 : string_failure(fs, len, param);
+}
+
+// Same for a nested program. Leaves (under optional / default) and list
+// bounds keep their own codes; deeper failures are ERR_INVALID_NESTED.
+static int program_failure(const struct Instr* in, PyObject* value, long long* param) {
+    int ok = run_program(in, value);
+    if (ok) {
+        return ok > 0 ? 0 : -1;
+    }
+    while (in->op == OP_NULLABLE) in++;
+    switch (in->op) {
+        case OP_CHECK:
+            return value_failure(&in->leaf, value, param);
+        case OP_ONE_OF:
+            return ERR_NOT_ALLOWED;
+        case OP_LIST: {
+            if (!PyList_Check(value)) return ERR_WRONG_TYPE;
+            Py_ssize_t n = PyList_GET_SIZE(value);
+            if (n < in->leaf.param1) {
+                *param = in->leaf.param1;
+                return ERR_TOO_SMALL;
+            }
+            if (n > in->leaf.param2) {
+                *param = in->leaf.param2;
+                return ERR_TOO_LARGE;
+            }
+            return ERR_INVALID_NESTED;
+        }
+        default:
+            return PyDict_Check(value) ? ERR_INVALID_NESTED : ERR_WRONG_TYPE;
+    }
+}
+
+// validate_item without the early exit: one violation per failing field.
+// Returns 1 if the item had none, 0 if it had some, -1 with an exception set.
+static int collect_item_errors(PyObject* item, Py_ssize_t index, const struct FieldSpec* field_specs,
+                               Py_ssize_t num_fields, struct ViolationList* out) {
+    size_t before = out->len;
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        const struct FieldSpec* fs = &field_specs[f];
+        PyObject* value = lookup_field(item, fs);
+        if (!value && PyErr_Occurred()) return -1;
+        long long param = 0;
+        int code = value ? value_failure(fs, value, &param) : fs->missing_ok ? 0 : ERR_MISSING;
+
+        if (code < 0 || (code && violation_add(out, index, f, code, param) < 0)) return -1;
+    }
+    return out->len == before;
+}
+
+// ErrorReport: the packed violations of one batch (buffer protocol over the raw bytes)
+typedef struct {
+    PyObject_HEAD
+    Py_ssize_t violations;
+    Py_ssize_t count;            // Number of items in the batch
+    Py_ssize_t valid_count;
+    unsigned char* data;         // violations * ERROR_BYTES_PER_VIOLATION bytes
+    struct SatyaErrorReport satya;  // Owner of data when it came from libsatya
+    PyObject* field_names;       // tuple[str], indexed by field_index
+} ErrorReportObject;
+
+static PyTypeObject ErrorReportType;
+
+static const char* const error_code_names[ERR_CODE_COUNT] = {
+    [0] = "unknown",
+    [ERR_MISSING] = "missing",
+    [ERR_WRONG_TYPE] = "wrong_type",
+    [ERR_TOO_SMALL] = "too_small",
+    [ERR_TOO_LARGE] = "too_large",
+    [ERR_NOT_MULTIPLE] = "not_multiple",
+    [ERR_INVALID_FORMAT] = "invalid_format",
+    [ERR_PATTERN_MISMATCH] = "pattern_mismatch",
+    [ERR_NOT_AN_OBJECT] = "not_an_object",
+    [ERR_NOT_ALLOWED] = "not_allowed",
+    [ERR_INVALID_NESTED] = "invalid_nested",
+};
+
+// Names of field_specs, for decoding field_index
+static PyObject* field_names_tuple(const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    PyObject* names = PyTuple_New(num_fields);
+    if (!names) return NULL;
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        Py_INCREF(field_specs[f].field_name_obj);
+        PyTuple_SET_ITEM(names, f, field_specs[f].field_name_obj);
+    }
+    return names;
+}
+
+static ErrorReportObject* error_report_new(const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    ErrorReportObject* report = PyObject_New(ErrorReportObject, &ErrorReportType);
+    if (!report) return NULL;
+    report->violations = report->count = report->valid_count = 0;
+    report->data = NULL;
+    memset(&report->satya, 0, sizeof(report->satya));
+    report->field_names = field_names_tuple(field_specs, num_fields);
+    if (!report->field_names) {
+        Py_DECREF(report);
+        return NULL;
+    }
+    return report;
+}
+
+// Pack `list` into report->data (same layout as error_report.zig)
+static int error_report_pack(ErrorReportObject* report, const struct ViolationList* list) {
+    size_t n = list->len;
+    report->data = malloc(n ? n * ERROR_BYTES_PER_VIOLATION : 1);
+    if (!report->data) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    unsigned char* params = report->data + 4 * n;
+    unsigned char* fields = report->data + 8 * n;
+    unsigned char* codes = report->data + 10 * n;
+    for (size_t i = 0; i < n; i++) {
+        const struct Violation* v = &list->items[i];
+        memcpy(report->data + 4 * i, &v->item_index, 4);
+        memcpy(params + 4 * i, &v->param, 4);
+        memcpy(fields + 2 * i, &v->field_index, 2);
+        codes[i] = v->code;
+    }
+    report->violations = (Py_ssize_t)n;
+    return 0;
+}
+
+static void ErrorReport_dealloc(ErrorReportObject* self) {
+    if (self->satya.data) {
+        satya_free_error_report(&self->satya);
+    } else {
+        free(self->data);
+    }
+    Py_XDECREF(self->field_names);
+    PyObject_Free(self);
+}
+
+static Py_ssize_t ErrorReport_len(ErrorReportObject* self) {
+    return self->violations;
+}
+
+static inline uint32_t report_item_index(const ErrorReportObject* self, Py_ssize_t i) {
+    uint32_t v;
+    memcpy(&v, self->data + 4 * i, 4);
+    return v;
+}
+
+// report[i] -> (item_index, field_name | None, code, param)
+static PyObject* ErrorReport_item(ErrorReportObject* self, Py_ssize_t i) {
+    if (i < 0 || i >= self->violations) {
+        PyErr_SetString(PyExc_IndexError, "error report index out of range");
+        return NULL;
+    }
+    Py_ssize_t n = self->violations;
+    int32_t param;
+    uint16_t field;
+    memcpy(&param, self->data + 4 * n + 4 * i, 4);
+    memcpy(&field, self->data + 8 * n + 2 * i, 2);
+    uint8_t code = self->data[10 * n + i];
+
+    PyObject* name = field < PyTuple_GET_SIZE(self->field_names) ? PyTuple_GET_ITEM(self->field_names, field) : Py_None;
+    return Py_BuildValue("(IOsi)", report_item_index(self, i), name,
+                         error_code_names[code < ERR_CODE_COUNT ? code : 0], (int)param);
+}
+
+static int ErrorReport_getbuffer(ErrorReportObject* self, Py_buffer* view, int flags) {
+    return PyBuffer_FillInfo(view, (PyObject*)self, self->data, self->violations * ERROR_BYTES_PER_VIOLATION, 1, flags);
+}
+
+static PyObject* ErrorReport_get_count(ErrorReportObject* self, void* closure) {
+    return PyLong_FromSsize_t(self->count);
+}
+
+static PyObject* ErrorReport_get_valid_count(ErrorReportObject* self, void* closure) {
+    return PyLong_FromSsize_t(self->valid_count);
+}
+
+static PyObject* ErrorReport_get_invalid_count(ErrorReportObject* self, void* closure) {
+    return PyLong_FromSsize_t(self->count - self->valid_count);
+}
+
+static PyObject* ErrorReport_get_field_names(ErrorReportObject* self, void* closure) {
+    Py_INCREF(self->field_names);
+    return self->field_names;
+}
+
+// errors_for(index) -> list of report entries for item `index` (binary search; entries are sorted by item)
+static PyObject* ErrorReport_errors_for(ErrorReportObject* self, PyObject* arg) {
+    Py_ssize_t index = PyLong_AsSsize_t(arg);
+    if (index == -1 && PyErr_Occurred()) return NULL;
+    PyObject* out = PyList_New(0);
+    if (!out || index < 0 || index > UINT32_MAX) return out;
+
+    Py_ssize_t lo = 0, hi = self->violations;
+    while (lo < hi) {
+        Py_ssize_t mid = lo + (hi - lo) / 2;
+        if (report_item_index(self, mid) < (uint32_t)index) lo = mid + 1;
+        else hi = mid;
+    }
+    for (Py_ssize_t i = lo; i < self->violations && report_item_index(self, i) == (uint32_t)index; i++) {
+        PyObject* entry = ErrorReport_item(self, i);
+        if (!entry || PyList_Append(out, entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(out);
+            return NULL;
+        }
+        Py_DECREF(entry);
+    }
+    return out;
+}
+
+// invalid_indices() -> list[int] of items with at least one violation
+static PyObject* ErrorReport_invalid_indices(ErrorReportObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* out = PyList_New(0);
+    if (!out) return NULL;
+    for (Py_ssize_t i = 0; i < self->violations; i++) {
+        uint32_t item = report_item_index(self, i);
+        if (i > 0 && report_item_index(self, i - 1) == item) continue;
+        PyObject* index = PyLong_FromUnsignedLong(item);
+        if (!index || PyList_Append(out, index) < 0) {
+            Py_XDECREF(index);
+            Py_DECREF(out);
+            return NULL;
+        }
+        Py_DECREF(index);
+    }
+    return out;
+}
+
+static PyObject* ErrorReport_repr(ErrorReportObject* self) {
+    return PyUnicode_FromFormat("ErrorReport(violations=%zd, valid=%zd/%zd)", self->violations, self->valid_count, self->count);
+}
+
+static PyMethodDef ErrorReport_methods[] = {
+    {"errors_for", (PyCFunction)ErrorReport_errors_for, METH_O,
+     "Entries (item_index, field, code, param) of one item"},
+    {"invalid_indices", (PyCFunction)ErrorReport_invalid_indices, METH_NOARGS,
+     "Indices of items with at least one violation"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyGetSetDef ErrorReport_getset[] = {
+    {"count", (getter)ErrorReport_get_count, NULL, "Number of items in the batch", NULL},
+    {"valid_count", (getter)ErrorReport_get_valid_count, NULL, "Number of items without violations", NULL},
+    {"invalid_count", (getter)ErrorReport_get_invalid_count, NULL, "Number of items with violations", NULL},
+    {"field_names", (getter)ErrorReport_get_field_names, NULL, "Field name of each field_index", NULL},
+    {NULL, NULL, NULL, NULL, NULL}
+};
+
+static PySequenceMethods ErrorReport_as_sequence = {
+    .sq_length = (lenfunc)ErrorReport_len,
+    .sq_item = (ssizeargfunc)ErrorReport_item,
+};
+
+static PyBufferProcs ErrorReport_as_buffer = {
+    .bf_getbuffer = (getbufferproc)ErrorReport_getbuffer,
+};
+
+static PyTypeObject ErrorReportType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.ErrorReport",
+    .tp_doc = "Every violation of a batch; the buffer holds item_index u32[n], param i32[n], "
+              "field_index u16[n], code u8[n]",
+    .tp_basicsize = sizeof(ErrorReportObject),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)ErrorReport_dealloc,
+    .tp_repr = (reprfunc)ErrorReport_repr,
+    .tp_methods = ErrorReport_methods,
+    .tp_getset = ErrorReport_getset,
+    .tp_as_sequence = &ErrorReport_as_sequence,
+    .tp_as_buffer = &ErrorReport_as_buffer,
+};
+
+// Collect every violation of a list of dicts into a new ErrorReport
+static PyObject* collect_items_errors(PyObject* items_list, const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    Py_ssize_t count = PyList_GET_SIZE(items_list);
+    if (count > UINT32_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "too many items for an error report");
+        return NULL;
+    }
+    ErrorReportObject* report = error_report_new(field_specs, num_fields);
+    if (!report) return NULL;
+
+    struct ViolationList list = {NULL, 0, 0};
+    Py_ssize_t valid_count = 0;
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject* item = PyList_GET_ITEM(items_list, i);
+        if (__builtin_expect(!PyDict_Check(item), 0)) {
+            PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
+            goto fail;
+        }
+        int is_valid = collect_item_errors(item, i, field_specs, num_fields, &list);
+        if (is_valid < 0) goto fail;
+        valid_count += is_valid;
+    }
+
+    if (error_report_pack(report, &list) < 0) goto fail;
+    free(list.items);
+    report->count = count;
+    report->valid_count = valid_count;
+    return (PyObject*)report;
+
+fail:
+    free(list.items);
+    Py_DECREF(report);
+    return NULL;
+}
+
+static PyObject* build_results_tuple(unsigned char* results, Py_ssize_t count, Py_ssize_t valid_count) {
+    // Convert results to Python list (FAST: use singleton bools, no allocations!)
+    PyObject* result_list = PyList_New(count);
+    if (!result_list) {
+        free(results);
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject* bool_obj = results[i] ? Py_True : Py_False;
+        Py_INCREF(bool_obj);  // Must incref singleton
+        PyList_SET_ITEM(result_list, i, bool_obj);
+    }
+
+    free(results);
+
+    // Return (results, valid_count)
+    return Py_BuildValue("(Nn)", result_list, valid_count);
+}
+
+// ============================================================================
+// ValidationBitmap: packed batch results (1 bit per item, buffer protocol)
+// ============================================================================
+
+typedef struct {
+    PyObject_HEAD
+    Py_ssize_t count;        // Number of items
+    Py_ssize_t valid_count;
+    unsigned char* bits;     // (count + 7) / 8 bytes, bits past count are 0
+} ValidationBitmapObject;
+
+typedef struct {
+    PyObject_HEAD
+    ValidationBitmapObject* bitmap;
+    Py_ssize_t next;
+} InvalidIndexIterObject;
+
+static PyTypeObject ValidationBitmapType;
+static PyTypeObject InvalidIndexIterType;
+
+#define BITMAP_BYTES(count) (((count) + 7) / 8)
+
+// New all-invalid bitmap for `count` items
+static ValidationBitmapObject* bitmap_new(Py_ssize_t count) {
+    ValidationBitmapObject* bm = PyObject_New(ValidationBitmapObject, &ValidationBitmapType);
+    if (!bm) return NULL;
+    bm->count = count;
+    bm->valid_count = 0;
+    bm->bits = calloc(BITMAP_BYTES(count) ? BITMAP_BYTES(count) : 1, 1);
+    if (!bm->bits) {
+        Py_DECREF(bm);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    return bm;
+}
+
+static void ValidationBitmap_dealloc(ValidationBitmapObject* self) {
+    free(self->bits);
+    PyObject_Free(self);
+}
+
+static Py_ssize_t ValidationBitmap_len(ValidationBitmapObject* self) {
+    return self->count;
+}
+
+static PyObject* ValidationBitmap_item(ValidationBitmapObject* self, Py_ssize_t i) {
+    if (i < 0 || i >= self->count) {
+        PyErr_SetString(PyExc_IndexError, "bitmap index out of range");
+        return NULL;
+    }
+    return PyBool_FromLong((self->bits[i >> 3] >> (i & 7)) & 1);
+}
+
+static int ValidationBitmap_getbuffer(ValidationBitmapObject* self, Py_buffer* view, int flags) {
+    return PyBuffer_FillInfo(view, (PyObject*)self, self->bits, BITMAP_BYTES(self->count), 1, flags);
+}
+
+static PyObject* ValidationBitmap_get_valid_count(ValidationBitmapObject* self, void* closure) {
+    return PyLong_FromSsize_t(self->valid_count);
+}
+
+static PyObject* ValidationBitmap_get_invalid_count(ValidationBitmapObject* self, void* closure) {
+    return PyLong_FromSsize_t(self->count - self->valid_count);
+}
+
+// first_invalid() -> int | None
+static PyObject* ValidationBitmap_first_invalid(ValidationBitmapObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t index = satya_bitmap_next_invalid(self->bits, (size_t)self->count, 0);
+    if (index >= (size_t)self->count) Py_RETURN_NONE;
+    return PyLong_FromSize_t(index);
+}
+
+// invalid_indices() -> iterator over indices of invalid items
+static PyObject* ValidationBitmap_invalid_indices(ValidationBitmapObject* self, PyObject* Py_UNUSED(ignored)) {
+    InvalidIndexIterObject* it = PyObject_New(InvalidIndexIterObject, &InvalidIndexIterType);
+    if (!it) return NULL;
+    Py_INCREF(self);
+    it->bitmap = self;
+    it->next = 0;
+    return (PyObject*)it;
+}
+
+// to_list() -> list[bool]
+static PyObject* ValidationBitmap_to_list(ValidationBitmapObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* result_list = PyList_New(self->count);
+    if (!result_list) return NULL;
+    for (Py_ssize_t i = 0; i < self->count; i++) {
+        PyObject* bool_obj = ((self->bits[i >> 3] >> (i & 7)) & 1) ? Py_True : Py_False;
+        Py_INCREF(bool_obj);
+        PyList_SET_ITEM(result_list, i, bool_obj);
+    }
+    return result_list;
+}
+
+static PyObject* ValidationBitmap_repr(ValidationBitmapObject* self) {
+    return PyUnicode_FromFormat("ValidationBitmap(valid=%zd/%zd)", self->valid_count, self->count);
+}
+
+static PyMethodDef ValidationBitmap_methods[] = {
+    {"first_invalid", (PyCFunction)ValidationBitmap_first_invalid, METH_NOARGS,
+     "Index of the first invalid item, or None if all are valid"},
+    {"invalid_indices", (PyCFunction)ValidationBitmap_invalid_indices, METH_NOARGS,
+     "Iterate indices of invalid items"},
+    {"to_list", (PyCFunction)ValidationBitmap_to_list, METH_NOARGS,
+     "Expand to list[bool]"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyGetSetDef ValidationBitmap_getset[] = {
+    {"valid_count", (getter)ValidationBitmap_get_valid_count, NULL, "Number of valid items", NULL},
+    {"invalid_count", (getter)ValidationBitmap_get_invalid_count, NULL, "Number of invalid items", NULL},
+    {NULL, NULL, NULL, NULL, NULL}
+};
+
+static PySequenceMethods ValidationBitmap_as_sequence = {
+    .sq_length = (lenfunc)ValidationBitmap_len,
+    .sq_item = (ssizeargfunc)ValidationBitmap_item,
+};
+
+static PyBufferProcs ValidationBitmap_as_buffer = {
+    .bf_getbuffer = (getbufferproc)ValidationBitmap_getbuffer,
+};
+
+static PyTypeObject ValidationBitmapType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.ValidationBitmap",
+    .tp_doc = "Packed batch results: bit i (LSB-first) of byte i // 8 is 1 when item i is valid",
+    .tp_basicsize = sizeof(ValidationBitmapObject),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)ValidationBitmap_dealloc,
+    .tp_repr = (reprfunc)ValidationBitmap_repr,
+    .tp_methods = ValidationBitmap_methods,
+    .tp_getset = ValidationBitmap_getset,
+    .tp_as_sequence = &ValidationBitmap_as_sequence,
+    .tp_as_buffer = &ValidationBitmap_as_buffer,
+};
+
+static void InvalidIndexIter_dealloc(InvalidIndexIterObject* self) {
+    Py_DECREF(self->bitmap);
+    PyObject_Free(self);
+}
+
+static PyObject* InvalidIndexIter_next(InvalidIndexIterObject* self) {
+    ValidationBitmapObject* bm = self->bitmap;
+    if (self->next >= bm->count) return NULL;
+    size_t index = satya_bitmap_next_invalid(bm->bits, (size_t)bm->count, (size_t)self->next);
+    if (index >= (size_t)bm->count) {
+        self->next = bm->count;
+        return NULL;
+    }
+    self->next = (Py_ssize_t)index + 1;
+    return PyLong_FromSize_t(index);
+}
+
+static PyTypeObject InvalidIndexIterType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.InvalidIndexIterator",
+    .tp_basicsize = sizeof(InvalidIndexIterObject),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)InvalidIndexIter_dealloc,
+    .tp_iter = PyObject_SelfIter,
+    .tp_iternext = (iternextfunc)InvalidIndexIter_next,
+};
+
+// Parallel mode: copy field values out of the dicts into flat columns while
+// holding the GIL, then release it and let libsatya shard the checks across
+// its worker pool. String objects are kept alive with a strong reference
+// until the GIL is re-acquired; non-ASCII strings are encoded into a scratch
+// arena instead. With `generated` set, its specialized kernel
+// runs over the columns instead (single-threaded; num_threads is ignored).
+// There is no value cache here: callers' memo requests have no effect.
+static PyObject* validate_items_parallel(PyObject* items_list, const struct FieldSpec* field_specs,
+                                         Py_ssize_t num_fields, Py_ssize_t num_threads, int as_bitmap,
+                                         const struct SatyaGeneratedSchema* generated) {
+    Py_ssize_t count = PyList_GET_SIZE(items_list);
+    Py_ssize_t num_columns = 0;
+    Py_ssize_t num_str_columns = 0;
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        if (field_specs[f].validator_type == VAL_UNKNOWN) continue;
+        num_columns++;
+        if (!is_int_validator(field_specs[f].validator_type)) num_str_columns++;
+    }
+
+    // One allocation per buffer kind; columns index into them
+    // (generated kernels also take empty batches, hence `rows`)
+    Py_ssize_t rows = count ? count : 1;
+    struct SatyaColumn* columns = calloc(num_columns ? num_columns : 1, sizeof(struct SatyaColumn));
+    unsigned char* present = malloc((num_columns ? num_columns : 1) * rows);
+    int64_t* ints = malloc(((num_columns - num_str_columns) ? (num_columns - num_str_columns) : 1) * rows * sizeof(int64_t));
+    const char** str_ptrs = malloc((num_str_columns ? num_str_columns : 1) * rows * sizeof(char*));
+    size_t* str_lens = malloc((num_str_columns ? num_str_columns : 1) * rows * sizeof(size_t));
+    PyObject** str_refs = calloc((num_str_columns ? num_str_columns : 1) * rows, sizeof(PyObject*));
+    ValidationBitmapObject* bm = as_bitmap ? bitmap_new(count) : NULL;
+    unsigned char* results = as_bitmap ? NULL : malloc(rows);
+    struct ScratchBlock* scratch = NULL;
+    PyObject* ret = NULL;
+
+    if (as_bitmap && !bm) goto done;
+    if (!columns || !present || !ints || !str_ptrs || !str_lens || !str_refs || (!as_bitmap && !results)) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    // Column c covers field_specs[field_of[c]]
+    Py_ssize_t c = 0, int_c = 0, str_c = 0;
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        enum ValidatorType type = field_specs[f].validator_type;
+        if (type == VAL_UNKNOWN) continue;
+        columns[c].kind = (uint8_t)type;
+        columns[c].param1 = field_specs[f].param1;
+        columns[c].param2 = field_specs[f].param2;
+        columns[c].pattern = field_specs[f].pattern;
+        columns[c].present = present + c * count;
+        if (is_int_validator(type)) {
+            columns[c].ints = ints + int_c++ * count;
+        } else {
+            columns[c].str_ptrs = str_ptrs + str_c * count;
+            columns[c].str_lens = str_lens + str_c * count;
+            str_c++;
+        }
+        c++;
+    }
+
+    // Extract (GIL held)
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject* item = PyList_GET_ITEM(items_list, i);
+        if (__builtin_expect(!PyDict_Check(item), 0)) {
+            PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
+            goto done;
+        }
+
+        c = 0; str_c = 0;
+        for (Py_ssize_t f = 0; f < num_fields; f++) {
+            enum ValidatorType type = field_specs[f].validator_type;
+            if (type == VAL_UNKNOWN) continue;
+            struct SatyaColumn* col = &columns[c];
+            unsigned char* is_present = (unsigned char*)col->present + i;
+            PyObject* value = lookup_field(item, &field_specs[f]);
+            if (!value && PyErr_Occurred()) goto done;
+            *is_present = 0;
+
+            if (is_int_validator(type)) {
+                int64_t* slot = (int64_t*)col->ints + i;
+                *slot = 0;
+                if (value && PyLong_CheckExact(value)) {
+                    int overflow = 0;
+                    *slot = PyLong_AsLongLongAndOverflow(value, &overflow);
+                    *is_present = !overflow;
+                }
+            } else {
+                Py_ssize_t len = 0;
+                const char* data = NULL;
+                if (value && PyUnicode_Check(value)) {
+                    char* buf = NULL;
+                    if (!PyUnicode_IS_COMPACT_ASCII(value)) {
+                        buf = scratch_alloc(&scratch, utf8_bound(value) + 1);
+                        if (!buf) {
+                            PyErr_NoMemory();
+                            goto done;
+                        }
+                    }
+                    data = str_utf8(value, &len, buf);
+                    if (!data && PyErr_Occurred()) goto done;
+                    if (data && !buf) {
+                        // Points into the str: keep it alive while the GIL is released
+                        Py_INCREF(value);
+                        str_refs[str_c * count + i] = value;
+                    }
+                    *is_present = data != NULL;
+                    if (!data) len = 0;
+                }
+                ((const char**)col->str_ptrs)[i] = data ? data : "";
+                ((size_t*)col->str_lens)[i] = (size_t)len;
+                str_c++;
+            }
+            c++;
+        }
+    }
+
+    // Validate (GIL released)
+    size_t valid_count;
+    Py_BEGIN_ALLOW_THREADS
+    if (generated) {
+        satya_generated_kernel kernel = as_bitmap ? generated->validate_bitmap : generated->validate;
+        valid_count = kernel(columns, (size_t)count, as_bitmap ? bm->bits : results);
+    } else if (as_bitmap) {
+        valid_count = satya_validate_columns_bitmap(columns, (size_t)num_columns, (size_t)count, bm->bits, (size_t)num_threads);
+    } else {
+        valid_count = satya_validate_columns(columns, (size_t)num_columns, (size_t)count, results, (size_t)num_threads);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (as_bitmap) {
+        bm->valid_count = (Py_ssize_t)valid_count;
+        ret = Py_BuildValue("(On)", (PyObject*)bm, bm->valid_count);
+    } else {
+        ret = build_results_tuple(results, count, (Py_ssize_t)valid_count);
+        results = NULL;  // Freed by build_results_tuple
+    }
+
+done:
+    if (str_refs) {
+        for (Py_ssize_t k = 0; k < num_str_columns * count; k++) {
+            Py_XDECREF(str_refs[k]);
+        }
+    }
+    free(columns);
+    free(present);
+    free(ints);
+    free(str_ptrs);
+    free(str_lens);
+    free(str_refs);
+    free(results);
+    scratch_free(scratch);
+    Py_XDECREF(bm);
+    return ret;
+}
+
+// Resolve a threads argument: 0 = module default (set_num_threads / CPU count)
+static Py_ssize_t resolve_num_threads(Py_ssize_t threads) {
+    if (threads > 0) return threads;
+    if (default_num_threads > 0) return default_num_threads;
+    return (Py_ssize_t)satya_cpu_count();
+}
+
+// Validate a list of dicts and build the (results, valid_count) result tuple,
+// where results is a list[bool] or, with as_bitmap, a ValidationBitmap.
+// threads == 1 validates in place with the GIL held; otherwise large batches
+// go through the parallel columnar path (required int / string fields only:
+// float, bool, nested and optional fields are checked here, with the GIL).
+// With an adaptive `order`, the in-place path checks fields in that order;
+// with `use_memo`, it caches string results for the batch (struct ValueMemo).
+// Both only apply to the in-place path.
+static PyObject* validate_items_list(PyObject* items_list, const struct FieldSpec* field_specs,
+                                     Py_ssize_t num_fields, Py_ssize_t threads, int as_bitmap,
+                                     struct FieldOrder* order, int use_memo) {
+    Py_ssize_t count = PyList_GET_SIZE(items_list);
+
+    int is_flat = 1;
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        if (field_specs[f].validator_type > VAL_UNKNOWN || field_specs[f].missing_ok) is_flat = 0;
+    }
+    if (threads != 1 && is_flat && count >= PARALLEL_MIN_ITEMS) {
+        return validate_items_parallel(items_list, field_specs, num_fields, resolve_num_threads(threads), as_bitmap, NULL);
+    }
+
+    // Allocate results: one byte per item, or write bits straight into the bitmap
+    ValidationBitmapObject* bm = NULL;
+    unsigned char* results = NULL;
+    if (as_bitmap) {
+        bm = bitmap_new(count);
+        if (!bm) return NULL;
+    } else {
+        results = malloc(count ? count : 1);
+        if (!results) return PyErr_NoMemory();
+    }
+
+    Py_ssize_t valid_count = 0;
+    struct ValueMemo memo_store;
+    struct ValueMemo* memo = NULL;
+    if (use_memo) {
+        memset(&memo_store, 0, sizeof(memo_store));
+        memo = &memo_store;
+    }
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        PyObject* item = PyList_GET_ITEM(items_list, i);  // Borrowed ref
+
+        // Prefetch next item for better cache performance
+        if (i + 1 < count) {
+            __builtin_prefetch(PyList_GET_ITEM(items_list, i + 1), 0, 3);
+        }
+
+        // Fast dict check with branch prediction hint (usually true)
+        if (__builtin_expect(!PyDict_Check(item), 0)) {
+            if (memo) memo_finish(memo);
+            free(results);
+            Py_XDECREF(bm);
+            PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
+            return NULL;
+        }
+
+        int is_valid = order ? validate_item_ordered(item, field_specs, num_fields, order, memo)
+                             : validate_item(item, field_specs, num_fields, memo);
+        if (__builtin_expect(is_valid < 0, 0)) {
+            if (memo) memo_finish(memo);
+            free(results);
+            Py_XDECREF(bm);
+            return NULL;
+        }
+        if (as_bitmap) {
+            bm->bits[i >> 3] |= (unsigned char)(is_valid << (i & 7));
+        } else {
+            results[i] = (unsigned char)is_valid;
+        }
+        valid_count += is_valid;
+    }
+    if (memo) memo_finish(memo);
+
+    if (as_bitmap) {
+        bm->valid_count = valid_count;
+        return Py_BuildValue("(Nn)", (PyObject*)bm, valid_count);
+    }
+    return build_results_tuple(results, count, valid_count);
+}
+
+// OPTIMIZED: validate_batch_direct with enum dispatch
+static PyObject* py_validate_batch_direct(PyObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"items", "field_specs", "threads", "bitmap", "memo", NULL};
+    PyObject* items_list;
+    PyObject* field_specs_dict;
+    Py_ssize_t threads = 1;
+    int as_bitmap = 0;
+    int use_memo = 0;
+    
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!O!|npp", kwlist,
+                                     &PyList_Type, &items_list,
+                                     &PyDict_Type, &field_specs_dict,
+                                     &threads, &as_bitmap, &use_memo)) {
+        return NULL;
+    }
+    
+    // Pre-process field specs (convert strings to enums ONCE per call), even
+    // for an empty list so bad specs always raise.
+    // Use CompiledSchema to pay this once per process instead.
+    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
+    struct FieldSpec* field_specs = malloc((num_fields ? num_fields : 1) * sizeof(struct FieldSpec));
+    if (!field_specs) {
+        return PyErr_NoMemory();
+    }
+    
+    struct SpecStore store = {0};
+    if (compile_field_specs(field_specs_dict, field_specs, 0, &store) < 0) {
+        spec_store_clear(&store);
+        free(field_specs);
+        return NULL;
+    }
+    
+    PyObject* result = validate_items_list(items_list, field_specs, num_fields, threads, as_bitmap, NULL, use_memo);
+    spec_store_clear(&store);
+    free(field_specs);
+    return result;
+}
+
+// collect_errors(items, field_specs) -> ErrorReport with every failing field of every item
+static PyObject* py_collect_errors(PyObject* self, PyObject* args) {
+    PyObject* items_list;
+    PyObject* field_specs_dict;
+    if (!PyArg_ParseTuple(args, "O!O!", &PyList_Type, &items_list, &PyDict_Type, &field_specs_dict)) {
+        return NULL;
+    }
+
+    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
+    struct FieldSpec* field_specs = malloc((num_fields ? num_fields : 1) * sizeof(struct FieldSpec));
+    if (!field_specs) {
+        return PyErr_NoMemory();
+    }
+    struct SpecStore store = {0};
+    PyObject* result = NULL;
+    if (compile_field_specs(field_specs_dict, field_specs, 0, &store) >= 0) {
+        result = collect_items_errors(items_list, field_specs, num_fields);
+    }
+    spec_store_clear(&store);
+    free(field_specs);
+    return result;
+}
+
+// set_num_threads(n): default worker count for threads=0 (0 = CPU count)
+static PyObject* py_set_num_threads(PyObject* self, PyObject* args) {
+    Py_ssize_t n;
+    if (!PyArg_ParseTuple(args, "n", &n)) {
+        return NULL;
+    }
+    if (n < 0) {
+        PyErr_SetString(PyExc_ValueError, "num_threads must be >= 0");
+        return NULL;
+    }
+    default_num_threads = n;
+    Py_RETURN_NONE;
+}
+
+// get_num_threads() -> int: worker count used for threads=0
+static PyObject* py_get_num_threads(PyObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyLong_FromSsize_t(resolve_num_threads(0));
+}
+
+// ============================================================================
+// Zero-copy columns: buffer protocol (NumPy, array.array) and Arrow layouts
+// ============================================================================
+
+// Get a C-contiguous buffer of signed integers (kind 'i') or doubles (kind 'f').
+// itemsize 0 accepts 4- or 8-byte integers. Native byte order only.
+static int get_typed_buffer(PyObject* obj, Py_buffer* view, char kind, Py_ssize_t itemsize, const char* name) {
+    if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return -1;
+    }
+
+    const char* fmt = view->format ? view->format : "B";
+    if (*fmt == '@' || *fmt == '=') fmt++;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    else if (*fmt == '<') fmt++;
+#endif
+
+    int ok = fmt[0] != '\0' && fmt[1] == '\0';
+    if (kind == 'i') {
+        ok = ok && strchr("bhilqn", fmt[0]) != NULL &&
+             (itemsize ? view->itemsize == itemsize : (view->itemsize == 4 || view->itemsize == 8));
+    } else {
+        ok = ok && fmt[0] == 'd' && view->itemsize == 8;
+    }
+
+    if (!ok) {
+        const char* expected = kind == 'f' ? "float64" : (itemsize ? "int64" : "int32 or int64");
+        PyErr_Format(PyExc_TypeError, "%s must be a contiguous %s buffer (got format '%s', itemsize %zd)",
+                     name, expected, view->format ? view->format : "B", view->itemsize);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    return 0;
+}
+
+// Get an optional Arrow validity bitmap covering count items.
+// Sets *bits to NULL (and acquires nothing) when obj is None.
+static int get_validity(PyObject* obj, Py_buffer* view, Py_ssize_t count, const unsigned char** bits) {
+    *bits = NULL;
+    if (obj == Py_None) {
+        return 0;
+    }
+    if (PyObject_GetBuffer(obj, view, PyBUF_SIMPLE) < 0) {
+        return -1;
+    }
+    if (view->len < BITMAP_BYTES(count)) {
+        PyErr_Format(PyExc_ValueError, "validity bitmap too short: need %zd bytes, got %zd",
+                     BITMAP_BYTES(count), view->len);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    *bits = view->buf;
+    return 0;
+}
+
+// Kernel output: a ValidationBitmap's bits or a malloc'd byte per item
+static unsigned char* alloc_kernel_output(Py_ssize_t count, int as_bitmap, ValidationBitmapObject** bm) {
+    *bm = NULL;
+    if (as_bitmap) {
+        *bm = bitmap_new(count);
+        return *bm ? (*bm)->bits : NULL;
+    }
+    unsigned char* results = malloc(count ? count : 1);
+    if (!results) PyErr_NoMemory();
+    return results;
+}
+
+// Build the (results, valid_count) tuple from kernel output (consumes it)
+static PyObject* finish_kernel_output(unsigned char* results, ValidationBitmapObject* bm,
+                                      Py_ssize_t count, size_t valid_count) {
+    if (bm) {
+        bm->valid_count = (Py_ssize_t)valid_count;
+        return Py_BuildValue("(Nn)", (PyObject*)bm, bm->valid_count);
+    }
+    return build_results_tuple(results, count, (Py_ssize_t)valid_count);
+}
+
+// validate_int_buffer(values, spec, validity=None, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+// values: any C-contiguous int64 buffer; spec: an int validator tuple, e.g. ('int', 18, 120)
+static PyObject* py_validate_int_buffer(PyObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"values", "spec", "validity", "bitmap", NULL};
+    PyObject *values_obj, *spec_obj, *validity_obj = Py_None;
+    int as_bitmap = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|Op", kwlist,
+                                     &values_obj, &spec_obj, &validity_obj, &as_bitmap)) {
+        return NULL;
+    }
+
+    struct FieldSpec spec;
+    if (parse_spec(spec_obj, &spec, NULL) < 0) return NULL;
+    if (!is_int_validator(spec.validator_type)) {
+        PyErr_SetString(PyExc_ValueError, "spec must be an int validator, e.g. ('int', min, max)");
+        return NULL;
+    }
+
+    Py_buffer values, validity;
+    const unsigned char* validity_bits;
+    if (get_typed_buffer(values_obj, &values, 'i', 8, "values") < 0) return NULL;
+    Py_ssize_t count = values.len / values.itemsize;
+    if (get_validity(validity_obj, &validity, count, &validity_bits) < 0) {
+        PyBuffer_Release(&values);
+        return NULL;
+    }
+
+    PyObject* ret = NULL;
+    ValidationBitmapObject* bm;
+    unsigned char* results = alloc_kernel_output(count, as_bitmap, &bm);
+    if (results) {
+        size_t valid_count;
+        Py_BEGIN_ALLOW_THREADS
+        valid_count = satya_validate_int_values((uint8_t)spec.validator_type, spec.param1, spec.param2,
+                                                values.buf, (size_t)count, validity_bits, results, as_bitmap);
+        Py_END_ALLOW_THREADS
+        ret = finish_kernel_output(results, bm, count, valid_count);
+    }
+
+    if (validity_bits) PyBuffer_Release(&validity);
+    PyBuffer_Release(&values);
+    return ret;
+}
+
+// validate_float_buffer(values, min, max, validity=None, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+// values: any C-contiguous float64 buffer; NaN is invalid
+static PyObject* py_validate_float_buffer(PyObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"values", "min", "max", "validity", "bitmap", NULL};
+    PyObject *values_obj, *validity_obj = Py_None;
+    double min, max;
+    int as_bitmap = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "Odd|Op", kwlist,
+                                     &values_obj, &min, &max, &validity_obj, &as_bitmap)) {
+        return NULL;
+    }
+
+    Py_buffer values, validity;
+    const unsigned char* validity_bits;
+    if (get_typed_buffer(values_obj, &values, 'f', 8, "values") < 0) return NULL;
+    Py_ssize_t count = values.len / values.itemsize;
+    if (get_validity(validity_obj, &validity, count, &validity_bits) < 0) {
+        PyBuffer_Release(&values);
+        return NULL;
+    }
+
+    PyObject* ret = NULL;
+    ValidationBitmapObject* bm;
+    unsigned char* results = alloc_kernel_output(count, as_bitmap, &bm);
+    if (results) {
+        size_t valid_count;
+        Py_BEGIN_ALLOW_THREADS
+        valid_count = satya_validate_float_range(values.buf, (size_t)count, min, max, validity_bits, results, as_bitmap);
+        Py_END_ALLOW_THREADS
+        ret = finish_kernel_output(results, bm, count, valid_count);
+    }
+
+    if (validity_bits) PyBuffer_Release(&validity);
+    PyBuffer_Release(&values);
+    return ret;
+}
+
+// Parse a string column spec: any string validator tuple, or
+// ('contains' | 'starts_with' | 'ends_with', needle) with a str or bytes needle,
+// or ('pattern', regex). The needle points into spec_obj and the pattern into
+// *store, which must both outlive *out.
+static int parse_string_column_spec(PyObject* spec_obj, struct SatyaStringSpec* out, struct SpecStore* store) {
+    static const struct { const char* name; enum ValidatorType type; } substring_kinds[] = {
+        {"contains", VAL_CONTAINS}, {"starts_with", VAL_STARTS_WITH}, {"ends_with", VAL_ENDS_WITH},
+    };
+    memset(out, 0, sizeof(*out));
+
+    if (PyTuple_Check(spec_obj) && PyTuple_GET_SIZE(spec_obj) >= 1 && PyUnicode_Check(PyTuple_GET_ITEM(spec_obj, 0))) {
+        const char* name = PyUnicode_AsUTF8(PyTuple_GET_ITEM(spec_obj, 0));
+        if (!name) return -1;
+        for (size_t k = 0; k < sizeof(substring_kinds) / sizeof(substring_kinds[0]); k++) {
+            if (strcmp(name, substring_kinds[k].name) != 0) continue;
+            PyObject* needle = PyTuple_GET_SIZE(spec_obj) == 2 ? PyTuple_GET_ITEM(spec_obj, 1) : NULL;
+            Py_ssize_t len = 0;
+            if (needle && PyUnicode_Check(needle)) {
+                out->needle = PyUnicode_AsUTF8AndSize(needle, &len);
+                if (!out->needle) return -1;
+            } else if (needle && PyBytes_Check(needle)) {
+                out->needle = PyBytes_AS_STRING(needle);
+                len = PyBytes_GET_SIZE(needle);
+            } else {
+                PyErr_Format(PyExc_ValueError, "spec must be ('%s', needle) with a str or bytes needle", name);
+                return -1;
+            }
+            out->kind = (uint8_t)substring_kinds[k].type;
+            out->needle_len = (size_t)len;
+            return 0;
+        }
+    }
+
+    struct FieldSpec spec;
+    if (parse_spec(spec_obj, &spec, store) < 0) return -1;
+    if (spec.validator_type >= VAL_UNKNOWN || is_int_validator(spec.validator_type)) {
+        PyErr_SetString(PyExc_ValueError, "spec must be a string validator, e.g. ('email',) or ('contains', '@')");
+        return -1;
+    }
+    out->kind = (uint8_t)spec.validator_type;
+    out->param1 = spec.param1;
+    out->param2 = spec.param2;
+    out->pattern = spec.pattern;
+    return 0;
+}
+
+// validate_string_offsets(offsets, data, spec, validity=None, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+// Arrow utf8 / large_utf8 layout: item i is data[offsets[i]:offsets[i + 1]].
+// String lengths are UTF-8 byte lengths, as in validate_batch_direct.
+// spec also takes ('contains' | 'starts_with' | 'ends_with', needle) and ('pattern', regex).
+static PyObject* py_validate_string_offsets(PyObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"offsets", "data", "spec", "validity", "bitmap", "memo", NULL};
+    PyObject *offsets_obj, *data_obj, *spec_obj, *validity_obj = Py_None;
+    int as_bitmap = 0;
+    int use_memo = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|Opp", kwlist,
+                                     &offsets_obj, &data_obj, &spec_obj, &validity_obj, &as_bitmap, &use_memo)) {
+        return NULL;
+    }
+
+    struct SatyaStringSpec spec;
+    struct SpecStore store = {0};
+    if (parse_string_column_spec(spec_obj, &spec, &store) < 0) {
+        spec_store_clear(&store);
+        return NULL;
+    }
+    spec.memo = use_memo != 0;
+
+    Py_buffer offsets, data, validity;
+    const unsigned char* validity_bits = NULL;
+    if (get_typed_buffer(offsets_obj, &offsets, 'i', 0, "offsets") < 0) {
+        spec_store_clear(&store);
+        return NULL;
+    }
+    if (PyObject_GetBuffer(data_obj, &data, PyBUF_SIMPLE) < 0) {
+        PyBuffer_Release(&offsets);
+        spec_store_clear(&store);
+        return NULL;
+    }
+
+    Py_ssize_t num_offsets = offsets.len / offsets.itemsize;
+    Py_ssize_t count = num_offsets > 0 ? num_offsets - 1 : 0;
+    PyObject* ret = NULL;
+    ValidationBitmapObject* bm = NULL;
+
+    if (get_validity(validity_obj, &validity, count, &validity_bits) < 0) goto done;
+    // The column kernels write packed results; bytes are unpacked afterwards
+    bm = bitmap_new(count);
+    if (!bm) goto done;
+
+    size_t valid_count = 0;
+    if (count > 0) {
+        const char* bytes = data.buf ? data.buf : "";
+        Py_BEGIN_ALLOW_THREADS
+        if (offsets.itemsize == 4) {
+            valid_count = satya_validate_string_column32(&spec, offsets.buf, (size_t)count, bytes, (size_t)data.len,
+                                                         validity_bits, bm->bits);
+        } else {
+            valid_count = satya_validate_string_column64(&spec, offsets.buf, (size_t)count, bytes, (size_t)data.len,
+                                                         validity_bits, bm->bits);
+        }
+        Py_END_ALLOW_THREADS
+    }
+    if (as_bitmap) {
+        ret = finish_kernel_output(NULL, bm, count, valid_count);
+        bm = NULL;
+    } else {
+        unsigned char* results = malloc(count ? count : 1);
+        if (!results) {
+            PyErr_NoMemory();
+            goto done;
+        }
+        for (Py_ssize_t i = 0; i < count; i++) {
+            results[i] = (bm->bits[i >> 3] >> (i & 7)) & 1;
+        }
+        ret = build_results_tuple(results, count, (Py_ssize_t)valid_count);
+    }
+
+done:
+    Py_XDECREF(bm);
+    if (validity_bits) PyBuffer_Release(&validity);
+    PyBuffer_Release(&data);
+    PyBuffer_Release(&offsets);
+    spec_store_clear(&store);
+    return ret;
+}
+
+// ============================================================================
+// Streaming JSON: validate raw request bodies without building Python objects
+// ============================================================================
+
+// Field specs in the layout satya_validate_json_array / satya_validate_file take (caller frees).
+// The JSON scanners only know required int / string fields; NULL with an exception set otherwise.
+static struct SatyaJsonFieldSpec* to_json_specs(const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        if (field_specs[f].validator_type > VAL_UNKNOWN || field_specs[f].missing_ok) {
+            PyErr_Format(PyExc_ValueError,
+                         "field '%s': float, bool, nested and optional specs are not supported for JSON input",
+                         field_specs[f].field_name);
+            return NULL;
+        }
+    }
+    struct SatyaJsonFieldSpec* specs = malloc((num_fields ? num_fields : 1) * sizeof(struct SatyaJsonFieldSpec));
+    if (!specs) return (struct SatyaJsonFieldSpec*)PyErr_NoMemory();
+
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        specs[f].name = field_specs[f].field_name;
+        specs[f].name_len = strlen(field_specs[f].field_name);
+        specs[f].kind = (uint8_t)field_specs[f].validator_type;
+        specs[f].param1 = field_specs[f].param1;
+        specs[f].param2 = field_specs[f].param2;
+        specs[f].pattern = field_specs[f].pattern;
+    }
+    return specs;
+}
+
+// Raise the exception for a negative satya_validate_json_array* result
+static PyObject* json_batch_error(ptrdiff_t code) {
+    if (code == -2) return PyErr_NoMemory();
+    PyErr_SetString(PyExc_ValueError, code == -3 ? "too many fields in field_specs"
+                                                 : "expected a JSON array of objects");
+    return NULL;
+}
+
+// Validate a JSON array of objects held in `data` (GIL released while scanning)
+static PyObject* validate_json_buffer(const Py_buffer* data, const struct FieldSpec* field_specs,
+                                      Py_ssize_t num_fields, int as_bitmap) {
+    struct SatyaJsonFieldSpec* specs = to_json_specs(field_specs, num_fields);
+    if (!specs) return NULL;
+    // Each element takes at least 2 bytes ("1,"), so this bounds the count
+    size_t capacity = (size_t)data->len / 2 + 1;
+    unsigned char* results = malloc(capacity);
+    if (!results) {
+        free(specs);
+        return PyErr_NoMemory();
+    }
+
+    ptrdiff_t count;
+    Py_BEGIN_ALLOW_THREADS
+    count = satya_validate_json_array(data->buf, (size_t)data->len, specs, (size_t)num_fields, results, capacity);
+    Py_END_ALLOW_THREADS
+    free(specs);
+
+    if (count < 0 || (size_t)count > capacity) {
+        free(results);
+        return json_batch_error(count < 0 ? count : -1);
+    }
+
+    Py_ssize_t valid_count = 0;
+    for (ptrdiff_t i = 0; i < count; i++) valid_count += results[i];
+
+    if (as_bitmap) {
+        ValidationBitmapObject* bm = bitmap_new(count);
+        if (!bm) {
+            free(results);
+            return NULL;
+        }
+        for (ptrdiff_t i = 0; i < count; i++) {
+            bm->bits[i >> 3] |= (unsigned char)(results[i] << (i & 7));
+        }
+        free(results);
+        bm->valid_count = valid_count;
+        return Py_BuildValue("(Nn)", (PyObject*)bm, valid_count);
+    }
+    return build_results_tuple(results, count, valid_count);
+}
+
+// Every violation of a JSON array of objects, as an ErrorReport
+static PyObject* collect_json_errors(const Py_buffer* data, const struct FieldSpec* field_specs, Py_ssize_t num_fields) {
+    struct SatyaJsonFieldSpec* specs = to_json_specs(field_specs, num_fields);
+    if (!specs) return NULL;
+    ErrorReportObject* report = error_report_new(field_specs, num_fields);
+    if (!report) {
+        free(specs);
+        return NULL;
+    }
+
+    ptrdiff_t count;
+    Py_BEGIN_ALLOW_THREADS
+    count = satya_validate_json_array_errors(data->buf, (size_t)data->len, specs, (size_t)num_fields, &report->satya);
+    Py_END_ALLOW_THREADS
+    free(specs);
+
+    if (count < 0) {
+        Py_DECREF(report);
+        return json_batch_error(count);
+    }
+    report->data = report->satya.data;
+    if (!report->data && !(report->data = malloc(1))) {  // No violations
+        Py_DECREF(report);
+        return PyErr_NoMemory();
+    }
+    report->violations = (Py_ssize_t)report->satya.violations;
+    report->count = (Py_ssize_t)report->satya.count;
+    report->valid_count = (Py_ssize_t)report->satya.valid_count;
+    return (PyObject*)report;
+}
+
+// validate_json_batch(data, field_specs, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+// data: bytes-like JSON array of objects; field_specs as in validate_batch_direct
+static PyObject* py_validate_json_batch(PyObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"data", "field_specs", "bitmap", NULL};
+    Py_buffer data;
+    PyObject* field_specs_dict;
+    int as_bitmap = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "y*O!|p", kwlist,
+                                     &data, &PyDict_Type, &field_specs_dict, &as_bitmap)) {
+        return NULL;
+    }
+
+    PyObject* ret = NULL;
+    struct SpecStore store = {0};
+    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
+    struct FieldSpec* field_specs = malloc((num_fields ? num_fields : 1) * sizeof(struct FieldSpec));
+    if (!field_specs) {
+        PyErr_NoMemory();
+    } else if (compile_field_specs(field_specs_dict, field_specs, 0, &store) >= 0) {
+        ret = validate_json_buffer(&data, field_specs, num_fields, as_bitmap);
+    }
+
+    spec_store_clear(&store);
+    free(field_specs);
+    PyBuffer_Release(&data);
+    return ret;
+}
+
+// ============================================================================
+// Files: JSON array / NDJSON validated through a read-only memory mapping
+// ============================================================================
+
+// Validate the file at `path_bytes` (from PyUnicode_FSConverter); GIL released.
+// mode: "auto", "json" or "ndjson"; NDJSON is split across `threads` threads.
+static PyObject* validate_file_path(PyObject* path_bytes, const char* mode, Py_ssize_t threads,
+                                    const struct FieldSpec* field_specs, Py_ssize_t num_fields, int as_bitmap) {
+    uint8_t file_mode;
+    if (strcmp(mode, "auto") == 0) {
+        file_mode = 0;
+    } else if (strcmp(mode, "json") == 0) {
+        file_mode = 1;
+    } else if (strcmp(mode, "ndjson") == 0) {
+        file_mode = 2;
+    } else {
+        PyErr_Format(PyExc_ValueError, "mode must be 'auto', 'json' or 'ndjson', got '%s'", mode);
+        return NULL;
+    }
+
+    struct SatyaJsonFieldSpec* specs = to_json_specs(field_specs, num_fields);
+    if (!specs) return NULL;
+
+    const char* path = PyBytes_AS_STRING(path_bytes);
+    size_t path_len = (size_t)PyBytes_GET_SIZE(path_bytes);
+    size_t num_threads = (size_t)resolve_num_threads(threads);
+    struct SatyaFileResult file_result;
+    ptrdiff_t count;
+    Py_BEGIN_ALLOW_THREADS
+    count = satya_validate_file(path, path_len, specs, (size_t)num_fields, file_mode, num_threads, &file_result);
+    Py_END_ALLOW_THREADS
+    free(specs);
+
+    if (count < 0) {
+        switch (count) {
+            case -2: return PyErr_NoMemory();
+            case -3: PyErr_SetString(PyExc_ValueError, "too many fields in field_specs"); break;
+            case -4:
+                errno = ENOENT;  // OSError picks the FileNotFoundError subclass
+                PyErr_SetFromErrnoWithFilename(PyExc_OSError, path);
+                break;
+            case -5: PyErr_Format(PyExc_OSError, "could not read '%s'", path); break;
+            default: PyErr_SetString(PyExc_ValueError, "expected a JSON array of objects"); break;
+        }
+        return NULL;
+    }
+
+    Py_ssize_t valid_count = (Py_ssize_t)file_result.valid_count;
+    PyObject* results;
+    if (as_bitmap) {
+        ValidationBitmapObject* bm = bitmap_new(count);
+        if (bm) {
+            if (count > 0) memcpy(bm->bits, file_result.bits, BITMAP_BYTES(count));
+            bm->valid_count = valid_count;
+        }
+        results = (PyObject*)bm;
+    } else {
+        results = PyList_New(count);
+        for (ptrdiff_t i = 0; results && i < count; i++) {
+            PyObject* bool_obj = (file_result.bits[i >> 3] >> (i & 7)) & 1 ? Py_True : Py_False;
+            Py_INCREF(bool_obj);
+            PyList_SET_ITEM(results, i, bool_obj);
+        }
+    }
+    satya_free_file_result(&file_result);
+
+    if (!results) return NULL;
+    return Py_BuildValue("(Nn)", results, valid_count);
+}
+
+// validate_file(path, field_specs, mode="auto", threads=0, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+static PyObject* py_validate_file(PyObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"path", "field_specs", "mode", "threads", "bitmap", NULL};
+    PyObject* path_bytes;
+    PyObject* field_specs_dict;
+    const char* mode = "auto";
+    Py_ssize_t threads = 0;
+    int as_bitmap = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&O!|snp", kwlist, PyUnicode_FSConverter, &path_bytes,
+                                     &PyDict_Type, &field_specs_dict, &mode, &threads, &as_bitmap)) {
+        return NULL;
+    }
+
+    PyObject* ret = NULL;
+    struct SpecStore store = {0};
+    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
+    struct FieldSpec* field_specs = malloc((num_fields ? num_fields : 1) * sizeof(struct FieldSpec));
+    if (!field_specs) {
+        PyErr_NoMemory();
+    } else if (compile_field_specs(field_specs_dict, field_specs, 0, &store) >= 0) {
+        ret = validate_file_path(path_bytes, mode, threads, field_specs, num_fields, as_bitmap);
+    }
+
+    spec_store_clear(&store);
+    free(field_specs);
+    Py_DECREF(path_bytes);
+    return ret;
+}
+
+// ============================================================================
+// CompiledSchema: field specs resolved once, reused across calls
+// ============================================================================
+
+typedef struct {
+    PyObject_HEAD
+    Py_ssize_t num_fields;
+    struct FieldSpec* fields;  // Owns a reference to each interned field_name_obj
+    const struct SatyaGeneratedSchema* generated;  // Set by generated_schema()
+    struct SpecStore store;    // Compiled patterns and nested programs of the fields
+    struct FieldOrder* order;  // adaptive=True: check order of validate / validate_batch
+    PyObject* field_index;     // {name: field index}, built by the first validate_changed
+} CompiledSchemaObject;
+
+static void CompiledSchema_dealloc(CompiledSchemaObject* self) {
+    if (self->fields) {
+        for (Py_ssize_t f = 0; f < self->num_fields; f++) {
+            Py_DECREF(self->fields[f].field_name_obj);
+        }
+        free(self->fields);
+    }
+    spec_store_clear(&self->store);
+    field_order_free(self->order);
+    Py_XDECREF(self->field_index);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static int CompiledSchema_init(CompiledSchemaObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"field_specs", "adaptive", NULL};
+    PyObject* field_specs_dict;
+    int adaptive = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|p", kwlist, &PyDict_Type, &field_specs_dict, &adaptive)) {
+        return -1;
+    }
+    if (self->fields) {
+        PyErr_SetString(PyExc_RuntimeError, "CompiledSchema is already initialized");
+        return -1;
+    }
+
+    Py_ssize_t num_fields = PyDict_Size(field_specs_dict);
+    struct FieldSpec* fields = malloc((num_fields ? num_fields : 1) * sizeof(struct FieldSpec));
+    if (!fields) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    struct SpecStore store = {0};
+    if (compile_field_specs(field_specs_dict, fields, 1, &store) < 0) {
+        spec_store_clear(&store);
+        free(fields);
+        return -1;
+    }
+    struct FieldOrder* order = NULL;
+    if (adaptive && !(order = field_order_new(fields, num_fields))) {
+        for (Py_ssize_t f = 0; f < num_fields; f++) {
+            Py_DECREF(fields[f].field_name_obj);
+        }
+        spec_store_clear(&store);
+        free(fields);
+        return -1;
+    }
+
+    self->order = order;
+    self->store = store;
+    self->fields = fields;
+    self->num_fields = num_fields;
+    return 0;
+}
+
+// schema.validate_batch(items, threads=1, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+static PyObject* CompiledSchema_validate_batch(CompiledSchemaObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"items", "threads", "bitmap", "memo", NULL};
+    PyObject* items_list;
+    Py_ssize_t threads = 1;
+    int as_bitmap = 0;
+    int use_memo = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|npp", kwlist, &PyList_Type, &items_list, &threads, &as_bitmap,
+                                     &use_memo)) {
+        return NULL;
+    }
+    // Generated kernels are single-threaded and uncached: threads and memo are ignored
+    if (self->generated) {
+        return validate_items_parallel(items_list, self->fields, self->num_fields, 1, as_bitmap, self->generated);
+    }
+    return validate_items_list(items_list, self->fields, self->num_fields, threads, as_bitmap, self->order, use_memo);
+}
+
+// dhi.batch.validate_batch_async, imported on the first call: dhi.batch imports
+// this module, so PyInit cannot import it
+static PyObject* validate_batch_async_impl = NULL;
+
+// schema.validate_batch_async(items, chunk=16384, threads=0, memo=False, in_flight=2) -> coroutine
+// The chunking lives in dhi.batch.validate_batch_async; this only binds self
+static PyObject* CompiledSchema_validate_batch_async(CompiledSchemaObject* self, PyObject* args, PyObject* kwds) {
+    if (!validate_batch_async_impl) {
+        PyObject* batch = PyImport_ImportModule("dhi.batch");
+        if (!batch) return NULL;
+        validate_batch_async_impl = PyObject_GetAttrString(batch, "validate_batch_async");
+        Py_DECREF(batch);
+        if (!validate_batch_async_impl) return NULL;
+    }
+
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    PyObject* bound_args = PyTuple_New(nargs + 1);
+    if (!bound_args) return NULL;
+    Py_INCREF(self);
+    PyTuple_SET_ITEM(bound_args, 0, (PyObject*)self);
+    for (Py_ssize_t i = 0; i < nargs; i++) {
+        PyObject* arg = PyTuple_GET_ITEM(args, i);
+        Py_INCREF(arg);
+        PyTuple_SET_ITEM(bound_args, i + 1, arg);
+    }
+    PyObject* coro = PyObject_Call(validate_batch_async_impl, bound_args, kwds);
+    Py_DECREF(bound_args);
+    return coro;
+}
+
+// schema.validate(item) -> bool
+static PyObject* CompiledSchema_validate(CompiledSchemaObject* self, PyObject* item) {
+    if (!PyDict_Check(item)) {
+        PyErr_SetString(PyExc_TypeError, "validate() expects a dict");
+        return NULL;
+    }
+    int is_valid = self->order ? validate_item_ordered(item, self->fields, self->num_fields, self->order, NULL)
+                               : validate_item(item, self->fields, self->num_fields, NULL);
+    if (is_valid < 0) return NULL;
+    return PyBool_FromLong(is_valid);
+}
+
+// Indices of the fields named in `changed` (an iterable of keys), ascending
+// and without repeats; keys outside the schema are skipped. Returns the count,
+// or -1 with an exception set. *out is malloc'd and owned by the caller.
+static Py_ssize_t changed_field_indices(CompiledSchemaObject* self, PyObject* changed, Py_ssize_t** out) {
+    if (!self->field_index) {
+        PyObject* index = PyDict_New();
+        if (!index) return -1;
+        for (Py_ssize_t f = 0; f < self->num_fields; f++) {
+            PyObject* value = PyLong_FromSsize_t(f);
+            if (!value || PyDict_SetItem(index, self->fields[f].field_name_obj, value) < 0) {
+                Py_XDECREF(value);
+                Py_DECREF(index);
+                return -1;
+            }
+            Py_DECREF(value);
+        }
+        self->field_index = index;
+    }
+
+    PyObject* keys = PySequence_Fast(changed, "changed must be an iterable of field names");
+    if (!keys) return -1;
+    Py_ssize_t num_keys = PySequence_Fast_GET_SIZE(keys);
+    Py_ssize_t* indices = malloc((num_keys ? num_keys : 1) * sizeof(Py_ssize_t));
+    if (!indices) {
+        Py_DECREF(keys);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    Py_ssize_t n = 0;
+    for (Py_ssize_t k = 0; k < num_keys; k++) {
+        PyObject* found = PyDict_GetItemWithError(self->field_index, PySequence_Fast_GET_ITEM(keys, k));
+        if (!found) {
+            if (PyErr_Occurred()) {
+                free(indices);
+                Py_DECREF(keys);
+                return -1;
+            }
+            continue;
+        }
+        // Insertion into the sorted prefix, dropping repeats
+        Py_ssize_t f = PyLong_AsSsize_t(found);
+        Py_ssize_t j = n;
+        while (j > 0 && indices[j - 1] > f) j--;
+        if (j > 0 && indices[j - 1] == f) continue;
+        memmove(indices + j + 1, indices + j, (size_t)(n - j) * sizeof(Py_ssize_t));
+        indices[j] = f;
+        n++;
+    }
+    Py_DECREF(keys);
+    *out = indices;
+    return n;
+}
+
+// schema.validate_changed(item, changed) -> bool: only the fields named in changed
+static PyObject* CompiledSchema_validate_changed(CompiledSchemaObject* self, PyObject* args) {
+    PyObject *item, *changed;
+    if (!PyArg_ParseTuple(args, "O!O", &PyDict_Type, &item, &changed)) {
+        return NULL;
+    }
+    Py_ssize_t* indices;
+    Py_ssize_t n = changed_field_indices(self, changed, &indices);
+    if (n < 0) return NULL;
+
+    int is_valid = 1;
+    for (Py_ssize_t k = 0; k < n && is_valid == 1; k++) {
+        const struct FieldSpec* fs = &self->fields[indices[k]];
+        PyObject* value = lookup_field(item, fs);
+        is_valid = value ? checked_value(fs, value) : PyErr_Occurred() ? -1 : fs->missing_ok;
+    }
+    free(indices);
+    if (is_valid < 0) return NULL;
+    return PyBool_FromLong(is_valid);
+}
+
+// schema.collect_changed_errors(item, changed) -> ErrorReport of one item, with
+// the violations of the fields named in changed (field indices as in collect_errors)
+static PyObject* CompiledSchema_collect_changed_errors(CompiledSchemaObject* self, PyObject* args) {
+    PyObject *item, *changed;
+    if (!PyArg_ParseTuple(args, "O!O", &PyDict_Type, &item, &changed)) {
+        return NULL;
+    }
+    Py_ssize_t* indices;
+    Py_ssize_t n = changed_field_indices(self, changed, &indices);
+    if (n < 0) return NULL;
+
+    ErrorReportObject* report = error_report_new(self->fields, self->num_fields);
+    struct ViolationList list = {NULL, 0, 0};
+    if (!report) goto fail;
+    for (Py_ssize_t k = 0; k < n; k++) {
+        const struct FieldSpec* fs = &self->fields[indices[k]];
+        PyObject* value = lookup_field(item, fs);
+        if (!value && PyErr_Occurred()) goto fail;
+        long long param = 0;
+        int code = value ? value_failure(fs, value, &param) : fs->missing_ok ? 0 : ERR_MISSING;
+        if (code < 0 || (code && violation_add(&list, 0, indices[k], code, param) < 0)) goto fail;
+    }
+    if (error_report_pack(report, &list) < 0) goto fail;
+    report->count = 1;
+    report->valid_count = list.len == 0;
+    free(list.items);
+    free(indices);
+    return (PyObject*)report;
+
+fail:
+    free(list.items);
+    free(indices);
+    Py_XDECREF(report);
+    return NULL;
+}
+
+// schema.collect_errors(items) -> ErrorReport
+static PyObject* CompiledSchema_collect_errors(CompiledSchemaObject* self, PyObject* items_list) {
+    if (!PyList_Check(items_list)) {
+        PyErr_SetString(PyExc_TypeError, "Expected list of dicts");
+        return NULL;
+    }
+    return collect_items_errors(items_list, self->fields, self->num_fields);
+}
+
+// schema.collect_json_errors(data) -> ErrorReport
+static PyObject* CompiledSchema_collect_json_errors(CompiledSchemaObject* self, PyObject* arg) {
+    Py_buffer data;
+    if (PyObject_GetBuffer(arg, &data, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    PyObject* ret = collect_json_errors(&data, self->fields, self->num_fields);
+    PyBuffer_Release(&data);
+    return ret;
+}
+
+// schema.validate_json(data, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+static PyObject* CompiledSchema_validate_json(CompiledSchemaObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"data", "bitmap", NULL};
+    Py_buffer data;
+    int as_bitmap = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "y*|p", kwlist, &data, &as_bitmap)) {
+        return NULL;
+    }
+    PyObject* ret = validate_json_buffer(&data, self->fields, self->num_fields, as_bitmap);
+    PyBuffer_Release(&data);
+    return ret;
+}
+
+// schema.validate_file(path, mode="auto", threads=0, bitmap=False) -> (list[bool] | ValidationBitmap, int)
+static PyObject* CompiledSchema_validate_file(CompiledSchemaObject* self, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"path", "mode", "threads", "bitmap", NULL};
+    PyObject* path_bytes;
+    const char* mode = "auto";
+    Py_ssize_t threads = 0;
+    int as_bitmap = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|snp", kwlist, PyUnicode_FSConverter, &path_bytes,
+                                     &mode, &threads, &as_bitmap)) {
+        return NULL;
+    }
+    PyObject* ret = validate_file_path(path_bytes, mode, threads, self->fields, self->num_fields, as_bitmap);
+    Py_DECREF(path_bytes);
+    return ret;
+}
+
+static Py_ssize_t CompiledSchema_len(CompiledSchemaObject* self) {
+    return self->num_fields;
+}
+
+// schema.check_order -> list[str]: field names in the order validate() checks them
+static PyObject* CompiledSchema_get_check_order(CompiledSchemaObject* self, void* Py_UNUSED(closure)) {
+    PyObject* names = PyList_New(self->num_fields);
+    if (!names) {
+        return NULL;
+    }
+    for (Py_ssize_t k = 0; k < self->num_fields; k++) {
+        PyObject* name = self->fields[self->order ? self->order->order[k] : k].field_name_obj;
+        Py_INCREF(name);
+        PyList_SET_ITEM(names, k, name);
+    }
+    return names;
+}
+
+static PyGetSetDef CompiledSchema_getset[] = {
+    {"check_order", (getter)CompiledSchema_get_check_order, NULL,
+     "Field names in check order (re-sorted as items are validated when adaptive=True)", NULL},
+    {NULL, NULL, NULL, NULL, NULL}
+};
+
+static PyMethodDef CompiledSchema_methods[] = {
+    {"validate_batch", (PyCFunction)(void(*)(void))CompiledSchema_validate_batch, METH_VARARGS | METH_KEYWORDS,
+     "Validate a list of dicts: (items, threads=1, bitmap=False, memo=False) -> (list[bool] | ValidationBitmap, int)\n"
+     "memo caches email/url/uuid/base64/date/pattern results of repeated strings for the batch;\n"
+     "it has no effect on the GIL-free path (threads != 1, flat fields, 4096+ items) or for generated schemas,\n"
+     "which also ignore threads"},
+    {"validate_batch_async", (PyCFunction)(void(*)(void))CompiledSchema_validate_batch_async, METH_VARARGS | METH_KEYWORDS,
+     "Awaitable validate_batch in chunks on the default executor: (items, chunk=16384, threads=0, memo=False, in_flight=2) -> (list[bool], int)"},
+    {"validate", (PyCFunction)CompiledSchema_validate, METH_O,
+     "Validate a single dict: (item) -> bool"},
+    {"validate_json", (PyCFunction)(void(*)(void))CompiledSchema_validate_json, METH_VARARGS | METH_KEYWORDS,
+     "Validate a JSON array of objects from bytes: (data, bitmap=False) -> (list[bool] | ValidationBitmap, int)"},
+    {"validate_file", (PyCFunction)(void(*)(void))CompiledSchema_validate_file, METH_VARARGS | METH_KEYWORDS,
+     "Validate a JSON array or NDJSON file via mmap: (path, mode='auto', threads=0, bitmap=False) -> (list[bool] | ValidationBitmap, int)"},
+    {"collect_errors", (PyCFunction)CompiledSchema_collect_errors, METH_O,
+     "Every failing field of every dict: (items) -> ErrorReport"},
+    {"collect_json_errors", (PyCFunction)CompiledSchema_collect_json_errors, METH_O,
+     "Every failing field of every element of a JSON array: (data) -> ErrorReport"},
+    {"validate_changed", (PyCFunction)CompiledSchema_validate_changed, METH_VARARGS,
+     "Revalidate a dict after a partial update, checking only the changed fields: (item, changed) -> bool"},
+    {"collect_changed_errors", (PyCFunction)CompiledSchema_collect_changed_errors, METH_VARARGS,
+     "Violations of the changed fields of one dict: (item, changed) -> ErrorReport"},
+    {NULL, NULL, 0, NULL}
+};
+
+static PySequenceMethods CompiledSchema_as_sequence = {
+    .sq_length = (lenfunc)CompiledSchema_len,
+};
+
+static PyTypeObject CompiledSchemaType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "dhi._dhi_native.CompiledSchema",
+    .tp_doc = "Field specs compiled once: CompiledSchema({field: (type, *params)}, adaptive=False)",
+    .tp_basicsize = sizeof(CompiledSchemaObject),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = PyType_GenericNew,
+    .tp_init = (initproc)CompiledSchema_init,
+    .tp_dealloc = (destructor)CompiledSchema_dealloc,
+    .tp_methods = CompiledSchema_methods,
+    .tp_getset = CompiledSchema_getset,
+    .tp_as_sequence = &CompiledSchema_as_sequence,
+};
+
+// generated_schema(name) -> CompiledSchema backed by the build-time kernel for `name`
+static PyObject* py_generated_schema(PyObject* self, PyObject* args) {
+    const char* name;
+    if (!PyArg_ParseTuple(args, "s", &name)) {
+        return NULL;
+    }
+
+    const struct SatyaGeneratedSchema* generated = NULL;
+    for (size_t k = 0; k < satya_generated_schema_count(); k++) {
+        const struct SatyaGeneratedSchema* candidate = satya_generated_schema(k);
+        if (strcmp(candidate->name, name) == 0) {
+            generated = candidate;
+            break;
+        }
+    }
+    if (!generated) {
+        PyErr_Format(PyExc_KeyError, "no generated schema named '%s' (build with zig build -Dschema=...)", name);
+        return NULL;
+    }
+
+    CompiledSchemaObject* schema = (CompiledSchemaObject*)CompiledSchemaType.tp_alloc(&CompiledSchemaType, 0);
+    if (!schema) {
+        return NULL;
+    }
+    Py_ssize_t num_fields = (Py_ssize_t)generated->num_fields;
+    schema->fields = malloc((num_fields ? num_fields : 1) * sizeof(struct FieldSpec));
+    if (!schema->fields) {
+        Py_DECREF(schema);
+        return PyErr_NoMemory();
+    }
+
+    // Same FieldSpec layout as CompiledSchema_init, so validate() and friends work unchanged
+    for (Py_ssize_t f = 0; f < num_fields; f++) {
+        const struct SatyaGeneratedField* gf = &generated->fields[f];
+        struct FieldSpec* fs = &schema->fields[f];
+        fs->field_name_obj = PyUnicode_InternFromString(gf->name);
+        if (!fs->field_name_obj) {
+            Py_DECREF(schema);
+            return NULL;
+        }
+        schema->num_fields = f + 1;  // dealloc releases the names created so far
+        fs->field_hash = PyObject_Hash(fs->field_name_obj);
+        fs->field_name = PyUnicode_AsUTF8(fs->field_name_obj);
+        if (fs->field_hash == -1 || !fs->field_name) {
+            Py_DECREF(schema);
+            return NULL;
+        }
+        fs->validator_type = (enum ValidatorType)gf->kind;
+        fs->param1 = (long)gf->param1;
+        fs->param2 = (long)gf->param2;
+        fs->fparam1 = 0.0;
+        fs->fparam2 = 0.0;
+        fs->pattern = NULL;
+        fs->program = NULL;
+        fs->program_pc = -1;
+        fs->missing_ok = 0;
+    }
+    schema->generated = generated;
+    return (PyObject*)schema;
+}
+
+// generated_schema_names() -> list[str]
+static PyObject* py_generated_schema_names(PyObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t count = satya_generated_schema_count();
+    PyObject* names = PyList_New((Py_ssize_t)count);
+    if (!names) {
+        return NULL;
+    }
+    for (size_t k = 0; k < count; k++) {
+        PyObject* name = PyUnicode_FromString(satya_generated_schema(k)->name);
+        if (!name) {
+            Py_DECREF(names);
+            return NULL;
+        }
+        PyList_SET_ITEM(names, (Py_ssize_t)k, name);
+    }
+    return names;
+}
+
+// stats(reset=False) -> {validator: {"checks", "failures", "cycles"}} for validators that ran,
+// plus "memo": {"lookups", "hits"} once a batch used memo=True
+static PyObject* py_stats(PyObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"reset", NULL};
+    int reset = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", kwlist, &reset)) {
+        return NULL;
+    }
+
+    struct SatyaStatsSnapshot slots[64];
+    struct SatyaMemoSnapshot memo;
+    size_t count = satya_stats_snapshot(slots, sizeof(slots) / sizeof(slots[0]));
+    satya_stats_memo(&memo);
+    if (reset) satya_stats_reset();
+
+    PyObject* result = PyDict_New();
+    if (!result) {
+        return NULL;
+    }
+    for (size_t k = 0; k < count; k++) {
+        if (slots[k].checks == 0) continue;
+        PyObject* entry = Py_BuildValue("{s:K,s:K,s:K}",
+                                        "checks", (unsigned long long)slots[k].checks,
+                                        "failures", (unsigned long long)slots[k].failures,
+                                        "cycles", (unsigned long long)slots[k].cycles);
+        if (!entry || PyDict_SetItemString(result, satya_stats_slot_name(k), entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(entry);
+    }
+    if (memo.lookups) {
+        PyObject* entry = Py_BuildValue("{s:K,s:K}", "lookups", (unsigned long long)memo.lookups,
+                                        "hits", (unsigned long long)memo.hits);
+        if (!entry || PyDict_SetItemString(result, "memo", entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(entry);
+    }
+    return result;
+}
+
+static PyObject* py_stats_enabled(PyObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyBool_FromLong(satya_stats_enabled());
+}
+
+// Method definitions
+static PyMethodDef DhiNativeMethods[] = {
+    {"validate_int", py_validate_int, METH_VARARGS, 
+     "Validate integer bounds (value, min, max) -> bool"},
+    {"validate_string_length", py_validate_string_length, METH_VARARGS,
+     "Validate string length (str, min_len, max_len) -> bool"},
+    {"validate_email", py_validate_email, METH_VARARGS,
+     "Validate email format (str) -> bool"},
+    {"validate_batch_direct", (PyCFunction)(void(*)(void))py_validate_batch_direct, METH_VARARGS | METH_KEYWORDS,
+     "GENERAL batch validation: (items, field_specs, threads=1, bitmap=False, memo=False) -> (list[bool] | ValidationBitmap, int)\n"
+     "threads=0 uses set_num_threads()/CPU count; threads != 1 releases the GIL for large batches\n"
+     "(4096+ items, flat fields), where memo has no effect"},
+    {"collect_errors", py_collect_errors, METH_VARARGS,
+     "Every failing field of every item: (items, field_specs) -> ErrorReport"},
+    {"validate_int_buffer", (PyCFunction)(void(*)(void))py_validate_int_buffer, METH_VARARGS | METH_KEYWORDS,
+     "Zero-copy int64 column: (values, spec, validity=None, bitmap=False) -> (list[bool] | ValidationBitmap, int)"},
+    {"validate_float_buffer", (PyCFunction)(void(*)(void))py_validate_float_buffer, METH_VARARGS | METH_KEYWORDS,
+     "Zero-copy float64 column: (values, min, max, validity=None, bitmap=False) -> (list[bool] | ValidationBitmap, int)"},
+    {"validate_string_offsets", (PyCFunction)(void(*)(void))py_validate_string_offsets, METH_VARARGS | METH_KEYWORDS,
+     "Zero-copy Arrow string column: (offsets, data, spec, validity=None, bitmap=False, memo=False) -> (list[bool] | ValidationBitmap, int)\n"
+     "spec is a string validator or ('contains' | 'starts_with' | 'ends_with', needle); memo caches repeated values"},
+    {"validate_json_batch", (PyCFunction)(void(*)(void))py_validate_json_batch, METH_VARARGS | METH_KEYWORDS,
+     "Streaming JSON validation: (data, field_specs, bitmap=False) -> (list[bool] | ValidationBitmap, int)\n"
+     "data is a bytes-like JSON array of objects; no Python objects are created per item"},
+    {"validate_file", (PyCFunction)(void(*)(void))py_validate_file, METH_VARARGS | METH_KEYWORDS,
+     "Memory-mapped file validation: (path, field_specs, mode='auto', threads=0, bitmap=False) -> (list[bool] | ValidationBitmap, int)\n"
+     "mode is 'auto', 'json' (one array) or 'ndjson' (split across threads at line boundaries)"},
+    {"generated_schema", py_generated_schema, METH_VARARGS,
+     "CompiledSchema for a schema specialized at build time: (name) -> CompiledSchema"},
+    {"generated_schema_names", py_generated_schema_names, METH_NOARGS,
+     "Names of the schemas specialized at build time (zig build -Dschema=...)"},
+    {"set_num_threads", py_set_num_threads, METH_VARARGS,
+     "Set default worker count for threads=0 (0 = CPU count)"},
+    {"get_num_threads", py_get_num_threads, METH_NOARGS,
+     "Worker count used for threads=0"},
+    {"stats", (PyCFunction)(void(*)(void))py_stats, METH_VARARGS | METH_KEYWORDS,
+     "Per-validator counters: (reset=False) -> {name: {'checks', 'failures', 'cycles'}, 'memo': {'lookups', 'hits'}}\n"
+     "Empty unless libsatya was built with zig build -Dstats=true"},
+    {"stats_enabled", py_stats_enabled, METH_NOARGS,
+     "Whether libsatya was built with per-validator counters"},
+    {NULL, NULL, 0, NULL}
+};
+
+// Module definition
+static struct PyModuleDef dhi_native_module = {
+    PyModuleDef_HEAD_INIT,
+    "_dhi_native",
+    "Native Zig validators for dhi (CPython extension)",
+    -1,
+    DhiNativeMethods
+};
+
+// Module initialization
+PyMODINIT_FUNC PyInit__dhi_native(void) {
+    if (PyType_Ready(&CompiledSchemaType) < 0 ||
+        PyType_Ready(&ValidationBitmapType) < 0 ||
+        PyType_Ready(&ErrorReportType) < 0 ||
+        PyType_Ready(&InvalidIndexIterType) < 0) {
+        return NULL;
+    }
+
+    PyObject* module = PyModule_Create(&dhi_native_module);
+    if (!module) {
+        return NULL;
+    }
+
+    Py_INCREF(&CompiledSchemaType);
+    if (PyModule_AddObject(module, "CompiledSchema", (PyObject*)&CompiledSchemaType) < 0) {
+        Py_DECREF(&CompiledSchemaType);
+        Py_DECREF(module);
+        return NULL;
+    }
+    Py_INCREF(&ValidationBitmapType);
+    if (PyModule_AddObject(module, "ValidationBitmap", (PyObject*)&ValidationBitmapType) < 0) {
+        Py_DECREF(&ValidationBitmapType);
+        Py_DECREF(module);
+        return NULL;
+    }
+    Py_INCREF(&ErrorReportType);
+    if (PyModule_AddObject(module, "ErrorReport", (PyObject*)&ErrorReportType) < 0) {
+        Py_DECREF(&ErrorReportType);
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
 }
@@ -21,6 +21,17 @@ try:
     lib_name = 'satya'
     lib_file = None
     lib_dir = None
+
+    # Static archive from `zig build` (satya_static): linked into the
+    # extension itself. Set DHI_LINK_SHARED=1 to use the shared library.
+    static_patterns = [f'{lib_name}_static.lib'] if sys.platform == 'win32' else [f'lib{lib_name}_static.a']
+    static_file = None
+    if not os.environ.get('DHI_LINK_SHARED'):
+        for location in lib_locations[:1]:
+            for pattern in static_patterns:
+                if (location / pattern).exists():
+                    static_file = str(location / pattern)
+                    print(f"Found static Zig library: {static_file}")
     
     # Platform-specific library extension
     if sys.platform == 'darwin':
@@ -43,7 +54,20 @@ try:
             if lib_file:
                 break
     
-    if lib_file and lib_dir:
+    # DHI_STATS=1: also count the checks done in _native.c itself (pair with
+    # a library built with `zig build -Dstats=true`)
+    define_macros = [('DHI_STATS', '1')] if os.environ.get('DHI_STATS') == '1' else []
+
+    if static_file:
+        native_ext = Extension(
+            'dhi._dhi_native',
+            sources=['dhi/_native.c'],
+            define_macros=define_macros,
+            extra_objects=[static_file],
+        )
+        ext_modules = [native_ext]
+        print("✅ Building with native Zig extension (static)")
+    elif lib_file and lib_dir:
         # Copy library to package directory for bundling
         package_lib_dir = Path(__file__).parent / "dhi"
         package_lib_dir.mkdir(exist_ok=True)
@@ -59,6 +83,7 @@ try:
         native_ext = Extension(
             'dhi._dhi_native',
             sources=['dhi/_native.c'],
+            define_macros=define_macros,
             include_dirs=[],
             library_dirs=[lib_dir],
             libraries=[lib_name],
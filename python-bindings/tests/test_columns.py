@@ -0,0 +1,152 @@
+"""
+Tests for zero-copy columnar validation (buffer protocol / Arrow layouts)
+"""
+
+from array import array
+
+import pytest
+from dhi import HAS_NATIVE_EXT
+from dhi.batch import validate_ints_batch, validate_strings_batch, validate_emails_batch
+
+pytestmark = pytest.mark.skipif(not HAS_NATIVE_EXT, reason="native extension not built")
+
+
+def _native():
+    from dhi import _dhi_native
+    return _dhi_native
+
+
+class TestIntBuffer:
+    def test_array_int64(self):
+        values = array('q', [25, 15, 40, 121])
+        results, valid_count = _native().validate_int_buffer(values, ('int', 18, 120))
+        assert results == [True, False, True, False]
+        assert valid_count == 2
+
+    def test_other_int_kinds(self):
+        values = array('q', [10, 11, 0, -5])
+        results, _ = _native().validate_int_buffer(values, ('int_multiple_of', 5))
+        assert results == [True, False, True, True]
+        results, _ = _native().validate_int_buffer(values, ('int_positive',))
+        assert results == [True, True, False, False]
+
+    def test_validity_and_bitmap(self):
+        values = array('q', [20, 30, 40])
+        bits, valid_count = _native().validate_int_buffer(
+            values, ('int', 0, 100), validity=b'\x05', bitmap=True
+        )
+        assert valid_count == 2
+        assert bits.to_list() == [True, False, True]
+
+    def test_rejects_wrong_dtype(self):
+        with pytest.raises(TypeError):
+            _native().validate_int_buffer(array('d', [1.0]), ('int', 0, 1))
+        with pytest.raises(TypeError):
+            _native().validate_int_buffer([1, 2, 3], ('int', 0, 1))
+        with pytest.raises(ValueError):
+            _native().validate_int_buffer(array('q', [1]), ('email',))
+        with pytest.raises(ValueError):
+            _native().validate_int_buffer(array('q', [1] * 9), ('int', 0, 1), validity=b'\xff')
+
+    def test_numpy(self):
+        np = pytest.importorskip("numpy")
+        values = np.arange(10_000, dtype=np.int64)
+        results, valid_count = _native().validate_int_buffer(values, ('int', 100, 199))
+        assert valid_count == 100
+        assert results[100] and not results[200]
+
+
+class TestFloatBuffer:
+    def test_range_and_nan(self):
+        values = array('d', [0.5, 1.5, float('nan'), -0.1])
+        results, valid_count = _native().validate_float_buffer(values, 0.0, 1.0)
+        assert results == [True, False, False, False]
+        assert valid_count == 1
+
+
+class TestStringOffsets:
+    DATA = b"a@b.cobadx@y.io"
+
+    def test_int32_offsets(self):
+        offsets = array('i', [0, 6, 9, 15])
+        results, valid_count = _native().validate_string_offsets(offsets, self.DATA, ('email',))
+        assert results == [True, False, True]
+        assert valid_count == 2
+
+    def test_int64_offsets_lengths(self):
+        offsets = array('q', [0, 6, 9, 15])
+        results, _ = _native().validate_string_offsets(offsets, self.DATA, ('string', 4, 10))
+        assert results == [True, False, True]
+
+    def test_nulls_and_bad_offsets(self):
+        offsets = array('i', [0, 6, 9, 99])
+        bits, valid_count = _native().validate_string_offsets(
+            offsets, self.DATA, ('email',), validity=b'\x06', bitmap=True
+        )
+        assert bits.to_list() == [False, False, False]
+        assert valid_count == 0
+
+    def test_substring_specs(self):
+        data = b"https://a.iohttp://b.ioftp://c.io"
+        offsets = array('i', [0, 12, 23, 33])
+        assert _native().validate_string_offsets(offsets, data, ('starts_with', 'https://'))[0] == [True, False, False]
+        assert _native().validate_string_offsets(offsets, data, ('ends_with', b'.io'))[1] == 3
+        bits, valid_count = _native().validate_string_offsets(offsets, data, ('contains', 'p:'), bitmap=True)
+        assert bits.to_list() == [False, True, True]
+        with pytest.raises(ValueError):
+            _native().validate_string_offsets(offsets, data, ('contains',))
+
+    def test_pattern_spec(self):
+        data = b"AB-12ab-12AB-123"
+        offsets = array('i', [0, 5, 10, 16])
+        results, valid_count = _native().validate_string_offsets(offsets, data, ('pattern', '^[A-Z]+-[0-9]+$'))
+        assert results == [True, False, True]
+        assert valid_count == 2
+        with pytest.raises(ValueError):
+            _native().validate_string_offsets(offsets, data, ('pattern', '(unclosed'))
+
+    def test_empty(self):
+        results, valid_count = _native().validate_string_offsets(array('i', [0]), b'', ('email',))
+        assert results == [] and valid_count == 0
+
+    def test_pyarrow(self):
+        pa = pytest.importorskip("pyarrow")
+        for type_ in (pa.string(), pa.large_string()):
+            emails = pa.array(["a@b.co", None, "bad", "x@y.io"], type=type_)
+            result = validate_emails_batch(emails)
+            assert result.results == [True, False, False, True]
+
+
+class TestBatchHelpers:
+    def test_validate_ints_batch(self):
+        result = validate_ints_batch([25, 30, 150, 18, 90], 18, 90)
+        assert result.get_invalid_indices() == [2]
+        result = validate_ints_batch(array('q', [1, 2, 3]), 2, 3)
+        assert result.results == [False, True, True]
+
+    def test_validate_ints_batch_other_int_buffers(self):
+        assert validate_ints_batch(array('i', [1, 2, 3]), 2, 3).results == [False, True, True]
+        assert validate_ints_batch(bytes([1, 2, 3]), 2, 3).results == [False, True, True]
+        assert validate_ints_batch(array('d', [1.0, 2.5]), 2, 3).results == [False, True]
+
+    def test_validate_ints_batch_overflow_falls_back(self):
+        result = validate_ints_batch([2 ** 70, 5], 0, 10)
+        assert result.results == [False, True]
+
+    def test_validate_strings_batch_list(self):
+        result = validate_strings_batch(["ok", "", "toolong"], 1, 5)
+        assert result.results == [True, False, False]
+
+    def test_validate_emails_batch_list(self):
+        result = validate_emails_batch(["alice@example.com", "invalid", "bob@example.com"])
+        assert result.results == [True, False, True]
+        assert result.valid_count == 2
+
+    def test_validate_emails_batch_non_str_entries(self):
+        result = validate_emails_batch(["a@b.co", None, 5, "bad\ud800@x.io", "x@y.io"])
+        assert result.results == [True, False, False, False, True]
+        assert result.valid_count == 2
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
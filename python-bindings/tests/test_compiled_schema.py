@@ -0,0 +1,659 @@
+"""
+Tests for the native CompiledSchema fast path
+"""
+
+import os
+import tempfile
+
+import pytest
+from dhi import HAS_NATIVE_EXT, compile_schema, native_stats, validation_errors
+
+pytestmark = pytest.mark.skipif(not HAS_NATIVE_EXT, reason="native extension not built")
+
+USER_SPECS = {
+    'name': ('string', 1, 100),
+    'email': ('email',),
+    'age': ('int', 18, 120),
+}
+
+USERS = [
+    {"name": "Alice", "email": "alice@example.com", "age": 25},
+    {"name": "Bob", "email": "bob@example.com", "age": 30},
+    {"name": "", "email": "invalid", "age": 15},
+    {"name": "Carol", "email": "carol@example.com"},
+]
+
+
+class TestCompiledSchema:
+    def test_validate_batch(self):
+        schema = compile_schema(USER_SPECS)
+        results, valid_count = schema.validate_batch(USERS)
+        assert results == [True, True, False, False]
+        assert valid_count == 2
+
+    def test_matches_validate_batch_direct(self):
+        from dhi import _dhi_native
+        schema = compile_schema(USER_SPECS)
+        assert schema.validate_batch(USERS) == _dhi_native.validate_batch_direct(USERS, USER_SPECS)
+
+    def test_validate_single(self):
+        schema = compile_schema(USER_SPECS)
+        assert schema.validate(USERS[0]) is True
+        assert schema.validate(USERS[2]) is False
+
+    def test_reuse_across_calls(self):
+        schema = compile_schema(USER_SPECS)
+        for _ in range(100):
+            results, valid_count = schema.validate_batch(USERS[:2])
+            assert valid_count == 2
+        assert len(schema) == 3
+
+    def test_raising_key_lookup(self):
+        class BadKey:
+            # Same hash as 'age', so looking 'age' up compares against it
+            def __hash__(self):
+                return hash('age')
+
+            def __eq__(self, other):
+                raise RuntimeError("boom")
+
+        schema = compile_schema({'age': ('int', 0, 120)})
+        nested = compile_schema({'user': ('object', {'age': ('int', 0, 120)})})
+        item = {BadKey(): 1}
+        calls = [
+            lambda: schema.validate(item),
+            lambda: schema.validate_batch([item]),
+            lambda: schema.validate_batch([{'age': 1}] * 5000 + [item], threads=4),
+            lambda: compile_schema({'age': ('int', 0, 120)}, adaptive=True).validate_batch([item]),
+            lambda: schema.collect_errors([item]),
+            lambda: schema.validate_changed(item, ['age']),
+            lambda: schema.collect_changed_errors(item, ['age']),
+            lambda: nested.validate({'user': item}),
+            lambda: nested.collect_errors([{'user': item}]),
+        ]
+        for call in calls:
+            with pytest.raises(RuntimeError):
+                call()
+
+    def test_empty_batch(self):
+        schema = compile_schema(USER_SPECS)
+        assert schema.validate_batch([]) == ([], 0)
+
+    def test_non_ascii_strings(self):
+        import sys
+        # Lengths are UTF-8 bytes; lone surrogates are invalid
+        schema = compile_schema({'name': ('string', 1, 5)})
+        names = ["héll", "héllo", "日本", "😀", "\ud800", "plain"]
+        items = [{'name': name} for name in names]
+        sizes = [sys.getsizeof(name) for name in names]
+        expected = [True, False, False, True, False, True]
+
+        assert schema.validate_batch(items)[0] == expected
+        assert schema.validate_batch(items * 1000, threads=2)[0] == expected * 1000
+        # No UTF-8 copy is cached on the str objects
+        assert [sys.getsizeof(name) for name in names] == sizes
+
+    def test_type_errors(self):
+        schema = compile_schema(USER_SPECS)
+        with pytest.raises(TypeError):
+            schema.validate_batch([1, 2, 3])
+        with pytest.raises(TypeError):
+            schema.validate("not a dict")
+        with pytest.raises(TypeError):
+            compile_schema({'age': ('int', 'low', 'high')})
+
+    def test_bad_specs_raise_for_empty_batches(self):
+        from dhi import _dhi_native
+        assert _dhi_native.validate_batch_direct([], USER_SPECS) == ([], 0)
+        with pytest.raises(TypeError):
+            _dhi_native.validate_batch_direct([], {'age': ('int', 'low', 'high')})
+
+
+class TestParallelBatch:
+    # Large enough to take the GIL-released columnar path
+    BIG = [
+        {"name": f"User{i}", "email": f"user{i}@example.com" if i % 7 else "bad", "age": 10 + i % 100}
+        for i in range(20000)
+    ]
+
+    def test_parallel_matches_serial(self):
+        schema = compile_schema(USER_SPECS)
+        serial = schema.validate_batch(self.BIG)
+        assert schema.validate_batch(self.BIG, threads=4) == serial
+        assert schema.validate_batch(self.BIG, threads=0) == serial
+
+    def test_parallel_type_mismatch_is_invalid(self):
+        from dhi import _dhi_native
+        items = self.BIG + [{"name": 5, "email": "x@y.z", "age": "old"}]
+        results, _ = _dhi_native.validate_batch_direct(items, USER_SPECS, threads=2)
+        assert results[-1] is False
+
+    def test_set_num_threads(self):
+        from dhi import _dhi_native
+        _dhi_native.set_num_threads(3)
+        assert _dhi_native.get_num_threads() == 3
+        _dhi_native.set_num_threads(0)
+        with pytest.raises(ValueError):
+            _dhi_native.set_num_threads(-1)
+
+
+class TestBitmapResults:
+    def test_bitmap_matches_list(self):
+        schema = compile_schema(USER_SPECS)
+        bits, valid_count = schema.validate_batch(USERS, bitmap=True)
+        assert valid_count == 2
+        assert bits.valid_count == 2
+        assert bits.invalid_count == 2
+        assert len(bits) == len(USERS)
+        assert bits.to_list() == [True, True, False, False]
+        assert bits[0] is True and bits[2] is False
+
+    def test_buffer_layout(self):
+        schema = compile_schema(USER_SPECS)
+        bits, _ = schema.validate_batch(USERS, bitmap=True)
+        # LSB-first: items 0 and 1 valid
+        assert bytes(memoryview(bits)) == b"\x03"
+        assert memoryview(bits).readonly
+
+    def test_invalid_indices(self):
+        schema = compile_schema(USER_SPECS)
+        bits, _ = schema.validate_batch(USERS, bitmap=True)
+        assert bits.first_invalid() == 2
+        assert list(bits.invalid_indices()) == [2, 3]
+
+        all_valid, _ = schema.validate_batch(USERS[:2], bitmap=True)
+        assert all_valid.first_invalid() is None
+        assert list(all_valid.invalid_indices()) == []
+
+    def test_empty_batch(self):
+        from dhi import _dhi_native
+        bits, valid_count = _dhi_native.validate_batch_direct([], USER_SPECS, bitmap=True)
+        assert valid_count == 0
+        assert len(bits) == 0
+        assert bytes(memoryview(bits)) == b""
+
+    def test_parallel_bitmap_matches_serial(self):
+        schema = compile_schema(USER_SPECS)
+        serial, serial_count = schema.validate_batch(TestParallelBatch.BIG)
+        bits, valid_count = schema.validate_batch(TestParallelBatch.BIG, threads=4, bitmap=True)
+        assert valid_count == serial_count
+        assert bits.to_list() == serial
+        assert list(bits.invalid_indices()) == [i for i, ok in enumerate(serial) if not ok]
+
+
+class TestJsonBatch:
+    BODY = (
+        b'[{"name": "Alice", "email": "alice@example.com", "age": 25, "extra": {"x": [1, 2]}},'
+        b' {"name": "Bob", "email": "bob@example.com", "age": 30.5},'
+        b' {"name": "", "email": "invalid", "age": 15},'
+        b' {"name": "Carol", "email": "carol@example.com"},'
+        b' "not an object"]'
+    )
+
+    def test_validate_json_batch(self):
+        from dhi import _dhi_native
+        results, valid_count = _dhi_native.validate_json_batch(self.BODY, USER_SPECS)
+        assert results == [True, False, False, False, False]
+        assert valid_count == 1
+
+    def test_compiled_schema_and_bitmap(self):
+        schema = compile_schema(USER_SPECS)
+        bits, valid_count = schema.validate_json(bytearray(self.BODY), bitmap=True)
+        assert valid_count == 1
+        assert list(bits.invalid_indices()) == [1, 2, 3, 4]
+
+    def test_matches_dict_path(self):
+        import json
+        schema = compile_schema(USER_SPECS)
+        body = json.dumps(USERS).encode()
+        assert schema.validate_json(body) == schema.validate_batch(USERS)
+
+    def test_malformed(self):
+        schema = compile_schema(USER_SPECS)
+        for body in (b'{"name": "x"}', b'[{"name": "x"}', b'', b'[] trailing'):
+            with pytest.raises(ValueError):
+                schema.validate_json(body)
+        assert schema.validate_json(b'[]') == ([], 0)
+        with pytest.raises(TypeError):
+            schema.validate_json('[]')
+
+
+
+class TestFileValidation:
+    NDJSON = (
+        b'{"name": "Alice", "email": "alice@example.com", "age": 25}\n'
+        b'\n'
+        b'{"name": "Bob", "email": "bob@example.com", "age": 12}\r\n'
+        b'{"name": "Carol", "email": "carol@example.com", \n'
+        b'{"name": "Dave", "email": "dave@example.com", "age": 40}'
+    )
+
+    def _write(self, directory, name, data):
+        path = os.path.join(directory, name)
+        with open(path, "wb") as f:
+            f.write(data)
+        return path
+
+    def test_ndjson_file(self):
+        schema = compile_schema(USER_SPECS)
+        with tempfile.TemporaryDirectory() as tmp:
+            path = self._write(tmp, "users.ndjson", self.NDJSON)
+            assert schema.validate_file(path) == ([True, False, False, True], 2)
+            bits, valid_count = schema.validate_file(path, mode="ndjson", threads=4, bitmap=True)
+            assert valid_count == 2
+            assert list(bits.invalid_indices()) == [1, 2]
+
+    def test_json_array_file(self):
+        import json
+        from dhi import _dhi_native
+        with tempfile.TemporaryDirectory() as tmp:
+            path = self._write(tmp, "users.json", json.dumps(USERS).encode())
+            expected = compile_schema(USER_SPECS).validate_batch(USERS)
+            assert _dhi_native.validate_file(path, USER_SPECS) == expected
+            assert _dhi_native.validate_file(path, USER_SPECS, mode="json") == expected
+
+    def test_errors(self):
+        schema = compile_schema(USER_SPECS)
+        with tempfile.TemporaryDirectory() as tmp:
+            with pytest.raises(FileNotFoundError):
+                schema.validate_file(os.path.join(tmp, "missing.ndjson"))
+            path = self._write(tmp, "broken.json", b'[{"name": "x"}')
+            with pytest.raises(ValueError):
+                schema.validate_file(path)
+            with pytest.raises(ValueError):
+                schema.validate_file(path, mode="csv")
+            empty = self._write(tmp, "empty.ndjson", b"")
+            assert schema.validate_file(empty) == ([], 0)
+
+class TestPatterns:
+    SPECS = {'sku': ('pattern', r'^[A-Z]{3}-[0-9]{4}$'), 'qty': ('int_positive',)}
+    ITEMS = [
+        {'sku': 'ABC-1234', 'qty': 1},
+        {'sku': 'abc-1234', 'qty': 1},
+        {'sku': 'ABC-12345', 'qty': 1},
+        {'sku': 'XYZ-0000', 'qty': 0},
+        {'sku': 'QRS-9876', 'qty': 3},
+    ]
+
+    def test_compiled_schema(self):
+        from dhi import _dhi_native
+        schema = compile_schema(self.SPECS)
+        expected = ([True, False, False, False, True], 2)
+        assert schema.validate_batch(self.ITEMS) == expected
+        assert schema.validate_batch(self.ITEMS * 500, threads=2)[1] == 1000
+        assert _dhi_native.validate_batch_direct(self.ITEMS, self.SPECS) == expected
+
+    def test_hostile_input_is_linear(self):
+        schema = compile_schema({'s': ('pattern', r'^(a|aa)*$')})
+        assert schema.validate_batch([{'s': 'a' * 50000 + 'b'}, {'s': 'a' * 50000}])[0] == [False, True]
+
+    def test_bad_patterns(self):
+        with pytest.raises(ValueError):
+            compile_schema({'s': ('pattern', '[abc')})
+        with pytest.raises(ValueError):
+            compile_schema({'s': ('pattern', '(?=abc)')})
+        with pytest.raises(ValueError):
+            compile_schema({'s': ('pattern',)})
+        with pytest.raises(TypeError):
+            compile_schema({'s': ('pattern', 42)})
+
+
+class TestErrorReports:
+    SPECS = {'age': ('int', 18, 120), 'email': ('email',), 'name': ('string', 2, 10)}
+    ITEMS = [
+        {'age': 25, 'email': 'a@b.co', 'name': 'Alice'},
+        {'age': 15, 'email': 'nope', 'name': 'X'},
+        {'email': 'a@b.co', 'name': 5},
+        {'age': 10 ** 30, 'email': 'a@b.co', 'name': 'Bob'},
+    ]
+
+    def test_collect_errors(self):
+        from dhi import _dhi_native
+        report = compile_schema(self.SPECS).collect_errors(self.ITEMS)
+        assert (report.count, report.valid_count, report.invalid_count) == (4, 1, 3)
+        assert list(report) == [
+            (1, 'age', 'too_small', 18),
+            (1, 'email', 'invalid_format', 0),
+            (1, 'name', 'too_small', 2),
+            (2, 'age', 'missing', 0),
+            (2, 'name', 'wrong_type', 0),
+            (3, 'age', 'too_large', 0),
+        ]
+        assert report.invalid_indices() == [1, 2, 3]
+        assert report.errors_for(0) == [] and len(report.errors_for(2)) == 2
+        assert list(_dhi_native.collect_errors(self.ITEMS, self.SPECS)) == list(report)
+
+    def test_matches_fast_path(self):
+        schema = compile_schema(self.SPECS)
+        items = self.ITEMS * 50
+        results, valid_count = schema.validate_batch(items)
+        report = schema.collect_errors(items)
+        assert report.valid_count == valid_count
+        assert report.invalid_indices() == [i for i, ok in enumerate(results) if not ok]
+
+    def test_packed_buffer(self):
+        report = compile_schema(self.SPECS).collect_errors(self.ITEMS)
+        n = len(report)
+        raw = bytes(memoryview(report))
+        assert len(raw) == 11 * n
+        assert list(memoryview(raw[:4 * n]).cast('I')) == [1, 1, 1, 2, 2, 3]
+        assert list(raw[10 * n:]) == [3, 6, 3, 1, 2, 4]
+
+    def test_json_errors(self):
+        schema = compile_schema({'age': ('int', 18, 120), 'score': ('int', 0, 10)})
+        report = schema.collect_json_errors(b'[{"age": 30, "score": 5}, {"age": 7, "score": 50}, {"score": 1}]')
+        assert list(report) == [(1, 'age', 'too_small', 18), (1, 'score', 'too_large', 10), (2, 'age', 'missing', 0)]
+        assert report.valid_count == 1
+        with pytest.raises(ValueError):
+            schema.collect_json_errors(b'{"age": 1}')
+
+    def test_validation_errors(self):
+        report = compile_schema(self.SPECS).collect_errors(self.ITEMS)
+        errors = validation_errors(report, 1)
+        assert [e.field for e in errors] == ['age', 'email', 'name']
+        assert errors[0].message == "Below minimum 18"
+        assert validation_errors(report, 0) == []
+
+
+
+class TestNested:
+    SPECS = {
+        'id': ('int_positive',),
+        'address': ('object', {'city': ('string', 1, 50), 'zip': ('pattern', r'^[0-9]{5}$')}),
+        'lines': ('list', ('object', {'sku': ('string', 1, 20), 'qty': ('int', 1, 99)}), 1, 3),
+        'status': ('one_of', ['open', 'paid']),
+        'note': ('optional', ('string', 0, 5)),
+        'tags': ('default', ('list', ('string', 1, 10)), []),
+    }
+    ORDER = {
+        'id': 1,
+        'address': {'city': 'Paris', 'zip': '75001'},
+        'lines': [{'sku': 'A', 'qty': 2}],
+        'status': 'open',
+    }
+
+    def order(self, **changes):
+        return {**self.ORDER, **changes}
+
+    def test_validate_batch(self):
+        from dhi import _dhi_native
+        schema = compile_schema(self.SPECS)
+        items = [
+            self.ORDER,
+            self.order(note=None, tags=['x']),
+            self.order(note='too long'),
+            self.order(address={'city': 'Paris', 'zip': '7500'}),
+            self.order(address='Paris'),
+            self.order(lines=[]),
+            self.order(lines=[{'sku': 'A', 'qty': 2}, {'sku': 'B', 'qty': 100}]),
+            self.order(status='shipped'),
+            self.order(status=['open']),
+            self.order(tags=['x', '']),
+        ]
+        expected = [True, True] + [False] * 8
+        assert schema.validate_batch(items) == (expected, 2)
+        assert schema.validate_batch(items * 200, threads=4)[0] == expected * 200
+        assert _dhi_native.validate_batch_direct(items, self.SPECS) == (expected, 2)
+        assert schema.validate(self.order(lines=[{'sku': 'A', 'qty': 2}] * 3))
+
+    def test_collect_errors(self):
+        schema = compile_schema(self.SPECS)
+        items = [
+            self.ORDER,
+            self.order(lines=[{'sku': 'A', 'qty': 2}] * 4, status='shipped', note='too long'),
+            self.order(address={'city': ''}, lines=[{'sku': 'A'}], tags='x'),
+            {'id': 2},
+        ]
+        assert list(schema.collect_errors(items)) == [
+            (1, 'lines', 'too_large', 3),
+            (1, 'status', 'not_allowed', 0),
+            (1, 'note', 'too_large', 5),
+            (2, 'address', 'invalid_nested', 0),
+            (2, 'lines', 'invalid_nested', 0),
+            (2, 'tags', 'wrong_type', 0),
+            (3, 'address', 'missing', 0),
+            (3, 'lines', 'missing', 0),
+            (3, 'status', 'missing', 0),
+        ]
+
+    def test_bad_specs(self):
+        with pytest.raises(ValueError):
+            compile_schema({'n': ('default', ('int', 0, 10), 20)})
+        with pytest.raises(TypeError):
+            compile_schema({'a': ('object', ['city'])})
+        with pytest.raises(TypeError):
+            compile_schema({'a': ('list',)})
+        with pytest.raises(TypeError):
+            compile_schema({'a': ('one_of', [[1]])})
+        deep = ('int',)
+        for _ in range(40):
+            deep = ('list', deep)
+        with pytest.raises(ValueError):
+            compile_schema({'a': deep})
+
+    def test_json_input_rejected(self):
+        with pytest.raises(ValueError):
+            compile_schema(self.SPECS).validate_json(b'[]')
+
+
+class TestFloatBool:
+    SPECS = {
+        'price': ('float', 0, 1000),
+        'discount': ('float_lt', 1),
+        'rate': ('float_finite',),
+        'step': ('float_multiple_of', 0.1),
+        'active': ('bool',),
+        'parent': ('nullable', ('int_positive',)),
+    }
+    ROW = {'price': 9.99, 'discount': 0.25, 'rate': 1e300, 'step': 0.3, 'active': True, 'parent': None}
+
+    def row(self, **changes):
+        return {**self.ROW, **changes}
+
+    def test_validate_batch(self):
+        from dhi import _dhi_native
+        items = [
+            self.ROW,
+            self.row(price=10, parent=7),         # ints are accepted for floats
+            self.row(price=-0.01),
+            self.row(price=float('nan')),
+            self.row(price=True),                  # bools are not numbers here
+            self.row(price='9.99'),
+            self.row(price=10 ** 400),
+            self.row(rate=float('inf')),
+            self.row(step=0.35),
+            self.row(active=1),
+            self.row(parent=0),
+        ]
+        expected = [True, True] + [False] * 9
+        assert compile_schema(self.SPECS).validate_batch(items) == (expected, 2)
+        assert _dhi_native.validate_batch_direct(items * 300, self.SPECS, threads=4)[0] == expected * 300
+        assert not compile_schema(self.SPECS).validate({k: v for k, v in self.ROW.items() if k != 'parent'})
+
+    def test_bools_are_not_ints(self):
+        from enum import IntEnum
+        Level = IntEnum('Level', 'LOW HIGH')
+        schema = compile_schema({'age': ('int', 0, 120)})
+        items = [{'age': 1}, {'age': True}, {'age': False}, {'age': Level.LOW}]
+        expected = [True, False, False, False]
+        assert schema.validate_batch(items) == (expected, 1)
+        assert schema.validate_batch(items * 2000, threads=4)[0] == expected * 2000
+        assert not schema.validate({'age': True})
+        assert list(schema.collect_errors([{'age': True}])) == [(0, 'age', 'wrong_type', 0)]
+
+    def test_collect_errors(self):
+        report = compile_schema(self.SPECS).collect_errors([
+            self.row(price=1000.5, discount=1.0, rate=float('nan'), step=0.55, active='yes', parent=-1),
+        ])
+        assert list(report) == [
+            (0, 'price', 'too_large', 1000),
+            (0, 'discount', 'too_large', 1),
+            (0, 'rate', 'invalid_format', 0),
+            (0, 'step', 'not_multiple', 0),
+            (0, 'active', 'wrong_type', 0),
+            (0, 'parent', 'too_small', 0),
+        ]
+
+    def test_bad_specs(self):
+        with pytest.raises(ValueError):
+            compile_schema({'x': ('float_between', 0, 1)})
+        with pytest.raises(TypeError):
+            compile_schema({'x': ('float', 'low')})
+        with pytest.raises(TypeError):
+            compile_schema({'x': 'float'})
+        with pytest.raises(ValueError):
+            compile_schema({'x': ('float',)}).validate_json(b'[]')
+
+class TestGeneratedSchemas:
+    def test_lookup(self):
+        from dhi import _dhi_native
+        names = _dhi_native.generated_schema_names()
+        assert all(isinstance(name, str) for name in names)
+        with pytest.raises(KeyError):
+            _dhi_native.generated_schema("no_such_schema")
+
+    def test_matches_generic_path(self):
+        from dhi import _dhi_native
+        for name in _dhi_native.generated_schema_names():
+            schema = _dhi_native.generated_schema(name)
+            assert schema.validate_batch([]) == ([], 0)
+            # Empty dicts are missing every field
+            assert schema.validate_batch([{}], bitmap=True)[1] == (1 if len(schema) == 0 else 0)
+
+
+class TestAdaptiveOrder:
+    SPECS = {
+        'email': ('email',),
+        'note': ('string', 0, 100),
+        'age': ('int', 18, 120),
+    }
+
+    def test_cheap_checks_first(self):
+        schema = compile_schema(self.SPECS, adaptive=True)
+        assert schema.check_order[0] == 'age'
+        assert compile_schema(self.SPECS).check_order == ['email', 'note', 'age']
+
+    def test_failing_field_moves_forward(self):
+        schema = compile_schema({'age': ('int', 0, 200), 'name': ('string', 1, 10)}, adaptive=True)
+        assert schema.check_order == ['age', 'name']
+        items = [{'age': 30, 'name': ''}] * 4096
+        results, valid_count = schema.validate_batch(items)
+        assert valid_count == 0 and not any(results)
+        assert schema.check_order == ['name', 'age']
+
+    def test_same_results_as_schema_order(self):
+        items = USERS * 600 + [{"email": "x@example.com", "age": 200, "note": "n"}]
+        plain = compile_schema(USER_SPECS)
+        adaptive = compile_schema(USER_SPECS, adaptive=True)
+        assert adaptive.validate_batch(items) == plain.validate_batch(items)
+        assert adaptive.validate_batch(items, bitmap=True)[1] == plain.validate_batch(items)[1]
+        assert [adaptive.validate(item) for item in USERS] == [plain.validate(item) for item in USERS]
+        assert list(adaptive.collect_errors(USERS)) == list(plain.collect_errors(USERS))
+
+
+class TestMemo:
+    def test_same_results(self):
+        specs = {'email': ('email',), 'site': ('url',), 'sku': ('pattern', r'^[A-Z]{3}$')}
+        rows = [
+            {'email': 'a@example.com', 'site': 'https://example.com', 'sku': 'ABC'},
+            {'email': 'nope', 'site': 'https://example.com', 'sku': 'ABC'},
+            {'email': 'a@example.com', 'site': 'not a url', 'sku': 'abc'},
+        ]
+        # Equal values in distinct objects, as json.loads produces them
+        items = [{k: ''.join(list(v)) for k, v in row.items()} for row in rows * 200]
+        schema = compile_schema(specs)
+        expected = schema.validate_batch(items)
+        assert schema.validate_batch(items, memo=True) == expected
+        assert schema.validate_batch(items, memo=True, bitmap=True)[1] == expected[1]
+        assert compile_schema(specs, adaptive=True).validate_batch(items, memo=True) == expected
+        from dhi import _dhi_native
+        assert _dhi_native.validate_batch_direct(items, specs, memo=True) == expected
+
+    def test_string_column(self):
+        from dhi import validate_emails_batch
+        emails = ['a@example.com', 'bad', 'a@example.com'] * 100
+        plain = validate_emails_batch(emails)
+        cached = validate_emails_batch(emails, memo=True)
+        assert cached.results == plain.results and cached.valid_count == 200
+
+
+
+class TestValidateChanged:
+    def test_only_changed_fields(self):
+        schema = compile_schema(USER_SPECS)
+        record = {"name": "Alice", "email": "invalid", "age": 25}
+        # The bad email is not part of this update
+        assert schema.validate_changed(record, ["age"])
+        assert schema.validate_changed(record, {"name", "age", "not_in_schema"})
+        assert not schema.validate_changed(record, ["age", "email"])
+        assert schema.validate_changed(record, [])
+        assert not schema.validate_changed({"name": "Alice"}, ("age",))
+
+    def test_errors_keep_field_indices(self):
+        schema = compile_schema(USER_SPECS)
+        record = {"name": "", "email": "invalid", "age": 15}
+        report = schema.collect_changed_errors(record, ["age", "name", "age"])
+        assert (report.count, report.valid_count) == (1, 0)
+        assert list(report) == [(0, 'name', 'too_small', 1), (0, 'age', 'too_small', 18)]
+        assert list(schema.collect_changed_errors(record, ["unknown"])) == []
+
+    def test_bad_changed(self):
+        schema = compile_schema(USER_SPECS)
+        with pytest.raises(TypeError):
+            schema.validate_changed({"age": 20}, 5)
+
+
+class TestValidateBatchAsync:
+    def test_same_results(self):
+        import asyncio
+        schema = compile_schema(USER_SPECS)
+        items = USERS * 3000
+        expected = schema.validate_batch(items)
+        assert asyncio.run(schema.validate_batch_async(items)) == expected
+        assert asyncio.run(schema.validate_batch_async(items, chunk=4096, memo=True)) == expected
+        assert asyncio.run(schema.validate_batch_async(items, chunk=1000, in_flight=4)) == expected
+        assert asyncio.run(schema.validate_batch_async([])) == ([], 0)
+        with pytest.raises(ValueError):
+            asyncio.run(schema.validate_batch_async(items, chunk=0))
+        with pytest.raises(ValueError):
+            asyncio.run(schema.validate_batch_async(items, in_flight=0))
+
+    def test_loop_runs_between_chunks(self):
+        import asyncio
+        schema = compile_schema(USER_SPECS)
+        ticks = []
+
+        async def main():
+            async def ticker():
+                while True:
+                    ticks.append(1)
+                    await asyncio.sleep(0)
+
+            task = asyncio.create_task(ticker())
+            result = await schema.validate_batch_async(USERS * 10, chunk=2)
+            task.cancel()
+            return result
+
+        assert asyncio.run(main()) == schema.validate_batch(USERS * 10)
+        assert len(ticks) > 1
+
+
+class TestNativeStats:
+    def test_counts_when_enabled(self):
+        import json
+        from dhi import _dhi_native
+        native_stats(reset=True)
+        compile_schema(USER_SPECS).validate_json(json.dumps(USERS).encode())
+        stats = native_stats()
+        if not _dhi_native.stats_enabled():
+            assert stats == {}
+            return
+        assert stats['email']['checks'] >= 3
+        assert stats['email']['failures'] >= 1
+        assert 'url' not in stats
+        native_stats(reset=True)
+        assert native_stats() == {}
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
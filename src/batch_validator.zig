@@ -1,6 +1,7 @@
 /// High-performance batch validation system
 /// Designed to minimize FFI overhead by validating multiple items in a single call
 const std = @import("std");
+const validators = @import("validators_comprehensive.zig");
 
 /// Field validator type enum
 pub const ValidatorType = enum(u8) {
@@ -25,10 +26,22 @@ pub const SchemaField = extern struct {
     data_type: DataType,
 };
 
-/// Data type for field values
+/// Data type for field values, stored little-endian at `SchemaField.offset`
 pub const DataType = enum(u8) {
+    /// 8-byte signed integer
     Int64,
+    /// 8 bytes: u32 offset + u32 length of the UTF-8 bytes in the string heap
     String,
+    /// 4-byte signed integer
+    Int32,
+
+    /// Bytes the value takes inside a row
+    pub fn width(self: DataType) usize {
+        return switch (self) {
+            .Int64, .String => 8,
+            .Int32 => 4,
+        };
+    }
 };
 
 /// Validation result for a single item
@@ -38,6 +51,22 @@ pub const ValidationResult = extern struct {
     first_error_field_idx: u32, // Index of first failing field
 };
 
+/// Packed fixed-width rows plus the heap their String fields point into
+/// Fields need no alignment, so producers can memcpy their structs as-is.
+pub const RowBatch = struct {
+    rows: []const u8, // count * stride bytes
+    stride: usize,
+    heap: []const u8 = "",
+
+    pub fn count(self: RowBatch) usize {
+        return if (self.stride == 0) 0 else self.rows.len / self.stride;
+    }
+};
+
+/// Rows validated per field before moving to the next field; keeps the
+/// block in L1 while the per-field dispatch stays out of the inner loop
+const rows_per_block = 256;
+
 /// Batch validation context
 pub const BatchValidator = struct {
     allocator: std.mem.Allocator,
@@ -49,8 +78,24 @@ pub const BatchValidator = struct {
             .schema = schema,
         };
     }
+
+    /// Check that every field fits inside `stride` bytes and that its
+    /// validator applies to its data type
+    pub fn checkSchema(self: *const BatchValidator, stride: usize) !void {
+        for (self.schema) |field| {
+            if (@as(usize, field.offset) + field.data_type.width() > stride) return error.FieldOutOfBounds;
+            const ok = switch (field.validator_type) {
+                .BoundedInt => field.data_type != .String,
+                .BoundedString, .Email => field.data_type == .String,
+                .None => true,
+            };
+            if (!ok) return error.TypeMismatch;
+        }
+    }
     
     /// Validate a batch of items with the given schema
+    /// Each item is one row; its String fields point into the item itself
+    /// (e.g. a fixed header followed by the string bytes).
     /// Returns array of ValidationResult (one per item)
     pub fn validateBatch(
         self: *BatchValidator,
@@ -69,6 +114,35 @@ pub const BatchValidator = struct {
         
         return valid_count;
     }
+
+    /// Validate every row of `batch`; results[i] gets row i
+    /// Returns number of valid rows; error.InvalidStride for a zero stride,
+    /// which would make the row count unknowable
+    pub fn validateRows(self: *const BatchValidator, batch: RowBatch, results: []ValidationResult) !usize {
+        if (batch.stride == 0) return error.InvalidStride;
+        try self.checkSchema(batch.stride);
+        const count = batch.count();
+        if (results.len < count) return error.LengthMismatch;
+
+        @memset(results[0..count], .{ .is_valid = 1, .error_count = 0, .first_error_field_idx = 0 });
+
+        var block_start: usize = 0;
+        while (block_start < count) : (block_start += rows_per_block) {
+            const block_end = @min(block_start + rows_per_block, count);
+            for (self.schema, 0..) |field, field_idx| {
+                for (block_start..block_end) |row| {
+                    const row_data = batch.rows[row * batch.stride ..][0..batch.stride];
+                    if (!validateField(field, row_data, batch.heap)) {
+                        markInvalid(&results[row], field_idx);
+                    }
+                }
+            }
+        }
+
+        var valid_count: usize = 0;
+        for (results[0..count]) |r| valid_count += r.is_valid;
+        return valid_count;
+    }
     
     /// Validate a single item against the schema
     fn validateItem(self: *BatchValidator, item_data: []const u8) ValidationResult {
@@ -79,45 +153,57 @@ pub const BatchValidator = struct {
         };
         
         for (self.schema, 0..) |field, field_idx| {
-            const is_valid = self.validateField(field, item_data);
-            if (!is_valid) {
-                result.is_valid = 0;
-                result.error_count += 1;
-                if (result.error_count == 1) {
-                    result.first_error_field_idx = @intCast(field_idx);
-                }
+            // Fields past the end of a short item are missing
+            const fits = @as(usize, field.offset) + field.data_type.width() <= item_data.len;
+            if (!fits or !validateField(field, item_data, item_data)) {
+                markInvalid(&result, field_idx);
             }
         }
         
         return result;
     }
-    
-    /// Validate a single field
-    fn validateField(self: *BatchValidator, field: SchemaField, item_data: []const u8) bool {
-        _ = self;
-        _ = item_data;
-        
-        // TODO: Implement proper field extraction from item_data
-        // For now, this is a placeholder for the generic schema-based validator
-        switch (field.validator_type) {
-            .BoundedInt => {
-                // TODO: Extract int value from item_data at field.offset
-                // For now, placeholder
-                return true;
-            },
-            .BoundedString => {
-                // TODO: Extract string from item_data at field.offset
-                return true;
-            },
-            .Email => {
-                // TODO: Extract string and validate email
-                return true;
-            },
-            .None => return true,
-        }
-    }
 };
 
+inline fn markInvalid(result: *ValidationResult, field_idx: usize) void {
+    if (result.error_count == 0) result.first_error_field_idx = @intCast(field_idx);
+    result.is_valid = 0;
+    result.error_count += 1;
+}
+
+/// Validate a single field of one row (field must fit inside `row`)
+/// A validator applied to the wrong data type fails.
+inline fn validateField(field: SchemaField, row: []const u8, heap: []const u8) bool {
+    const bytes = row[field.offset..];
+    switch (field.validator_type) {
+        .BoundedInt => {
+            const value: i64 = switch (field.data_type) {
+                .Int64 => std.mem.readInt(i64, bytes[0..8], .little),
+                .Int32 => std.mem.readInt(i32, bytes[0..4], .little),
+                .String => return false,
+            };
+            return value >= field.param1 and value <= field.param2;
+        },
+        .BoundedString => {
+            const str = stringAt(field.data_type, bytes, heap) orelse return false;
+            return str.len >= field.param1 and str.len <= field.param2;
+        },
+        .Email => {
+            const str = stringAt(field.data_type, bytes, heap) orelse return false;
+            return validators.validateEmail(str);
+        },
+        .None => return true,
+    }
+}
+
+/// String referenced by an (offset, len) pair, or null if out of heap bounds
+inline fn stringAt(data_type: DataType, bytes: []const u8, heap: []const u8) ?[]const u8 {
+    if (data_type != .String) return null;
+    const start = std.mem.readInt(u32, bytes[0..4], .little);
+    const len = std.mem.readInt(u32, bytes[4..8], .little);
+    if (@as(u64, start) + len > heap.len) return null;
+    return heap[start..][0..len];
+}
+
 /// Optimized batch validation for common user struct pattern
 /// This is a specialized fast path for the common case
 pub const UserBatchValidator = struct {
@@ -162,7 +248,7 @@ pub const UserBatchValidator = struct {
             // Validate email (only if name is valid, for short-circuit)
             if (is_valid) {
                 const email = std.mem.span(emails[i]);
-                if (!validateEmail(email)) {
+                if (!validators.validateEmail(email)) {
                     is_valid = false;
                 }
             }
@@ -182,19 +268,80 @@ pub const UserBatchValidator = struct {
     }
 };
 
-/// Fast email validation
-inline fn validateEmail(email: []const u8) bool {
-    const at_pos = std.mem.indexOf(u8, email, "@") orelse return false;
-    if (at_pos == 0) return false; // No local part
-    
-    const domain = email[at_pos + 1..];
-    if (domain.len == 0) return false; // No domain
-    if (std.mem.indexOf(u8, domain, ".") == null) return false; // No TLD
-    
-    return true;
+/// Lanes per chunk for the range kernels (8 x i64/f64 = one AVX-512 register,
+/// two AVX2 registers, four NEON/SIMD128 registers)
+pub const range_lanes = 8;
+
+/// Vectorized range test: writes 1 to results[i] when min <= values[i] <= max, else 0
+/// Each chunk does two lane-wise compares, one vector store of the 0/1 bytes and
+/// counts valid items with @popCount on the lane mask. NaN is never in range.
+/// Returns number of valid items
+pub fn validateRangeBatch(comptime T: type, values: []const T, min: T, max: T, results: []u8) usize {
+    const lanes = range_lanes;
+    const Mask = std.meta.Int(.unsigned, lanes);
+    const min_v: @Vector(lanes, T) = @splat(min);
+    const max_v: @Vector(lanes, T) = @splat(max);
+    const ones: @Vector(lanes, u8) = @splat(1);
+    const zeros: @Vector(lanes, u8) = @splat(0);
+
+    var valid_count: usize = 0;
+    var i: usize = 0;
+
+    while (i + lanes <= values.len) : (i += lanes) {
+        const chunk: @Vector(lanes, T) = values[i..][0..lanes].*;
+        const ge: Mask = @bitCast(chunk >= min_v);
+        const le: Mask = @bitCast(chunk <= max_v);
+        const mask = ge & le;
+        const in_range: @Vector(lanes, bool) = @bitCast(mask);
+        results[i..][0..lanes].* = @select(u8, in_range, ones, zeros);
+        valid_count += @popCount(mask);
+    }
+
+    // Handle remaining items
+    while (i < values.len) : (i += 1) {
+        const is_valid = values[i] >= min and values[i] <= max;
+        results[i] = @intFromBool(is_valid);
+        valid_count += @intFromBool(is_valid);
+    }
+
+    return valid_count;
 }
 
-/// SIMD-optimized batch integer validation (when available)
+/// Vectorized range test with packed results (see bitmap.zig)
+/// With 8 lanes each chunk's lane mask is exactly one bitmap byte.
+/// Returns number of valid items
+pub fn validateRangeBitmap(comptime T: type, values: []const T, min: T, max: T, bitmap: []u8) usize {
+    comptime std.debug.assert(range_lanes == 8);
+    const lanes = range_lanes;
+    const min_v: @Vector(lanes, T) = @splat(min);
+    const max_v: @Vector(lanes, T) = @splat(max);
+
+    var valid_count: usize = 0;
+    var i: usize = 0;
+
+    while (i + lanes <= values.len) : (i += lanes) {
+        const chunk: @Vector(lanes, T) = values[i..][0..lanes].*;
+        const ge: u8 = @bitCast(chunk >= min_v);
+        const le: u8 = @bitCast(chunk <= max_v);
+        const mask = ge & le;
+        bitmap[i >> 3] = mask;
+        valid_count += @popCount(mask);
+    }
+
+    // Handle remaining items (last partial byte)
+    if (i < values.len) {
+        var mask: u8 = 0;
+        for (values[i..], 0..) |value, bit| {
+            if (value >= min and value <= max) mask |= @as(u8, 1) << @intCast(bit);
+        }
+        bitmap[i >> 3] = mask;
+        valid_count += @popCount(mask);
+    }
+
+    return valid_count;
+}
+
+/// SIMD-optimized batch integer validation
 pub fn validateIntBatchSIMD(
     values: []const i64,
     min: i64,
@@ -202,18 +349,7 @@ pub fn validateIntBatchSIMD(
     results: []u8,
 ) usize {
     if (values.len != results.len) return 0;
-    
-    var valid_count: usize = 0;
-    
-    // TODO: Use SIMD when available (Zig 0.12+ has better SIMD support)
-    // For now, use simple loop with potential for auto-vectorization
-    for (values, 0..) |value, i| {
-        const is_valid = value >= min and value <= max;
-        results[i] = if (is_valid) 1 else 0;
-        if (is_valid) valid_count += 1;
-    }
-    
-    return valid_count;
+    return validateRangeBatch(i64, values, min, max, results);
 }
 
 /// Batch string length validation
@@ -248,7 +384,7 @@ pub fn validateEmailBatch(
     
     for (emails, 0..) |email_ptr, i| {
         const email = std.mem.span(email_ptr);
-        const is_valid = validateEmail(email);
+        const is_valid = validators.validateEmail(email);
         results[i] = if (is_valid) 1 else 0;
         if (is_valid) valid_count += 1;
     }
@@ -256,6 +392,28 @@ pub fn validateEmailBatch(
     return valid_count;
 }
 
+/// Batch email validation with packed results (see bitmap.zig)
+pub fn validateEmailBatchBitmap(
+    emails: []const [*:0]const u8,
+    bitmap: []u8,
+) usize {
+    var valid_count: usize = 0;
+    var byte: u8 = 0;
+
+    for (emails, 0..) |email_ptr, i| {
+        const is_valid = validators.validateEmail(std.mem.span(email_ptr));
+        byte |= @as(u8, @intFromBool(is_valid)) << @intCast(i & 7);
+        valid_count += @intFromBool(is_valid);
+        if (i & 7 == 7) {
+            bitmap[i >> 3] = byte;
+            byte = 0;
+        }
+    }
+    if (emails.len & 7 != 0) bitmap[emails.len >> 3] = byte;
+
+    return valid_count;
+}
+
 test "UserBatchValidator basic" {
     const validator = UserBatchValidator.init(1, 100, 18, 120);
     
@@ -285,3 +443,80 @@ test "validateIntBatchSIMD" {
     try std.testing.expectEqual(@as(u8, 1), results[3]);
     try std.testing.expectEqual(@as(u8, 1), results[4]);
 }
+
+test "validateRangeBitmap - matches byte results" {
+    var values: [2 * range_lanes + 5]i64 = undefined;
+    for (&values, 0..) |*v, i| v.* = @as(i64, @intCast(i * 7 % 30));
+    var results: [values.len]u8 = undefined;
+    var bitmap: [(values.len + 7) / 8]u8 = undefined;
+
+    const byte_count = validateRangeBatch(i64, &values, 5, 20, &results);
+    const bit_count = validateRangeBitmap(i64, &values, 5, 20, &bitmap);
+
+    try std.testing.expectEqual(byte_count, bit_count);
+    for (results, 0..) |r, i| {
+        try std.testing.expectEqual(r, (bitmap[i / 8] >> @intCast(i % 8)) & 1);
+    }
+}
+
+test "validateRangeBatch - full chunks and tail" {
+    var values: [3 * range_lanes + 3]f64 = undefined;
+    for (&values, 0..) |*v, i| v.* = @floatFromInt(i);
+    values[5] = std.math.nan(f64);
+    var results: [values.len]u8 = undefined;
+
+    const valid_count = validateRangeBatch(f64, &values, 2.0, 20.0, &results);
+
+    var expected: usize = 0;
+    for (values, results) |v, r| {
+        const in_range = v >= 2.0 and v <= 20.0;
+        try std.testing.expectEqual(@as(u8, @intFromBool(in_range)), r);
+        expected += @intFromBool(in_range);
+    }
+    try std.testing.expectEqual(expected, valid_count);
+    try std.testing.expectEqual(@as(u8, 0), results[5]); // NaN
+}
+
+test "BatchValidator - packed rows with string heap" {
+    // Row layout: id i64 @0, age i32 @8, email (offset, len) @12; stride 20
+    const Row = struct {
+        fn write(buf: []u8, id: i64, age: i32, email_off: u32, email_len: u32) void {
+            std.mem.writeInt(i64, buf[0..8], id, .little);
+            std.mem.writeInt(i32, buf[8..12], age, .little);
+            std.mem.writeInt(u32, buf[12..16], email_off, .little);
+            std.mem.writeInt(u32, buf[16..20], email_len, .little);
+        }
+    };
+    const heap = "a@b.cobad-email";
+    var rows: [4 * 20]u8 = undefined;
+    Row.write(rows[0..20], 1, 30, 0, 6); // valid
+    Row.write(rows[20..40], 2, 12, 0, 6); // age too low
+    Row.write(rows[40..60], 3, 40, 6, 9); // bad email
+    Row.write(rows[60..80], -1, 200, 10, 99); // everything wrong, email out of heap
+
+    const schema = [_]SchemaField{
+        .{ .field_name = "id", .field_name_len = 2, .validator_type = .BoundedInt, .param1 = 0, .param2 = std.math.maxInt(i64), .offset = 0, .data_type = .Int64 },
+        .{ .field_name = "age", .field_name_len = 3, .validator_type = .BoundedInt, .param1 = 18, .param2 = 120, .offset = 8, .data_type = .Int32 },
+        .{ .field_name = "email", .field_name_len = 5, .validator_type = .Email, .param1 = 0, .param2 = 0, .offset = 12, .data_type = .String },
+    };
+    const validator = BatchValidator.init(std.testing.allocator, &schema);
+
+    var results: [4]ValidationResult = undefined;
+    const valid_count = try validator.validateRows(.{ .rows = &rows, .stride = 20, .heap = heap }, &results);
+
+    try std.testing.expectEqual(@as(usize, 1), valid_count);
+    try std.testing.expectEqual(@as(u8, 1), results[0].is_valid);
+    try std.testing.expectEqual(@as(u32, 1), results[1].first_error_field_idx);
+    try std.testing.expectEqual(@as(u32, 2), results[2].first_error_field_idx);
+    try std.testing.expectEqual(@as(u32, 3), results[3].error_count);
+    try std.testing.expectEqual(@as(u32, 0), results[3].first_error_field_idx);
+
+    try std.testing.expectError(error.FieldOutOfBounds, validator.validateRows(.{ .rows = &rows, .stride = 16 }, &results));
+    const no_fields = BatchValidator.init(std.testing.allocator, &.{});
+    try std.testing.expectError(error.InvalidStride, no_fields.validateRows(.{ .rows = &rows, .stride = 0 }, &results));
+    const bad_schema = [_]SchemaField{
+        .{ .field_name = "id", .field_name_len = 2, .validator_type = .Email, .param1 = 0, .param2 = 0, .offset = 0, .data_type = .Int64 },
+    };
+    const bad = BatchValidator.init(std.testing.allocator, &bad_schema);
+    try std.testing.expectError(error.TypeMismatch, bad.validateRows(.{ .rows = &rows, .stride = 20 }, &results));
+}
@@ -0,0 +1,176 @@
+/// Packed validation results for batch APIs
+/// Bit i (LSB-first within byte i / 8) is 1 when item i is valid.
+/// 8x smaller than one result byte per item; counted with @popCount.
+/// Bits past `count` in the last byte are always 0.
+const std = @import("std");
+
+/// Bytes needed for `count` results
+pub inline fn byteLen(count: usize) usize {
+    return (count + 7) / 8;
+}
+
+/// Read result for item i
+pub inline fn isValid(bitmap: []const u8, i: usize) bool {
+    return (bitmap[i >> 3] >> @intCast(i & 7)) & 1 == 1;
+}
+
+/// Write result for item i
+pub inline fn set(bitmap: []u8, i: usize, valid: bool) void {
+    const bit = @as(u8, 1) << @intCast(i & 7);
+    if (valid) bitmap[i >> 3] |= bit else bitmap[i >> 3] &= ~bit;
+}
+
+/// Pack 0/1 result bytes into a bitmap (8 results per vector compare)
+/// Returns number of valid items
+pub fn pack(results: []const u8, bitmap: []u8) usize {
+    const zeros: @Vector(8, u8) = @splat(0);
+    var valid_count: usize = 0;
+    var i: usize = 0;
+
+    while (i + 8 <= results.len) : (i += 8) {
+        const chunk: @Vector(8, u8) = results[i..][0..8].*;
+        const mask: u8 = @bitCast(chunk != zeros);
+        bitmap[i >> 3] = mask;
+        valid_count += @popCount(mask);
+    }
+
+    if (i < results.len) {
+        var last: u8 = 0;
+        for (results[i..], 0..) |r, bit| {
+            if (r != 0) last |= @as(u8, 1) << @intCast(bit);
+        }
+        bitmap[i >> 3] = last;
+        valid_count += @popCount(last);
+    }
+
+    return valid_count;
+}
+
+/// Number of valid items (popcount over 64-bit words)
+pub fn countValid(bitmap: []const u8, count: usize) usize {
+    const bytes = bitmap[0..byteLen(count)];
+    var total: usize = 0;
+    var i: usize = 0;
+
+    while (i + 8 <= bytes.len) : (i += 8) {
+        total += @popCount(std.mem.readInt(u64, bytes[i..][0..8], .little));
+    }
+    while (i < bytes.len) : (i += 1) {
+        total += @popCount(bytes[i]);
+    }
+
+    return total;
+}
+
+/// Index of the first invalid item at or after `from`, or null
+pub fn nextInvalid(bitmap: []const u8, count: usize, from: usize) ?usize {
+    if (from >= count) return null;
+
+    var byte_idx = from >> 3;
+    // Invert so invalid items are 1 bits; drop bits below `from`
+    var inverted: u8 = ~bitmap[byte_idx] & (@as(u8, 0xff) << @intCast(from & 7));
+
+    const last_byte = (count - 1) >> 3;
+    while (true) {
+        if (inverted != 0) {
+            const index = (byte_idx << 3) + @ctz(inverted);
+            return if (index < count) index else null;
+        }
+        byte_idx += 1;
+        if (byte_idx > last_byte) return null;
+
+        // Skip fully valid words quickly
+        while (byte_idx + 8 <= last_byte + 1 and
+            std.mem.readInt(u64, bitmap[byte_idx..][0..8], .little) == std.math.maxInt(u64))
+        {
+            byte_idx += 8;
+        }
+        if (byte_idx > last_byte) return null;
+        inverted = ~bitmap[byte_idx];
+    }
+}
+
+/// Index of the first invalid item, or null if all are valid
+pub fn firstInvalid(bitmap: []const u8, count: usize) ?usize {
+    return nextInvalid(bitmap, count, 0);
+}
+
+/// Iterates indices of invalid items in ascending order
+pub const InvalidIterator = struct {
+    bitmap: []const u8,
+    count: usize,
+    index: usize = 0,
+
+    pub fn next(self: *InvalidIterator) ?usize {
+        const found = nextInvalid(self.bitmap, self.count, self.index) orelse {
+            self.index = self.count;
+            return null;
+        };
+        self.index = found + 1;
+        return found;
+    }
+};
+
+pub fn invalidIterator(bitmap: []const u8, count: usize) InvalidIterator {
+    return .{ .bitmap = bitmap, .count = count };
+}
+
+/// Copy `count` results from `src` (starting at bit 0) into `dst` at bit
+/// `dst_offset`; bits of `dst` past the copied range are left alone
+pub fn copyBits(dst: []u8, dst_offset: usize, src: []const u8, count: usize) void {
+    if (count == 0) return;
+    if (dst_offset & 7 == 0) {
+        const full = count >> 3;
+        @memcpy(dst[dst_offset >> 3 ..][0..full], src[0..full]);
+        for (full << 3..count) |i| set(dst, dst_offset + i, isValid(src, i));
+        return;
+    }
+    for (0..count) |i| set(dst, dst_offset + i, isValid(src, i));
+}
+
+test "pack and count" {
+    const results = [_]u8{ 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 1 };
+    var bitmap: [byteLen(results.len)]u8 = undefined;
+
+    const valid_count = pack(&results, &bitmap);
+
+    try std.testing.expectEqual(@as(usize, 9), valid_count);
+    try std.testing.expectEqual(valid_count, countValid(&bitmap, results.len));
+    try std.testing.expectEqual(@as(u8, 0b1111_1011), bitmap[0]);
+    try std.testing.expectEqual(@as(u8, 0b101), bitmap[1]);
+    for (results, 0..) |r, i| {
+        try std.testing.expectEqual(r == 1, isValid(&bitmap, i));
+    }
+}
+
+test "invalid index iteration" {
+    const count = 150;
+    var bitmap = [_]u8{0xff} ** byteLen(count);
+    bitmap[byteLen(count) - 1] = 0x3f; // bits past count stay 0
+    set(&bitmap, 3, false);
+    set(&bitmap, 97, false);
+    set(&bitmap, 149, false);
+
+    try std.testing.expectEqual(@as(?usize, 3), firstInvalid(&bitmap, count));
+
+    var it = invalidIterator(&bitmap, count);
+    try std.testing.expectEqual(@as(?usize, 3), it.next());
+    try std.testing.expectEqual(@as(?usize, 97), it.next());
+    try std.testing.expectEqual(@as(?usize, 149), it.next());
+    try std.testing.expectEqual(@as(?usize, null), it.next());
+}
+
+test "copyBits at aligned and unaligned offsets" {
+    const src = [_]u8{ 0b1010_1101, 0b11 };
+    var dst = [_]u8{0} ** 4;
+
+    copyBits(&dst, 8, &src, 10);
+    try std.testing.expectEqualSlices(u8, &.{ 0, 0b1010_1101, 0b11, 0 }, &dst);
+
+    @memset(&dst, 0);
+    copyBits(&dst, 3, &src, 10);
+    for (0..10) |i| {
+        try std.testing.expectEqual(isValid(&src, i), isValid(&dst, i + 3));
+    }
+    try std.testing.expectEqual(@as(usize, 7), countValid(&dst, 32));
+}
@@ -4,6 +4,17 @@ const validator = @import("validator.zig");
 const batch = @import("batch_validator.zig");
 const validators_comp = @import("validators_comprehensive.zig");
 const json_validator = @import("json_batch_validator.zig");
+const columns = @import("column_validator.zig");
+const bitmap = @import("bitmap.zig");
+const files = @import("file_validator.zig");
+const codegen = @import("schema_codegen.zig");
+const regex = @import("regex.zig");
+const error_report = @import("error_report.zig");
+const generated = @import("generated_schemas");
+const stats = @import("stats.zig");
+
+/// Per-validator counters in stats.zig (`zig build -Dstats=true`)
+pub const satya_stats = @import("build_options").stats;
 
 // Export C-compatible functions
 export fn satya_validate_int(value: i64, min: i64, max: i64) i32 {
@@ -22,17 +33,7 @@ export fn satya_validate_string_length(str: [*:0]const u8, min_len: usize, max_l
 }
 
 export fn satya_validate_email(str: [*:0]const u8)  i32 {
-    const email = std.mem.span(str);
-    
-    // Simple email validation
-    const at_pos = std.mem.indexOf(u8, email, "@") orelse return 0;
-    if (at_pos == 0) return 0; // No local part
-    
-    const domain = email[at_pos + 1..];
-    if (domain.len == 0) return 0; // No domain
-    if (std.mem.indexOf(u8, domain, ".") == null) return 0; // No TLD
-    
-    return 1; // Valid
+    return if (validators_comp.validateEmail(std.mem.span(str))) 1 else 0;
 }
 
 // Batch validation for performance
@@ -43,13 +44,7 @@ export fn satya_validate_int_batch(
     max: i64,
     results: [*]u8,
 )  usize {
-    var valid_count: usize = 0;
-    for (0..count) |i| {
-        const is_valid = values[i] >= min and values[i] <= max;
-        results[i] = if (is_valid) 1 else 0;
-        if (is_valid) valid_count += 1;
-    }
-    return valid_count;
+    return batch.validateRangeBatch(i64, values[0..count], min, max, results[0..count]);
 }
 
 // Version info
@@ -276,3 +271,649 @@ export fn satya_validate_email_batch(
     const results_slice = results[0..count];
     return batch.validateEmailBatch(emails_slice, results_slice);
 }
+
+// ============================================================================
+// COLUMNAR MULTI-FIELD BATCH VALIDATION
+// ============================================================================
+
+/// Validate a batch laid out as flat columns (one per field)
+/// Safe to call without holding the GIL: only reads the column buffers.
+/// Batches large enough are sharded across up to `num_threads` workers.
+/// Returns number of valid items
+export fn satya_validate_columns(
+    cols: [*]const columns.Column,
+    num_columns: usize,
+    count: usize,
+    results: [*]u8,
+    num_threads: usize,
+) usize {
+    return columns.validateParallel(cols[0..num_columns], count, results[0..count], num_threads);
+}
+
+/// Number of logical CPUs (default worker count for satya_validate_columns)
+export fn satya_cpu_count() usize {
+    return std.Thread.getCpuCount() catch 1;
+}
+
+// ============================================================================
+// GENERATED SCHEMAS (zig build -Dschema=..., see schema_codegen.zig)
+// ============================================================================
+
+// satya_validate_<name>_batch / _batch_bitmap for every generated schema
+comptime {
+    codegen.exportAll(generated.schemas);
+}
+
+const generated_registry = codegen.registry(generated.schemas);
+
+/// Number of schemas compiled into this library
+export fn satya_generated_schema_count() usize {
+    return generated_registry.len;
+}
+
+/// Schema `index` (fields and kernel pointers), or null past the end
+export fn satya_generated_schema(index: usize) ?*const codegen.GeneratedSchema {
+    const entries: []const codegen.GeneratedSchema = &generated_registry;
+    if (index >= entries.len) return null;
+    return &entries[index];
+}
+
+// ============================================================================
+// PACKED ROWS (fixed-width records described by a schema, see batch_validator.zig)
+// ============================================================================
+
+/// Validate `count` rows of `stride` bytes each; String fields are
+/// (u32 offset, u32 len) pairs into `heap`. Writes one ValidationResult per row.
+/// Returns number of valid rows, -1 if a field does not fit in `stride`,
+/// -2 if a validator does not apply to its field's data type, -3 if `stride`
+/// is 0, -4 if `count * stride` overflows (`results` is not written on errors)
+export fn satya_validate_rows(
+    schema: [*]const batch.SchemaField,
+    num_fields: usize,
+    rows: [*]const u8,
+    count: usize,
+    stride: usize,
+    heap: ?[*]const u8,
+    heap_len: usize,
+    results: [*]batch.ValidationResult,
+) isize {
+    const rows_len = std.math.mul(usize, count, stride) catch return -4;
+    const validator_ctx = batch.BatchValidator.init(std.heap.smp_allocator, schema[0..num_fields]);
+    const row_batch = batch.RowBatch{
+        .rows = rows[0..rows_len],
+        .stride = stride,
+        .heap = if (heap) |h| h[0..heap_len] else "",
+    };
+    const valid_count = validator_ctx.validateRows(row_batch, results[0..count]) catch |err| return switch (err) {
+        error.FieldOutOfBounds => -1,
+        error.TypeMismatch => -2,
+        error.InvalidStride => -3,
+        error.LengthMismatch => unreachable,
+    };
+    return @intCast(valid_count);
+}
+
+// ============================================================================
+// BITMAP RESULTS (bit i of bitmap[i / 8] = item i valid, (count + 7) / 8 bytes)
+// ============================================================================
+
+/// satya_validate_int_batch with packed results
+export fn satya_validate_int_batch_bitmap(
+    values: [*]const i64,
+    count: usize,
+    min: i64,
+    max: i64,
+    bits: [*]u8,
+) usize {
+    return batch.validateRangeBitmap(i64, values[0..count], min, max, bits[0..bitmap.byteLen(count)]);
+}
+
+/// satya_validate_email_batch with packed results
+export fn satya_validate_email_batch_bitmap(
+    emails: [*]const [*:0]const u8,
+    count: usize,
+    bits: [*]u8,
+) usize {
+    return batch.validateEmailBatchBitmap(emails[0..count], bits[0..bitmap.byteLen(count)]);
+}
+
+/// satya_validate_columns with packed results
+export fn satya_validate_columns_bitmap(
+    cols: [*]const columns.Column,
+    num_columns: usize,
+    count: usize,
+    bits: [*]u8,
+    num_threads: usize,
+) usize {
+    return columns.validateParallelBitmap(cols[0..num_columns], count, bits[0..bitmap.byteLen(count)], num_threads);
+}
+
+/// Number of valid items in a bitmap
+export fn satya_bitmap_valid_count(bits: [*]const u8, count: usize) usize {
+    return bitmap.countValid(bits[0..bitmap.byteLen(count)], count);
+}
+
+/// Index of the first invalid item at or after `from`; returns `count` if none
+export fn satya_bitmap_next_invalid(bits: [*]const u8, count: usize, from: usize) usize {
+    return bitmap.nextInvalid(bits[0..bitmap.byteLen(count)], count, from) orelse count;
+}
+
+/// Index of the first invalid item; returns `count` if all are valid
+export fn satya_bitmap_first_invalid(bits: [*]const u8, count: usize) usize {
+    return satya_bitmap_next_invalid(bits, count, 0);
+}
+
+// ============================================================================
+// FLAT BUFFER / ARROW COLUMNS (zero-copy from NumPy, Arrow, array.array)
+// `validity` is an optional Arrow null bitmap (LSB-first, 0 = null = invalid).
+// `packed_results` selects a bitmap of (count + 7) / 8 bytes instead of a
+// byte per item. Returns number of valid items.
+// ============================================================================
+
+/// Validate an i64 buffer against any int kind
+/// A kind that is not an int kind marks every item invalid.
+export fn satya_validate_int_values(
+    kind: u8,
+    param1: i64,
+    param2: i64,
+    values: [*]const i64,
+    count: usize,
+    validity: ?[*]const u8,
+    results: [*]u8,
+    packed_results: bool,
+) usize {
+    const k: columns.Kind = @enumFromInt(kind);
+    if (packed_results) {
+        return columns.validateIntValues(.bitmap, k, param1, param2, values[0..count], validity, results[0..bitmap.byteLen(count)]);
+    }
+    return columns.validateIntValues(.bytes, k, param1, param2, values[0..count], validity, results[0..count]);
+}
+
+/// Validate an f64 buffer against [min, max]
+export fn satya_validate_float_range(
+    values: [*]const f64,
+    count: usize,
+    min: f64,
+    max: f64,
+    validity: ?[*]const u8,
+    results: [*]u8,
+    packed_results: bool,
+) usize {
+    if (packed_results) {
+        return columns.validateFloatRange(.bitmap, values[0..count], min, max, validity, results[0..bitmap.byteLen(count)]);
+    }
+    return columns.validateFloatRange(.bytes, values[0..count], min, max, validity, results[0..count]);
+}
+
+/// Check one UTF-8 string of `len` bytes against any string kind
+/// Same checks as the column kernels, without a NUL scan per call.
+/// Returns 1 if valid, 0 if invalid, -1 if `kind` is not a string kind.
+/// Substring and Pattern kinds need a needle or regex and always return 0;
+/// use satya_validate_string_column32/64 or satya_pattern_match for those.
+export fn satya_check_string(kind: u8, ptr: [*]const u8, len: usize, param1: i64, param2: i64) i32 {
+    const k: columns.Kind = @enumFromInt(kind);
+    if (!k.isString()) return -1;
+    return @intFromBool(columns.checkString(k, ptr[0..len], param1, param2));
+}
+
+/// Check `count` (pointer, length) strings against one string kind
+/// A kind that is not a string kind, or a substring / Pattern kind (no needle
+/// or regex here), marks every item invalid.
+export fn satya_check_strings(
+    kind: u8,
+    param1: i64,
+    param2: i64,
+    ptrs: [*]const [*]const u8,
+    lens: [*]const usize,
+    count: usize,
+    results: [*]u8,
+) usize {
+    const k: columns.Kind = @enumFromInt(kind);
+    var valid_count: usize = 0;
+    for (0..count) |i| {
+        const is_valid = columns.checkString(k, ptrs[i][0..lens[i]], param1, param2);
+        results[i] = @intFromBool(is_valid);
+        valid_count += @intFromBool(is_valid);
+    }
+    return valid_count;
+}
+
+fn validateStringOffsets(
+    comptime O: type,
+    kind: u8,
+    param1: i64,
+    param2: i64,
+    offsets: [*]const O,
+    count: usize,
+    data: [*]const u8,
+    data_len: usize,
+    validity: ?[*]const u8,
+    results: [*]u8,
+    packed_results: bool,
+) usize {
+    const k: columns.Kind = @enumFromInt(kind);
+    const offsets_slice = offsets[0 .. count + 1];
+    const data_slice = data[0..data_len];
+    if (packed_results) {
+        return columns.validateStringOffsets(O, .bitmap, k, param1, param2, offsets_slice, data_slice, validity, results[0..bitmap.byteLen(count)]);
+    }
+    return columns.validateStringOffsets(O, .bytes, k, param1, param2, offsets_slice, data_slice, validity, results[0..count]);
+}
+
+/// Validate an Arrow utf8 column (int32 offsets, count + 1 of them)
+export fn satya_validate_string_offsets32(
+    kind: u8,
+    param1: i64,
+    param2: i64,
+    offsets: [*]const i32,
+    count: usize,
+    data: [*]const u8,
+    data_len: usize,
+    validity: ?[*]const u8,
+    results: [*]u8,
+    packed_results: bool,
+) usize {
+    return validateStringOffsets(i32, kind, param1, param2, offsets, count, data, data_len, validity, results, packed_results);
+}
+
+/// Validate an Arrow large_utf8 column (int64 offsets, count + 1 of them)
+export fn satya_validate_string_offsets64(
+    kind: u8,
+    param1: i64,
+    param2: i64,
+    offsets: [*]const i64,
+    count: usize,
+    data: [*]const u8,
+    data_len: usize,
+    validity: ?[*]const u8,
+    results: [*]u8,
+    packed_results: bool,
+) usize {
+    return validateStringOffsets(i64, kind, param1, param2, offsets, count, data, data_len, validity, results, packed_results);
+}
+
+/// Validate an Arrow utf8 column (int32 offsets) against any string kind,
+/// including the substring and pattern kinds (needle / pattern in `spec`);
+/// packed results
+export fn satya_validate_string_column32(
+    spec: *const columns.StringSpec,
+    offsets: [*]const i32,
+    count: usize,
+    data: [*]const u8,
+    data_len: usize,
+    validity: ?[*]const u8,
+    bits: [*]u8,
+) usize {
+    return columns.validateStringColumn(i32, .bitmap, spec.*, offsets[0 .. count + 1], data[0..data_len], validity, bits[0..bitmap.byteLen(count)]);
+}
+
+/// Same as satya_validate_string_column32 with int64 offsets (large_utf8)
+export fn satya_validate_string_column64(
+    spec: *const columns.StringSpec,
+    offsets: [*]const i64,
+    count: usize,
+    data: [*]const u8,
+    data_len: usize,
+    validity: ?[*]const u8,
+    bits: [*]u8,
+) usize {
+    return columns.validateStringColumn(i64, .bitmap, spec.*, offsets[0 .. count + 1], data[0..data_len], validity, bits[0..bitmap.byteLen(count)]);
+}
+
+// ============================================================================
+// STREAMING JSON BATCH VALIDATION (raw request bodies, no DOM)
+// ============================================================================
+
+/// Field spec for satya_validate_json_array; `kind` uses the column numbering
+pub const JsonFieldSpec = extern struct {
+    name: [*]const u8,
+    name_len: usize,
+    kind: columns.Kind,
+    param1: i64,
+    param2: i64,
+    /// Pattern kind: from satya_pattern_compile / satya_pattern_cache_get
+    pattern: ?*const regex.Regex,
+};
+
+fn jsonValidatorType(kind: columns.Kind) ?json_validator.ValidatorType {
+    return switch (kind) {
+        .Int => .Int,
+        .IntGt => .IntGt,
+        .IntGte => .IntGte,
+        .IntLt => .IntLt,
+        .IntLte => .IntLte,
+        .IntPositive => .IntPositive,
+        .IntNonNegative => .IntNonNegative,
+        .IntMultipleOf => .IntMultipleOf,
+        .String => .String,
+        .Email => .Email,
+        .Url => .Url,
+        .Uuid => .Uuid,
+        .Ipv4 => .Ipv4,
+        .Base64 => .Base64,
+        .IsoDate => .IsoDate,
+        .IsoDatetime => .IsoDatetime,
+        .Pattern => .Pattern,
+        // Substring kinds need a needle, which JSON field specs don't carry
+        .Contains, .StartsWith, .EndsWith, _ => null,
+    };
+}
+
+/// Errors returned (negated) by satya_validate_json_array
+pub const JsonBatchError = enum(isize) {
+    invalid_json = -1,
+    out_of_memory = -2,
+    too_many_fields = -3,
+    file_not_found = -4,
+    io_error = -5,
+};
+
+/// Convert C specs, dropping unknown kinds; null if more than max_fields remain
+/// `spec_index`, when given, receives the position in `specs` of each kept spec.
+fn toJsonFieldSpecs(
+    specs: []const JsonFieldSpec,
+    out: *[json_validator.max_fields]json_validator.FieldSpec,
+    spec_index: ?*[json_validator.max_fields]u16,
+) ?usize {
+    var num_fields: usize = 0;
+    for (specs, 0..) |spec, i| {
+        const validator_type = jsonValidatorType(spec.kind) orelse continue;
+        if (num_fields == out.len) return null;
+        if (spec_index) |index| index[num_fields] = std.math.cast(u16, i) orelse return null;
+        out[num_fields] = .{
+            .name = spec.name[0..spec.name_len],
+            .validator_type = validator_type,
+            .param1 = spec.param1,
+            .param2 = spec.param2,
+            .pattern = spec.pattern,
+        };
+        num_fields += 1;
+    }
+    return num_fields;
+}
+
+/// Validate a JSON array of objects straight from its bytes
+/// Writes 0/1 per element into results (up to max_results; elements past
+/// that are still counted). Fields with unknown kinds are ignored.
+/// Returns number of elements, or a negative JsonBatchError
+export fn satya_validate_json_array(
+    json: [*]const u8,
+    json_len: usize,
+    specs: [*]const JsonFieldSpec,
+    num_specs: usize,
+    results: [*]u8,
+    max_results: usize,
+) isize {
+    var field_specs: [json_validator.max_fields]json_validator.FieldSpec = undefined;
+    const num_fields = toJsonFieldSpecs(specs[0..num_specs], &field_specs, null) orelse
+        return @intFromEnum(JsonBatchError.too_many_fields);
+
+    const Sink = struct {
+        results: []u8,
+
+        pub fn put(self: *@This(), index: usize, result: json_validator.ValidationResult) !void {
+            if (index < self.results.len) self.results[index] = @intFromBool(result.is_valid);
+        }
+    };
+    var sink: Sink = .{ .results = results[0..max_results] };
+
+    const count = json_validator.validateJsonArrayStream(
+        json[0..json_len],
+        field_specs[0..num_fields],
+        std.heap.smp_allocator,
+        &sink,
+    ) catch |err| return @intFromEnum(switch (err) {
+        error.OutOfMemory => JsonBatchError.out_of_memory,
+        error.TooManyFields => JsonBatchError.too_many_fields,
+        else => JsonBatchError.invalid_json,
+    });
+    return @intCast(count);
+}
+
+/// Packed results of satya_validate_file; release with satya_free_file_result
+pub const FileValidationResult = extern struct {
+    bits: ?[*]u8,
+    count: usize,
+    valid_count: usize,
+};
+
+/// Validate a JSON array or NDJSON file through a read-only memory mapping
+/// mode: 0 = auto, 1 = JSON array, 2 = NDJSON (split across up to
+/// max_threads threads at line boundaries). Malformed NDJSON lines are
+/// invalid records; a malformed JSON array fails the whole call.
+/// Returns number of records, or a negative JsonBatchError
+export fn satya_validate_file(
+    path: [*]const u8,
+    path_len: usize,
+    specs: [*]const JsonFieldSpec,
+    num_specs: usize,
+    mode: u8,
+    max_threads: usize,
+    out: *FileValidationResult,
+) isize {
+    out.* = .{ .bits = null, .count = 0, .valid_count = 0 };
+
+    var field_specs: [json_validator.max_fields]json_validator.FieldSpec = undefined;
+    const num_fields = toJsonFieldSpecs(specs[0..num_specs], &field_specs, null) orelse
+        return @intFromEnum(JsonBatchError.too_many_fields);
+    const file_mode = std.meta.intToEnum(files.Mode, mode) catch files.Mode.auto;
+
+    const result = files.validateFile(
+        std.heap.smp_allocator,
+        path[0..path_len],
+        field_specs[0..num_fields],
+        file_mode,
+        @max(max_threads, 1),
+    ) catch |err| return @intFromEnum(switch (err) {
+        error.OutOfMemory => JsonBatchError.out_of_memory,
+        error.TooManyFields => JsonBatchError.too_many_fields,
+        error.FileNotFound => JsonBatchError.file_not_found,
+        error.ReadFailed, error.FileTooBig => JsonBatchError.io_error,
+        else => JsonBatchError.invalid_json,
+    });
+
+    out.* = .{
+        .bits = if (result.bits.len > 0) result.bits.ptr else null,
+        .count = result.count,
+        .valid_count = result.valid_count,
+    };
+    return @intCast(result.count);
+}
+
+export fn satya_free_file_result(result: *FileValidationResult) void {
+    if (result.bits) |bits| std.heap.smp_allocator.free(bits[0..bitmap.byteLen(result.count)]);
+    result.* = .{ .bits = null, .count = 0, .valid_count = 0 };
+}
+
+/// Every violation of a batch (layout in error_report.zig); release with
+/// satya_free_error_report
+pub const ErrorReportResult = extern struct {
+    /// violations * 11 bytes, null when there are none
+    data: ?[*]u8,
+    violations: usize,
+    count: usize,
+    valid_count: usize,
+};
+
+/// Like satya_validate_json_array, but records every failing field of every
+/// element instead of one valid/invalid flag. field_index refers to `specs`
+/// (including specs with unknown kinds, which never fail).
+/// Returns number of elements, or a negative JsonBatchError
+export fn satya_validate_json_array_errors(
+    json: [*]const u8,
+    json_len: usize,
+    specs: [*]const JsonFieldSpec,
+    num_specs: usize,
+    out: *ErrorReportResult,
+) isize {
+    out.* = .{ .data = null, .violations = 0, .count = 0, .valid_count = 0 };
+    const allocator = std.heap.smp_allocator;
+
+    var field_specs: [json_validator.max_fields]json_validator.FieldSpec = undefined;
+    var spec_index: [json_validator.max_fields]u16 = undefined;
+    const num_fields = toJsonFieldSpecs(specs[0..num_specs], &field_specs, &spec_index) orelse
+        return @intFromEnum(JsonBatchError.too_many_fields);
+
+    var report: error_report.ErrorReport = .{};
+    defer report.deinit(allocator);
+    const count = json_validator.validateJsonArrayErrors(
+        json[0..json_len],
+        field_specs[0..num_fields],
+        allocator,
+        &report,
+    ) catch |err| return @intFromEnum(switch (err) {
+        error.OutOfMemory => JsonBatchError.out_of_memory,
+        error.TooManyFields => JsonBatchError.too_many_fields,
+        else => JsonBatchError.invalid_json,
+    });
+
+    // Map compacted field indices back to the caller's spec indices; items
+    // are in order, so each new item_index is one more invalid item
+    const slice = report.list.slice();
+    const items = slice.items(.item_index);
+    var invalid_items: usize = 0;
+    for (slice.items(.field_index), items, 0..) |*field, item, v| {
+        if (field.* != error_report.no_field) field.* = spec_index[field.*];
+        if (v == 0 or items[v - 1] != item) invalid_items += 1;
+    }
+
+    const data = if (report.len() > 0)
+        (report.pack(allocator) catch return @intFromEnum(JsonBatchError.out_of_memory)).ptr
+    else
+        null;
+    out.* = .{ .data = data, .violations = report.len(), .count = count, .valid_count = count - invalid_items };
+    return @intCast(count);
+}
+
+export fn satya_free_error_report(result: *ErrorReportResult) void {
+    if (result.data) |data| std.heap.smp_allocator.free(data[0 .. result.violations * error_report.bytes_per_violation]);
+    result.* = .{ .data = null, .violations = 0, .count = 0, .valid_count = 0 };
+}
+
+// ============================================================================
+// REGEX PATTERNS (compiled to a DFA once, see regex.zig)
+// ============================================================================
+
+/// Status written by satya_pattern_compile / satya_pattern_cache_get
+pub const PatternStatus = enum(i32) {
+    ok = 0,
+    invalid_pattern = 1,
+    unsupported_syntax = 2,
+    too_complex = 3,
+    out_of_memory = 4,
+};
+
+fn patternStatus(err: regex.Error) PatternStatus {
+    return switch (err) {
+        error.InvalidPattern => .invalid_pattern,
+        error.UnsupportedSyntax => .unsupported_syntax,
+        error.PatternTooComplex => .too_complex,
+        error.OutOfMemory => .out_of_memory,
+    };
+}
+
+/// Compile `pattern`; null on failure (reason in `status` when given)
+/// Free with satya_pattern_free
+export fn satya_pattern_compile(pattern: [*]const u8, len: usize, status: ?*PatternStatus) ?*regex.Regex {
+    const allocator = std.heap.smp_allocator;
+    const re = allocator.create(regex.Regex) catch {
+        if (status) |s| s.* = .out_of_memory;
+        return null;
+    };
+    re.* = regex.compile(allocator, pattern[0..len]) catch |err| {
+        allocator.destroy(re);
+        if (status) |s| s.* = patternStatus(err);
+        return null;
+    };
+    if (status) |s| s.* = .ok;
+    return re;
+}
+
+export fn satya_pattern_free(re: ?*regex.Regex) void {
+    const compiled = re orelse return;
+    compiled.deinit(std.heap.smp_allocator);
+    std.heap.smp_allocator.destroy(compiled);
+}
+
+/// 1 if the `len` bytes at `ptr` match, else 0
+export fn satya_pattern_match(re: *const regex.Regex, ptr: [*]const u8, len: usize) i32 {
+    return @intFromBool(re.isMatch(ptr[0..len]));
+}
+
+/// Pattern cache for one schema: each distinct pattern is compiled once and
+/// lives until satya_pattern_cache_free. Not thread-safe (matching is).
+export fn satya_pattern_cache_new() ?*regex.Cache {
+    const cache = std.heap.smp_allocator.create(regex.Cache) catch return null;
+    cache.* = regex.Cache.init(std.heap.smp_allocator);
+    return cache;
+}
+
+/// Compiled `pattern`, owned by the cache; null on failure (reason in `status`)
+export fn satya_pattern_cache_get(cache: *regex.Cache, pattern: [*]const u8, len: usize, status: ?*PatternStatus) ?*const regex.Regex {
+    const re = cache.get(pattern[0..len]) catch |err| {
+        if (status) |s| s.* = patternStatus(err);
+        return null;
+    };
+    if (status) |s| s.* = .ok;
+    return re;
+}
+
+export fn satya_pattern_cache_free(cache: ?*regex.Cache) void {
+    const c = cache orelse return;
+    c.deinit();
+    std.heap.smp_allocator.destroy(c);
+}
+
+// ============================================================================
+// INSTRUMENTATION (zig build -Dstats=true, see stats.zig)
+// Slots use the column kind numbering for 0-19; names via satya_stats_slot_name.
+// Without the build option every call below is a no-op and snapshots are empty.
+// ============================================================================
+
+/// Whether this library was built with counters
+export fn satya_stats_enabled() bool {
+    return stats.enabled;
+}
+
+export fn satya_stats_slot_count() usize {
+    return stats.slot_count;
+}
+
+/// snake_case name of `slot`, or null past the end
+export fn satya_stats_slot_name(slot: usize) ?[*:0]const u8 {
+    if (slot >= stats.slot_count) return null;
+    return stats.slot_names[slot].ptr;
+}
+
+/// Totals of every thread into out[0..len]; returns the number of slots written
+/// (0 when built without counters)
+export fn satya_stats_snapshot(out: [*]stats.Snapshot, len: usize) usize {
+    if (!stats.enabled) return 0;
+    return stats.registry.snapshot(out[0..len]);
+}
+
+export fn satya_stats_reset() void {
+    if (stats.enabled) stats.registry.reset();
+}
+
+/// Result cache lookups and hits since the last reset; false (and zeros)
+/// when built without counters
+export fn satya_stats_memo(out: *stats.MemoSnapshot) bool {
+    out.* = if (comptime stats.enabled) stats.registry.memoSnapshot() else .{ .lookups = 0, .hits = 0 };
+    return stats.enabled;
+}
+
+/// Report a binding-side result cache's lookups and hits for one batch
+export fn satya_stats_memo_record(lookups: usize, hits: usize) void {
+    stats.memo(lookups, hits);
+}
+
+/// Hooks for checks done by the bindings themselves: pass the result of
+/// satya_stats_begin to satya_stats_end with the check's slot and outcome
+export fn satya_stats_begin() u64 {
+    return if (comptime stats.enabled) stats.begin() else 0;
+}
+
+export fn satya_stats_end(slot: u8, ok: bool, probe: u64) void {
+    if (comptime stats.enabled) stats.end(std.meta.intToEnum(stats.Slot, slot) catch null, ok, probe);
+}
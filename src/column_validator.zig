@@ -0,0 +1,634 @@
+/// Columnar multi-field batch validation
+/// Callers copy the field values out of their own objects into flat columns
+/// (i64s, UTF-8 pointer/length pairs), so the checks never touch the host
+/// runtime and can run with the GIL released, sharded across worker threads.
+const std = @import("std");
+const builtin = @import("builtin");
+const validators = @import("validators_comprehensive.zig");
+const batch = @import("batch_validator.zig");
+const regex = @import("regex.zig");
+const stats = @import("stats.zig");
+
+/// Validator kind for a column
+/// Values must match `enum ValidatorType` in python-bindings/dhi/_native.c
+pub const Kind = enum(u8) {
+    Int = 0,
+    IntGt,
+    IntGte,
+    IntLt,
+    IntLte,
+    IntPositive,
+    IntNonNegative,
+    IntMultipleOf,
+    String,
+    Email,
+    Url,
+    Uuid,
+    Ipv4,
+    Base64,
+    IsoDate,
+    IsoDatetime,
+    // Substring kinds compare against StringSpec.needle (string columns only)
+    Contains,
+    StartsWith,
+    EndsWith,
+    // Matches a compiled regex (StringSpec.pattern / Column.pattern)
+    Pattern,
+    _,
+
+    pub fn isInt(self: Kind) bool {
+        return @intFromEnum(self) <= @intFromEnum(Kind.IntMultipleOf);
+    }
+
+    pub fn isString(self: Kind) bool {
+        return !self.isInt() and @intFromEnum(self) <= @intFromEnum(Kind.Pattern);
+    }
+};
+
+/// Check for one string column (see validateStringColumn)
+pub const StringSpec = extern struct {
+    kind: Kind,
+    /// String: min / max byte length
+    param1: i64 = 0,
+    param2: i64 = 0,
+    /// Contains, StartsWith, EndsWith
+    needle: ?[*]const u8 = null,
+    needle_len: usize = 0,
+    /// Pattern: borrowed, must outlive the call
+    pattern: ?*const regex.Regex = null,
+    /// Cache results of repeated values within one call (see Memo)
+    memo: bool = false,
+
+    pub inline fn check(self: StringSpec, str: []const u8) bool {
+        const needle = if (self.needle) |n| n[0..self.needle_len] else "";
+        return switch (self.kind) {
+            .Contains => std.mem.indexOf(u8, str, needle) != null,
+            .StartsWith => std.mem.startsWith(u8, str, needle),
+            .EndsWith => std.mem.endsWith(u8, str, needle),
+            .Pattern => if (self.pattern) |re| re.isMatch(str) else false,
+            else => checkString(self.kind, str, self.param1, self.param2),
+        };
+    }
+};
+
+/// One field of a batch, laid out column-major (index i = item i)
+pub const Column = extern struct {
+    kind: Kind,
+    param1: i64,
+    param2: i64,
+
+    // Int kinds: one value per item
+    ints: ?[*]const i64,
+
+    // String kinds: UTF-8 pointer and byte length per item
+    str_ptrs: ?[*]const [*]const u8,
+    str_lens: ?[*]const usize,
+
+    // Optional per-item flag; 0 marks a missing or mistyped value (always invalid)
+    present: ?[*]const u8,
+
+    // Pattern kind: compiled regex (borrowed)
+    pattern: ?*const regex.Regex = null,
+};
+
+/// Batches are split so each worker gets at least this many items;
+/// anything smaller stays on the calling thread
+pub const min_items_per_thread: usize = 4096;
+
+/// Upper bound on shards per call (results of each shard are kept on the stack)
+pub const max_shards: usize = 256;
+
+/// Integer check for a single value (string and unknown kinds reject it)
+pub inline fn checkInt(kind: Kind, value: i64, param1: i64, param2: i64) bool {
+    return switch (kind) {
+        .Int => value >= param1 and value <= param2,
+        .IntGt => validators.validateGt(i64, value, param1),
+        .IntGte => validators.validateGte(i64, value, param1),
+        .IntLt => validators.validateLt(i64, value, param1),
+        .IntLte => validators.validateLte(i64, value, param1),
+        .IntPositive => validators.validatePositive(i64, value),
+        .IntNonNegative => validators.validateNonNegative(i64, value),
+        .IntMultipleOf => validators.validateMultipleOf(i64, value, param1),
+        else => false,
+    };
+}
+
+/// String check for a single value (int and unknown kinds reject it)
+pub inline fn checkString(kind: Kind, str: []const u8, param1: i64, param2: i64) bool {
+    return switch (kind) {
+        .String => str.len >= lenParam(param1) and str.len <= lenParam(param2),
+        .Email => validators.validateEmail(str),
+        .Url => validators.validateUrl(str),
+        .Uuid => validators.validateUuid(str),
+        .Ipv4 => validators.validateIpv4(str),
+        .Base64 => validators.validateBase64(str),
+        .IsoDate => validators.validateIsoDate(str),
+        .IsoDatetime => validators.validateIsoDatetime(str),
+        // Need a needle or the compiled regex, see StringSpec / Column
+        .Contains, .StartsWith, .EndsWith, .Pattern => false,
+        else => false,
+    };
+}
+
+/// Kinds that cost more than hashing and comparing the value, so repeated
+/// values are worth caching
+pub fn isMemoized(kind: Kind) bool {
+    return switch (kind) {
+        .Email, .Url, .Uuid, .Base64, .IsoDate, .IsoDatetime, .Pattern => true,
+        else => false,
+    };
+}
+
+/// Per-call cache of string check results for low-cardinality columns,
+/// direct-mapped by content hash. Entries are slices of the caller's data,
+/// so a Memo must not outlive the call that filled it.
+pub const Memo = struct {
+    const slots = 256;
+
+    const Entry = struct {
+        str: []const u8 = "",
+        hash: u64 = 0,
+        used: bool = false,
+        ok: bool = false,
+    };
+
+    entries: [slots]Entry = [_]Entry{.{}} ** slots,
+    lookups: usize = 0,
+    hits: usize = 0,
+
+    pub fn check(self: *Memo, spec: StringSpec, str: []const u8) bool {
+        const hash = std.hash.Wyhash.hash(0, str);
+        const entry = &self.entries[hash % slots];
+        self.lookups += 1;
+        if (entry.used and entry.hash == hash and std.mem.eql(u8, entry.str, str)) {
+            self.hits += 1;
+            return entry.ok;
+        }
+        const ok = spec.check(str);
+        entry.* = .{ .str = str, .hash = hash, .used = true, .ok = ok };
+        return ok;
+    }
+};
+
+/// String check for one value of `col`
+inline fn checkColumnString(col: Column, str: []const u8) bool {
+    if (col.kind == .Pattern) return if (col.pattern) |re| re.isMatch(str) else false;
+    return checkString(col.kind, str, col.param1, col.param2);
+}
+
+/// Negative length bounds clamp to 0
+inline fn lenParam(param: i64) usize {
+    return if (param < 0) 0 else @intCast(param);
+}
+
+/// Validate item `i` across all columns (stops at the first failing field)
+fn validateRow(columns: []const Column, i: usize) bool {
+    for (columns) |col| {
+        if (col.present) |present| {
+            if (present[i] == 0) return false;
+        }
+        const probe = stats.begin();
+        const is_valid = if (col.kind.isInt())
+            checkInt(col.kind, col.ints.?[i], col.param1, col.param2)
+        else
+            checkColumnString(col, col.str_ptrs.?[i][0..col.str_lens.?[i]]);
+        stats.end(stats.slotOf(col.kind), is_valid, probe);
+        if (!is_valid) return false;
+    }
+    return true;
+}
+
+/// Validate items [start, end) and write 0/1 into results[start..end]
+/// Returns number of valid items in the range
+pub fn validateRange(columns: []const Column, start: usize, end: usize, results: []u8) usize {
+    var valid_count: usize = 0;
+    for (start..end) |i| {
+        const is_valid = validateRow(columns, i);
+        results[i] = @intFromBool(is_valid);
+        valid_count += @intFromBool(is_valid);
+    }
+    return valid_count;
+}
+
+/// Validate items [start, end) into a packed bitmap (see bitmap.zig)
+/// `start` must be a multiple of 8 so shards never share a byte.
+/// Returns number of valid items in the range
+pub fn validateRangeBitmap(columns: []const Column, start: usize, end: usize, bitmap: []u8) usize {
+    std.debug.assert(start % 8 == 0 or start == end);
+    var valid_count: usize = 0;
+    var byte: u8 = 0;
+    for (start..end) |i| {
+        const is_valid = validateRow(columns, i);
+        byte |= @as(u8, @intFromBool(is_valid)) << @intCast(i & 7);
+        valid_count += @intFromBool(is_valid);
+        if (i & 7 == 7) {
+            bitmap[i >> 3] = byte;
+            byte = 0;
+        }
+    }
+    if (end & 7 != 0 and end > start) bitmap[end >> 3] = byte;
+    return valid_count;
+}
+
+/// Result layout written by the parallel entry points
+pub const Output = enum { bytes, bitmap };
+
+// Shared worker pool, started on first parallel batch
+var pool: std.Thread.Pool = undefined;
+var pool_ready = false;
+var pool_once = std.once(initPool);
+
+fn initPool() void {
+    pool.init(.{ .allocator = std.heap.smp_allocator }) catch return;
+    pool_ready = true;
+}
+
+fn runRange(comptime output: Output, columns: []const Column, start: usize, end: usize, out: []u8) usize {
+    return switch (output) {
+        .bytes => validateRange(columns, start, end, out),
+        .bitmap => validateRangeBitmap(columns, start, end, out),
+    };
+}
+
+fn Shard(comptime output: Output) type {
+    return struct {
+        fn run(columns: []const Column, start: usize, end: usize, out: []u8, valid_count: *usize) void {
+            valid_count.* = runRange(output, columns, start, end, out);
+        }
+    };
+}
+
+fn validateSharded(comptime output: Output, columns: []const Column, count: usize, out: []u8, max_threads: usize) usize {
+    const shards = @min(@min(max_threads, count / min_items_per_thread), max_shards);
+    if (builtin.single_threaded or shards <= 1) {
+        return runRange(output, columns, 0, count, out);
+    }
+
+    pool_once.call();
+    if (!pool_ready) return runRange(output, columns, 0, count, out);
+
+    var shard_counts: [max_shards]usize = undefined;
+    var wait_group: std.Thread.WaitGroup = .{};
+    // Round shards up to whole bitmap bytes
+    const per_shard = std.mem.alignForward(usize, (count + shards - 1) / shards, 8);
+
+    for (1..shards) |s| {
+        const start = @min(count, s * per_shard);
+        const end = @min(count, start + per_shard);
+        pool.spawnWg(&wait_group, Shard(output).run, .{ columns, start, end, out, &shard_counts[s] });
+    }
+    shard_counts[0] = runRange(output, columns, 0, @min(count, per_shard), out);
+    pool.waitAndWork(&wait_group);
+
+    var valid_count: usize = 0;
+    for (shard_counts[0..shards]) |c| valid_count += c;
+    return valid_count;
+}
+
+/// Validate `count` items using up to `max_threads` workers (the calling
+/// thread takes the first shard). Small batches run single-threaded.
+/// Returns number of valid items
+pub fn validateParallel(columns: []const Column, count: usize, results: []u8, max_threads: usize) usize {
+    return validateSharded(.bytes, columns, count, results, max_threads);
+}
+
+/// Same as validateParallel, writing a packed bitmap of (count + 7) / 8 bytes
+pub fn validateParallelBitmap(columns: []const Column, count: usize, bitmap: []u8, max_threads: usize) usize {
+    return validateSharded(.bitmap, columns, count, bitmap, max_threads);
+}
+
+// ============================================================================
+// Flat buffers (NumPy arrays, Arrow columns): no per-item pointers
+// ============================================================================
+
+/// Writes per-item results in either output layout
+fn ResultWriter(comptime output: Output) type {
+    return struct {
+        out: []u8,
+        byte: u8 = 0,
+        valid_count: usize = 0,
+
+        inline fn put(self: *@This(), i: usize, is_valid: bool) void {
+            self.valid_count += @intFromBool(is_valid);
+            switch (output) {
+                .bytes => self.out[i] = @intFromBool(is_valid),
+                .bitmap => {
+                    self.byte |= @as(u8, @intFromBool(is_valid)) << @intCast(i & 7);
+                    if (i & 7 == 7) {
+                        self.out[i >> 3] = self.byte;
+                        self.byte = 0;
+                    }
+                },
+            }
+        }
+
+        fn finish(self: *@This(), count: usize) usize {
+            if (output == .bitmap and count & 7 != 0) self.out[count >> 3] = self.byte;
+            return self.valid_count;
+        }
+    };
+}
+
+/// Arrow-style validity bitmap: 0 bit = null (always invalid)
+inline fn isPresent(validity: ?[*]const u8, i: usize) bool {
+    const v = validity orelse return true;
+    return (v[i >> 3] >> @intCast(i & 7)) & 1 == 1;
+}
+
+/// Clear results of null items after a kernel that ignored validity
+/// Returns the new number of valid items
+fn maskNulls(comptime output: Output, validity: [*]const u8, count: usize, out: []u8) usize {
+    var valid_count: usize = 0;
+    switch (output) {
+        .bytes => for (out[0..count], 0..) |*r, i| {
+            r.* &= @intFromBool(isPresent(validity, i));
+            valid_count += r.*;
+        },
+        .bitmap => for (out[0..(count + 7) / 8], 0..) |*b, byte| {
+            // Validity may have garbage past count; our bits there are already 0
+            b.* &= validity[byte];
+            valid_count += @popCount(b.*);
+        },
+    }
+    return valid_count;
+}
+
+/// Validate a flat i64 column (e.g. a NumPy int64 array) against an int kind
+/// Returns number of valid items
+pub fn validateIntValues(
+    comptime output: Output,
+    kind: Kind,
+    param1: i64,
+    param2: i64,
+    values: []const i64,
+    validity: ?[*]const u8,
+    out: []u8,
+) usize {
+    const probe = stats.start();
+    const valid_count = intValues(output, kind, param1, param2, values, validity, out);
+    stats.column(stats.slotOf(kind), values.len, valid_count, probe);
+    return valid_count;
+}
+
+fn intValues(
+    comptime output: Output,
+    kind: Kind,
+    param1: i64,
+    param2: i64,
+    values: []const i64,
+    validity: ?[*]const u8,
+    out: []u8,
+) usize {
+    // Plain range: vectorized kernel, then drop nulls
+    if (kind == .Int) {
+        const valid_count = switch (output) {
+            .bytes => batch.validateRangeBatch(i64, values, param1, param2, out),
+            .bitmap => batch.validateRangeBitmap(i64, values, param1, param2, out),
+        };
+        const v = validity orelse return valid_count;
+        return maskNulls(output, v, values.len, out);
+    }
+
+    var writer: ResultWriter(output) = .{ .out = out };
+    for (values, 0..) |value, i| {
+        writer.put(i, isPresent(validity, i) and checkInt(kind, value, param1, param2));
+    }
+    return writer.finish(values.len);
+}
+
+/// Validate a flat f64 column against [min, max] (NaN is invalid)
+/// Returns number of valid items
+pub fn validateFloatRange(
+    comptime output: Output,
+    values: []const f64,
+    min: f64,
+    max: f64,
+    validity: ?[*]const u8,
+    out: []u8,
+) usize {
+    const probe = stats.start();
+    var valid_count = switch (output) {
+        .bytes => batch.validateRangeBatch(f64, values, min, max, out),
+        .bitmap => batch.validateRangeBitmap(f64, values, min, max, out),
+    };
+    if (validity) |v| valid_count = maskNulls(output, v, values.len, out);
+    stats.column(.Float, values.len, valid_count, probe);
+    return valid_count;
+}
+
+/// String i of an Arrow-style column, or null if its offsets are out of bounds
+inline fn stringAt(comptime O: type, offsets: []const O, data: []const u8, i: usize) ?[]const u8 {
+    const start = std.math.cast(usize, offsets[i]) orelse return null;
+    const end = std.math.cast(usize, offsets[i + 1]) orelse return null;
+    if (end < start or end > data.len) return null;
+    return data[start..end];
+}
+
+/// Validate an Arrow-style string column: item i is data[offsets[i]..offsets[i + 1]]
+/// `O` is i32 (utf8) or i64 (large_utf8); offsets.len is count + 1.
+/// Lengths are UTF-8 byte lengths. Malformed offsets make the item invalid.
+/// Returns number of valid items
+pub fn validateStringOffsets(
+    comptime O: type,
+    comptime output: Output,
+    kind: Kind,
+    param1: i64,
+    param2: i64,
+    offsets: []const O,
+    data: []const u8,
+    validity: ?[*]const u8,
+    out: []u8,
+) usize {
+    return validateStringColumn(O, output, .{ .kind = kind, .param1 = param1, .param2 = param2 }, offsets, data, validity, out);
+}
+
+/// Same as validateStringOffsets for any StringSpec, including substring kinds
+/// Items are consecutive slices of one buffer, so the column is read front to
+/// back (length bounds only touch the offsets).
+pub fn validateStringColumn(
+    comptime O: type,
+    comptime output: Output,
+    spec: StringSpec,
+    offsets: []const O,
+    data: []const u8,
+    validity: ?[*]const u8,
+    out: []u8,
+) usize {
+    const probe = stats.start();
+    const count = offsets.len -| 1;
+    var writer: ResultWriter(output) = .{ .out = out };
+    var memo: Memo = undefined;
+    const use_memo = spec.memo and isMemoized(spec.kind);
+    if (use_memo) memo = .{};
+    for (0..count) |i| {
+        const is_valid = isPresent(validity, i) and
+            if (stringAt(O, offsets, data, i)) |str| (if (use_memo) memo.check(spec, str) else spec.check(str)) else false;
+        writer.put(i, is_valid);
+    }
+    const valid_count = writer.finish(count);
+    stats.column(stats.slotOf(spec.kind), count, valid_count, probe);
+    if (use_memo) stats.memo(memo.lookups, memo.hits);
+    return valid_count;
+}
+
+test "validateRange - mixed columns" {
+    const ages = [_]i64{ 25, 15, 40 };
+    const emails = [_][*]const u8{ "a@b.co", "c@d.co", "nope" };
+    const email_lens = [_]usize{ 6, 6, 4 };
+    const columns = [_]Column{
+        .{ .kind = .Int, .param1 = 18, .param2 = 120, .ints = &ages, .str_ptrs = null, .str_lens = null, .present = null },
+        .{ .kind = .Email, .param1 = 0, .param2 = 0, .ints = null, .str_ptrs = &emails, .str_lens = &email_lens, .present = null },
+    };
+    var results: [3]u8 = undefined;
+
+    const valid_count = validateRange(&columns, 0, 3, &results);
+
+    try std.testing.expectEqual(@as(usize, 1), valid_count);
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 0 }, &results);
+}
+
+test "validateParallel - matches single-threaded" {
+    const count = min_items_per_thread * 4 + 7;
+    const values = try std.testing.allocator.alloc(i64, count);
+    defer std.testing.allocator.free(values);
+    for (values, 0..) |*v, i| v.* = @intCast(i % 100);
+
+    const columns = [_]Column{
+        .{ .kind = .Int, .param1 = 10, .param2 = 89, .ints = values.ptr, .str_ptrs = null, .str_lens = null, .present = null },
+    };
+    const serial = try std.testing.allocator.alloc(u8, count);
+    defer std.testing.allocator.free(serial);
+    const parallel = try std.testing.allocator.alloc(u8, count);
+    defer std.testing.allocator.free(parallel);
+
+    const serial_count = validateRange(&columns, 0, count, serial);
+    const parallel_count = validateParallel(&columns, count, parallel, 4);
+
+    try std.testing.expectEqual(serial_count, parallel_count);
+    try std.testing.expectEqualSlices(u8, serial, parallel);
+
+    const bits = try std.testing.allocator.alloc(u8, (count + 7) / 8);
+    defer std.testing.allocator.free(bits);
+    const bitmap_count = validateParallelBitmap(&columns, count, bits, 4);
+
+    try std.testing.expectEqual(serial_count, bitmap_count);
+    for (serial, 0..) |r, i| {
+        try std.testing.expectEqual(r, (bits[i / 8] >> @intCast(i % 8)) & 1);
+    }
+}
+
+test "validateStringOffsets - arrow layout with nulls" {
+    const data = "a@b.cobad" ++ "x@y.io";
+    const offsets = [_]i32{ 0, 6, 9, 9, 15, 40 };
+    const validity = [_]u8{0b1_1011}; // item 2 is null
+    var results: [5]u8 = undefined;
+    var bits: [1]u8 = undefined;
+
+    const valid_count = validateStringOffsets(i32, .bytes, .Email, 0, 0, &offsets, data, &validity, &results);
+    const bit_count = validateStringOffsets(i32, .bitmap, .Email, 0, 0, &offsets, data, &validity, &bits);
+
+    // item 4 runs past the data buffer
+    try std.testing.expectEqual(@as(usize, 2), valid_count);
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 0, 1, 0 }, &results);
+    try std.testing.expectEqual(valid_count, bit_count);
+    try std.testing.expectEqual(@as(u8, 0b0_1001), bits[0]);
+}
+
+test "validateStringColumn - substring kinds and length bounds" {
+    const data = "https://a.io" ++ "http://b.io" ++ "ftp://c.io";
+    const offsets = [_]i64{ 0, 12, 23, 33 };
+    var bits: [1]u8 = undefined;
+
+    const https = StringSpec{ .kind = .StartsWith, .needle = "https://", .needle_len = 8 };
+    try std.testing.expectEqual(@as(usize, 1), validateStringColumn(i64, .bitmap, https, &offsets, data, null, &bits));
+    try std.testing.expectEqual(@as(u8, 0b001), bits[0]);
+
+    const io = StringSpec{ .kind = .EndsWith, .needle = ".io", .needle_len = 3 };
+    try std.testing.expectEqual(@as(usize, 3), validateStringColumn(i64, .bitmap, io, &offsets, data, null, &bits));
+
+    const slash = StringSpec{ .kind = .Contains, .needle = "://", .needle_len = 3 };
+    const validity = [_]u8{0b101};
+    try std.testing.expectEqual(@as(usize, 2), validateStringColumn(i64, .bitmap, slash, &offsets, data, &validity, &bits));
+    try std.testing.expectEqual(@as(u8, 0b101), bits[0]);
+
+    const short = StringSpec{ .kind = .String, .param1 = 1, .param2 = 11 };
+    const bad_offsets = [_]i64{ 0, 12, 23, 99 };
+    try std.testing.expectEqual(@as(usize, 1), validateStringColumn(i64, .bitmap, short, &bad_offsets, data, null, &bits));
+    try std.testing.expectEqual(@as(u8, 0b010), bits[0]);
+}
+
+test "Pattern kind - columns and string specs" {
+    var sku = try regex.compile(std.testing.allocator, "^[A-Z]{3}-\\d{4}$");
+    defer sku.deinit(std.testing.allocator);
+
+    const skus = [_][*]const u8{ "ABC-1234", "abc-1234", "XYZ-0000" };
+    const sku_lens = [_]usize{ 8, 8, 8 };
+    const columns = [_]Column{
+        .{ .kind = .Pattern, .param1 = 0, .param2 = 0, .ints = null, .str_ptrs = &skus, .str_lens = &sku_lens, .present = null, .pattern = &sku },
+    };
+    var results: [3]u8 = undefined;
+    try std.testing.expectEqual(@as(usize, 2), validateRange(&columns, 0, 3, &results));
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 1 }, &results);
+
+    const data = "ABC-1234" ++ "ABC-123";
+    const offsets = [_]i32{ 0, 8, 15 };
+    var bits: [1]u8 = undefined;
+    const spec = StringSpec{ .kind = .Pattern, .pattern = &sku };
+    try std.testing.expectEqual(@as(usize, 1), validateStringColumn(i32, .bitmap, spec, &offsets, data, null, &bits));
+    try std.testing.expectEqual(@as(u8, 0b01), bits[0]);
+
+    // Without a compiled pattern nothing matches
+    try std.testing.expect(!(StringSpec{ .kind = .Pattern }).check("ABC-1234"));
+}
+
+test "validateStringColumn - memo gives the same results" {
+    const data = "a@b.io" ++ "nope" ++ "a@b.io" ++ "a@b.io" ++ "nope";
+    const offsets = [_]i32{ 0, 6, 10, 16, 22, 26 };
+    var plain: [1]u8 = undefined;
+    var cached: [1]u8 = undefined;
+    const email = StringSpec{ .kind = .Email };
+    const memoized = StringSpec{ .kind = .Email, .memo = true };
+    try std.testing.expectEqual(@as(usize, 3), validateStringColumn(i32, .bitmap, email, &offsets, data, null, &plain));
+    try std.testing.expectEqual(@as(usize, 3), validateStringColumn(i32, .bitmap, memoized, &offsets, data, null, &cached));
+    try std.testing.expectEqual(plain[0], cached[0]);
+
+    var memo: Memo = .{};
+    for ([_][]const u8{ "a@b.io", "nope", "a@b.io", "a@b.io" }, [_]bool{ true, false, true, true }) |str, want| {
+        try std.testing.expectEqual(want, memo.check(email, str));
+    }
+    try std.testing.expectEqual(@as(usize, 2), memo.hits);
+}
+
+test "validateIntValues - nulls and kinds" {
+    const values = [_]i64{ 5, -1, 20, 7, 30, 10, 0, 15, 12 };
+    const validity = [_]u8{ 0b1111_0111, 0b1 }; // item 3 is null
+    var results: [values.len]u8 = undefined;
+    var bits: [2]u8 = undefined;
+
+    const in_range = validateIntValues(.bytes, .Int, 5, 20, &values, &validity, &results);
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 1, 0, 0, 1, 0, 1, 1 }, &results);
+    try std.testing.expectEqual(@as(usize, 5), in_range);
+    try std.testing.expectEqual(in_range, validateIntValues(.bitmap, .Int, 5, 20, &values, &validity, &bits));
+    try std.testing.expectEqual(@as(u8, 0b1010_0101), bits[0]);
+    try std.testing.expectEqual(@as(u8, 0b1), bits[1]);
+
+    const multiples = validateIntValues(.bytes, .IntMultipleOf, 5, 0, &values, null, &results);
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 1, 0, 1, 1, 1, 1, 0 }, &results);
+    try std.testing.expectEqual(@as(usize, 6), multiples);
+}
+
+test "checkInt / checkString - mismatched kinds reject" {
+    try std.testing.expect(!checkInt(.Email, 5, 0, 10));
+    try std.testing.expect(!checkInt(@enumFromInt(200), 5, 0, 10));
+    try std.testing.expect(!checkString(.IntPositive, "abc", 0, 0));
+    try std.testing.expect(!checkString(@enumFromInt(200), "abc", 0, 0));
+    // No needle on this path: substring kinds reject like Pattern
+    try std.testing.expect(!checkString(.Contains, "abc", 0, 0));
+    try std.testing.expect(!checkString(.StartsWith, "", 0, 0));
+    try std.testing.expect(!checkString(.EndsWith, "abc", 0, 0));
+
+    const values = [_]i64{ 1, 2, 3 };
+    var results: [values.len]u8 = undefined;
+    try std.testing.expectEqual(@as(usize, 0), validateIntValues(.bytes, .Email, 0, 0, &values, null, &results));
+    try std.testing.expectEqualSlices(u8, &.{ 0, 0, 0 }, &results);
+}
@@ -160,25 +160,13 @@ pub fn Range(comptime T: type, comptime min: ?T, comptime max: ?T) type {
         pub fn validate(v: T, errors: *validator.ValidationErrors, field_name: []const u8) !T {
             if (min) |min_val| {
                 if (v < min_val) {
-                    const msg = try std.fmt.allocPrint(
-                        errors.allocator,
-                        "Value {d} must be >= {d}",
-                        .{ v, min_val },
-                    );
-                    defer errors.allocator.free(msg);
-                    try errors.add(field_name, msg);
+                    try errors.addFmt(field_name, "Value {d} must be >= {d}", .{ v, min_val });
                     return error.ValidationFailed;
                 }
             }
             if (max) |max_val| {
                 if (v > max_val) {
-                    const msg = try std.fmt.allocPrint(
-                        errors.allocator,
-                        "Value {d} must be <= {d}",
-                        .{ v, max_val },
-                    );
-                    defer errors.allocator.free(msg);
-                    try errors.add(field_name, msg);
+                    try errors.addFmt(field_name, "Value {d} must be <= {d}", .{ v, max_val });
                     return error.ValidationFailed;
                 }
             }
@@ -0,0 +1,145 @@
+/// Every violation of a batch, packed as struct-of-arrays in one buffer
+/// The collect-all-errors paths (json_batch_validator.zig, wasm_api.zig and
+/// the Python extension) record one Violation per failing field instead of
+/// stopping at the first, and hand callers a single buffer that is decoded
+/// lazily. For n violations `pack` lays it out as (little-endian):
+///
+///   item_index  u32[n]   at 0
+///   param       i32[n]   at 4n
+///   field_index u16[n]   at 8n
+///   code        u8[n]    at 10n
+///
+/// 11n bytes in total; violations are ordered by item, then by field.
+const std = @import("std");
+
+/// Why a field failed; values are shared with the Python and JS decoders
+pub const Code = enum(u8) {
+    /// Required field absent
+    missing = 1,
+    /// Wrong JSON / Python type (e.g. a string or float for an int field)
+    wrong_type = 2,
+    /// Int below its bound or string shorter than its minimum; param = bound
+    too_small = 3,
+    /// Int above its bound or string longer than its maximum; param = bound
+    too_large = 4,
+    /// Int not a multiple of param
+    not_multiple = 5,
+    /// Format validator (email, url, uuid, ...) rejected the string
+    invalid_format = 6,
+    /// String does not match the field's pattern
+    pattern_mismatch = 7,
+    /// Record is not an object; field_index is no_field
+    not_an_object = 8,
+    /// Value not among a one_of spec's values (Python nested specs)
+    not_allowed = 9,
+    /// Some value inside a nested object or list failed (Python nested specs)
+    invalid_nested = 10,
+};
+
+/// field_index of violations that belong to the whole record
+pub const no_field = std.math.maxInt(u16);
+
+/// Bytes per violation in the packed layout
+pub const bytes_per_violation = 11;
+
+/// Code plus the bound or divisor it refers to (0 when there is none)
+pub const Failure = struct {
+    code: Code,
+    param: i32 = 0,
+
+    pub fn of(code: Code) Failure {
+        return .{ .code = code };
+    }
+
+    /// Bounds outside the i32 range saturate
+    pub fn bound(code: Code, param: i64) Failure {
+        return .{ .code = code, .param = std.math.lossyCast(i32, param) };
+    }
+
+    /// too_small(min) or too_large(max) for a value outside [min, max]
+    pub fn outside(value: i64, min: i64, max: i64) Failure {
+        return if (value < min) bound(.too_small, min) else bound(.too_large, max);
+    }
+};
+
+pub const Violation = struct {
+    item_index: u32,
+    param: i32,
+    field_index: u16,
+    code: Code,
+};
+
+/// Growable list of violations; `pack` produces the buffer described above
+pub const ErrorReport = struct {
+    list: std.MultiArrayList(Violation) = .{},
+
+    pub fn deinit(self: *ErrorReport, allocator: std.mem.Allocator) void {
+        self.list.deinit(allocator);
+    }
+
+    pub fn len(self: *const ErrorReport) usize {
+        return self.list.len;
+    }
+
+    pub fn add(self: *ErrorReport, allocator: std.mem.Allocator, item_index: usize, field_index: usize, failure: Failure) !void {
+        try self.list.append(allocator, .{
+            .item_index = std.math.cast(u32, item_index) orelse return error.TooManyItems,
+            .param = failure.param,
+            .field_index = std.math.cast(u16, field_index) orelse no_field,
+            .code = failure.code,
+        });
+    }
+
+    /// Number of bytes `packInto` writes
+    pub fn packedLen(self: *const ErrorReport) usize {
+        return self.list.len * bytes_per_violation;
+    }
+
+    /// Write the packed layout into `out` (at least packedLen bytes)
+    pub fn packInto(self: *const ErrorReport, out: []u8) void {
+        const n = self.list.len;
+        const slice = self.list.slice();
+        for (slice.items(.item_index), 0..) |v, i| std.mem.writeInt(u32, out[4 * i ..][0..4], v, .little);
+        for (slice.items(.param), 0..) |v, i| std.mem.writeInt(i32, out[4 * n + 4 * i ..][0..4], v, .little);
+        for (slice.items(.field_index), 0..) |v, i| std.mem.writeInt(u16, out[8 * n + 2 * i ..][0..2], v, .little);
+        for (slice.items(.code), 0..) |v, i| out[10 * n + i] = @intFromEnum(v);
+    }
+
+    /// Caller owns the returned buffer
+    pub fn pack(self: *const ErrorReport, allocator: std.mem.Allocator) ![]u8 {
+        const out = try allocator.alloc(u8, self.packedLen());
+        self.packInto(out);
+        return out;
+    }
+};
+
+/// Read violation `i` back from a packed buffer of `n` violations
+pub fn get(data: []const u8, n: usize, i: usize) Violation {
+    return .{
+        .item_index = std.mem.readInt(u32, data[4 * i ..][0..4], .little),
+        .param = std.mem.readInt(i32, data[4 * n + 4 * i ..][0..4], .little),
+        .field_index = std.mem.readInt(u16, data[8 * n + 2 * i ..][0..2], .little),
+        .code = @enumFromInt(data[10 * n + i]),
+    };
+}
+
+test "ErrorReport - packed struct-of-arrays layout" {
+    const allocator = std.testing.allocator;
+    var report: ErrorReport = .{};
+    defer report.deinit(allocator);
+
+    try report.add(allocator, 0, 2, Failure.outside(15, 18, 120));
+    try report.add(allocator, 0, 3, Failure.of(.invalid_format));
+    try report.add(allocator, 7, no_field, Failure.of(.not_an_object));
+    try report.add(allocator, 9, 1, Failure.bound(.too_large, 1 << 40));
+
+    const data = try report.pack(allocator);
+    defer allocator.free(data);
+    try std.testing.expectEqual(@as(usize, 4 * bytes_per_violation), data.len);
+
+    try std.testing.expectEqual(Violation{ .item_index = 0, .param = 18, .field_index = 2, .code = .too_small }, get(data, 4, 0));
+    try std.testing.expectEqual(Violation{ .item_index = 7, .param = 0, .field_index = no_field, .code = .not_an_object }, get(data, 4, 2));
+    try std.testing.expectEqual(std.math.maxInt(i32), get(data, 4, 3).param);
+    // Codes are the last n bytes
+    try std.testing.expectEqualSlices(u8, &.{ 3, 6, 8, 4 }, data[40..44]);
+}
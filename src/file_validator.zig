@@ -0,0 +1,278 @@
+/// Validate JSON / NDJSON files on disk without reading them into memory
+/// The file is mapped read-only with MADV_SEQUENTIAL and the
+/// json_batch_validator.zig validators run straight over the mapping, so
+/// there is no copy and resident memory is whatever page cache the kernel
+/// keeps. JSON arrays in a mapping use the streaming tokenizer rather than
+/// the structural index, which would allocate about one u32 per four input
+/// bytes. NDJSON files can be split at line boundaries across threads.
+const std = @import("std");
+const builtin = @import("builtin");
+const json_validator = @import("json_batch_validator.zig");
+const bitmap = @import("bitmap.zig");
+
+pub const FieldSpec = json_validator.FieldSpec;
+
+pub const Mode = enum(u8) {
+    /// '[' as the first non-whitespace byte means json_array, else ndjson
+    auto = 0,
+    /// One JSON array of objects
+    json_array = 1,
+    /// One object per line
+    ndjson = 2,
+};
+
+/// Packed per-record results (bitmap.zig layout); free with deinit
+pub const FileResult = struct {
+    bits: []u8,
+    count: usize,
+    valid_count: usize,
+
+    pub fn deinit(self: *FileResult, allocator: std.mem.Allocator) void {
+        allocator.free(self.bits);
+    }
+};
+
+/// NDJSON smaller than this per thread is not worth splitting
+pub const min_bytes_per_thread: usize = 1 << 20;
+const max_shards = 64;
+
+const has_mmap = switch (builtin.os.tag) {
+    .windows, .wasi, .freestanding => false,
+    else => true,
+};
+
+/// Map `path` and validate every record in it
+/// `allocator` must be thread-safe when max_threads > 1.
+pub fn validateFile(
+    allocator: std.mem.Allocator,
+    path: []const u8,
+    field_specs: []const FieldSpec,
+    mode: Mode,
+    max_threads: usize,
+) !FileResult {
+    // File system errors collapse to FileNotFound / ReadFailed for the C API
+    var file = std.fs.cwd().openFile(path, .{}) catch |err| return switch (err) {
+        error.FileNotFound => error.FileNotFound,
+        else => error.ReadFailed,
+    };
+    defer file.close();
+
+    const stat = file.stat() catch return error.ReadFailed;
+    if (stat.size == 0) return validateBytes(allocator, "", field_specs, mode, max_threads);
+    const len = std.math.cast(usize, stat.size) orelse return error.FileTooBig;
+
+    if (comptime !has_mmap) {
+        const data = file.readToEndAlloc(allocator, len) catch |err| return switch (err) {
+            error.OutOfMemory => error.OutOfMemory,
+            else => error.ReadFailed,
+        };
+        defer allocator.free(data);
+        return validateData(allocator, data, field_specs, mode, max_threads, .indexed);
+    }
+
+    const mapping = std.posix.mmap(null, len, std.posix.PROT.READ, .{ .TYPE = .PRIVATE }, file.handle, 0) catch
+        return error.ReadFailed;
+    defer std.posix.munmap(mapping);
+    // Advisory only: more readahead, and pages behind the scan are dropped first
+    std.posix.madvise(mapping.ptr, mapping.len, std.posix.MADV.SEQUENTIAL) catch {};
+
+    return validateData(allocator, mapping, field_specs, mode, max_threads, .tokens);
+}
+
+/// Same as validateFile for bytes already in memory
+pub fn validateBytes(
+    allocator: std.mem.Allocator,
+    data: []const u8,
+    field_specs: []const FieldSpec,
+    mode: Mode,
+    max_threads: usize,
+) !FileResult {
+    return validateData(allocator, data, field_specs, mode, max_threads, .indexed);
+}
+
+/// How a JSON array is walked: `.indexed` lets validateJsonArrayStream build
+/// the structural index for large inputs, `.tokens` never does
+const ArrayPath = enum { indexed, tokens };
+
+fn validateData(
+    allocator: std.mem.Allocator,
+    data: []const u8,
+    field_specs: []const FieldSpec,
+    mode: Mode,
+    max_threads: usize,
+    array_path: ArrayPath,
+) !FileResult {
+    const resolved = if (mode == .auto) detectMode(data) else mode;
+    if (resolved == .json_array) {
+        var collector: BitCollector = .{ .allocator = allocator };
+        errdefer collector.bits.deinit(allocator);
+        _ = switch (array_path) {
+            .indexed => try json_validator.validateJsonArrayStream(data, field_specs, allocator, &collector),
+            .tokens => try json_validator.validateJsonArrayTokens(data, field_specs, allocator, &collector),
+        };
+        return collector.finish();
+    }
+    return validateNdjsonSharded(allocator, data, field_specs, max_threads);
+}
+
+fn detectMode(data: []const u8) Mode {
+    for (data) |c| {
+        switch (c) {
+            ' ', '\t', '\r', '\n' => continue,
+            '[' => return .json_array,
+            else => return .ndjson,
+        }
+    }
+    return .ndjson;
+}
+
+/// Sink that packs results as they arrive
+const BitCollector = struct {
+    allocator: std.mem.Allocator,
+    bits: std.ArrayList(u8) = .empty,
+    count: usize = 0,
+    valid_count: usize = 0,
+
+    pub fn put(self: *BitCollector, index: usize, result: json_validator.ValidationResult) !void {
+        if (index & 7 == 0) try self.bits.append(self.allocator, 0);
+        if (result.is_valid) {
+            bitmap.set(self.bits.items, index, true);
+            self.valid_count += 1;
+        }
+        self.count = index + 1;
+    }
+
+    fn finish(self: *BitCollector) !FileResult {
+        return .{
+            .bits = try self.bits.toOwnedSlice(self.allocator),
+            .count = self.count,
+            .valid_count = self.valid_count,
+        };
+    }
+};
+
+/// One line-aligned slice of an NDJSON file
+const Shard = struct {
+    data: []const u8,
+    collector: BitCollector,
+    err: ?anyerror = null,
+
+    fn run(self: *Shard, field_specs: []const FieldSpec) void {
+        _ = json_validator.validateNdjsonStream(self.data, field_specs, self.collector.allocator, &self.collector) catch |err| {
+            self.err = err;
+        };
+    }
+};
+
+fn validateNdjsonSharded(
+    allocator: std.mem.Allocator,
+    data: []const u8,
+    field_specs: []const FieldSpec,
+    max_threads: usize,
+) !FileResult {
+    const shard_count = if (builtin.single_threaded)
+        1
+    else
+        @max(1, @min(@min(max_threads, data.len / min_bytes_per_thread), max_shards));
+
+    // Cut after the first newline at or past each even split point
+    var shards: [max_shards]Shard = undefined;
+    var start: usize = 0;
+    for (shards[0..shard_count], 0..) |*shard, s| {
+        const end = if (s + 1 == shard_count)
+            data.len
+        else if (std.mem.indexOfScalarPos(u8, data, @max(start, data.len / shard_count * (s + 1)), '\n')) |newline|
+            newline + 1
+        else
+            data.len;
+        shard.* = .{ .data = data[start..end], .collector = .{ .allocator = allocator } };
+        start = end;
+    }
+    defer for (shards[0..shard_count]) |*shard| shard.collector.bits.deinit(allocator);
+
+    // Shards are at least min_bytes_per_thread, so thread start-up is noise
+    var threads: [max_shards]?std.Thread = [_]?std.Thread{null} ** max_shards;
+    for (shards[1..shard_count], 1..) |*shard, s| {
+        threads[s] = std.Thread.spawn(.{}, Shard.run, .{ shard, field_specs }) catch null;
+        if (threads[s] == null) shard.run(field_specs);
+    }
+    shards[0].run(field_specs);
+    for (threads[1..shard_count]) |thread| {
+        if (thread) |t| t.join();
+    }
+
+    var count: usize = 0;
+    var valid_count: usize = 0;
+    for (shards[0..shard_count]) |shard| {
+        if (shard.err) |err| return err;
+        count += shard.collector.count;
+        valid_count += shard.collector.valid_count;
+    }
+    if (shard_count == 1) return shards[0].collector.finish();
+
+    const bits = try allocator.alloc(u8, bitmap.byteLen(count));
+    @memset(bits, 0);
+    var offset: usize = 0;
+    for (shards[0..shard_count]) |shard| {
+        bitmap.copyBits(bits, offset, shard.collector.bits.items, shard.collector.count);
+        offset += shard.collector.count;
+    }
+    return .{ .bits = bits, .count = count, .valid_count = valid_count };
+}
+
+test "validateBytes - ndjson split across threads matches one thread" {
+    const allocator = std.testing.allocator;
+    const specs = [_]FieldSpec{
+        .{ .name = "id", .validator_type = .IntNonNegative },
+        .{ .name = "email", .validator_type = .Email },
+    };
+
+    // ~3 MB so it splits into several shards
+    var ndjson: std.ArrayList(u8) = .empty;
+    defer ndjson.deinit(allocator);
+    var i: usize = 0;
+    while (ndjson.items.len < 3 * min_bytes_per_thread) : (i += 1) {
+        const email = if (i % 7 == 0) "broken" else "user@example.com";
+        try ndjson.print(allocator, "{{\"id\": {d}, \"email\": \"{s}\"}}\n", .{ i, email });
+    }
+
+    var single = try validateBytes(allocator, ndjson.items, &specs, .auto, 1);
+    defer single.deinit(allocator);
+    var sharded = try validateBytes(allocator, ndjson.items, &specs, .ndjson, 4);
+    defer sharded.deinit(allocator);
+
+    try std.testing.expectEqual(i, single.count);
+    try std.testing.expectEqual(single.count, sharded.count);
+    try std.testing.expectEqual(i - (i + 6) / 7, sharded.valid_count);
+    try std.testing.expectEqualSlices(u8, single.bits, sharded.bits);
+}
+
+test "validateFile - json array on disk" {
+    const allocator = std.testing.allocator;
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+
+    try tmp.dir.writeFile(.{
+        .sub_path = "users.json",
+        .data = " [{\"age\": 30}, {\"age\": 7}, {\"age\": 45}]",
+    });
+    try tmp.dir.writeFile(.{ .sub_path = "empty.ndjson", .data = "" });
+    const dir_path = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(dir_path);
+
+    const specs = [_]FieldSpec{.{ .name = "age", .validator_type = .Int, .param1 = 18, .param2 = 120 }};
+
+    const path = try std.fs.path.join(allocator, &.{ dir_path, "users.json" });
+    defer allocator.free(path);
+    var result = try validateFile(allocator, path, &specs, .auto, 4);
+    defer result.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 3), result.count);
+    try std.testing.expectEqual(@as(usize, 2), result.valid_count);
+    try std.testing.expectEqual(@as(?usize, 1), bitmap.firstInvalid(result.bits, result.count));
+
+    const empty_path = try std.fs.path.join(allocator, &.{ dir_path, "empty.ndjson" });
+    defer allocator.free(empty_path);
+    var empty = try validateFile(allocator, empty_path, &specs, .auto, 4);
+    defer empty.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 0), empty.count);
+}
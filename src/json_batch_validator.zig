@@ -1,7 +1,16 @@
 /// Ultra-fast JSON parsing + validation in Zig
-/// Parses JSON and validates in a single pass for maximum performance
+/// Tokenizes JSON and validates each field as its token arrives: no
+/// std.json.Value tree, unknown keys are skipped without being materialized.
 const std = @import("std");
 const validators = @import("validators_comprehensive.zig");
+const structural = @import("json_structural.zig");
+const regex = @import("regex.zig");
+const error_report = @import("error_report.zig");
+const stats = @import("stats.zig");
+const batch = @import("batch_validator.zig");
+
+pub const ErrorReport = error_report.ErrorReport;
+const Failure = error_report.Failure;
 
 /// Field specification for validation
 pub const FieldSpec = struct {
@@ -10,6 +19,8 @@ pub const FieldSpec = struct {
     param1: i64 = 0,
     param2: i64 = 0,
     string_param: []const u8 = "",
+    /// Pattern: compiled regex (borrowed)
+    pattern: ?*const regex.Regex = null,
 };
 
 pub const ValidatorType = enum {
@@ -34,6 +45,8 @@ pub const ValidatorType = enum {
     FloatGt,
     FloatFinite,
     Boolean,
+    IntMultipleOf,
+    Pattern,
 };
 
 /// Validation result for a single item
@@ -42,138 +55,639 @@ pub const ValidationResult = struct {
     error_field: ?[]const u8 = null,
 };
 
-/// Parse and validate JSON array in one pass
+/// Most fields a schema may have (tracked in a fixed-size seen-set)
+pub const max_fields = 128;
+
+/// Validate a JSON array of objects in one pass
+/// Caller owns the returned slice
 pub fn validateJsonArray(
     json_bytes: []const u8,
     field_specs: []const FieldSpec,
     allocator: std.mem.Allocator,
 ) ![]ValidationResult {
-    var results = std.ArrayList(ValidationResult).init(allocator);
-    defer results.deinit();
-    
-    // Parse JSON
-    const parsed = try std.json.parseFromSlice(
-        std.json.Value,
-        allocator,
-        json_bytes,
-        .{},
-    );
-    defer parsed.deinit();
-    
-    const array = parsed.value.array;
-    
-    // Validate each item
-    for (array.items) |item| {
-        const result = validateJsonObject(item.object, field_specs);
-        try results.append(result);
+    const Collector = struct {
+        list: std.ArrayList(ValidationResult) = .empty,
+        allocator: std.mem.Allocator,
+
+        pub fn put(self: *@This(), index: usize, result: ValidationResult) !void {
+            _ = index;
+            try self.list.append(self.allocator, result);
+        }
+    };
+
+    var collector: Collector = .{ .allocator = allocator };
+    errdefer collector.list.deinit(allocator);
+
+    _ = try validateJsonArrayStream(json_bytes, field_specs, allocator, &collector);
+    return try collector.list.toOwnedSlice(allocator);
+}
+
+/// Inputs at least this large are pre-indexed with the SIMD structural
+/// scan (json_structural.zig); smaller ones go straight to the tokenizer
+pub const indexed_min_len: usize = 16 * 1024;
+
+/// Streaming core: calls `sink.put(index, result)` once per array element.
+/// Non-object elements are invalid. Returns number of elements.
+pub fn validateJsonArrayStream(
+    json_bytes: []const u8,
+    field_specs: []const FieldSpec,
+    allocator: std.mem.Allocator,
+    sink: anytype,
+) !usize {
+    if (json_bytes.len >= indexed_min_len and json_bytes.len <= structural.max_input_len) {
+        return validateJsonArrayIndexed(json_bytes, field_specs, allocator, sink);
     }
-    
-    return try results.toOwnedSlice();
+    return validateJsonArrayTokens(json_bytes, field_specs, allocator, sink);
 }
 
-/// Validate a single JSON object against field specs
-fn validateJsonObject(
-    obj: std.json.ObjectMap,
+/// Byte-at-a-time path on std.json.Scanner
+/// `allocator` only backs the scanner's nesting stack and a scratch arena
+/// for strings that contain escapes (reset after every element), so
+/// steady-state validation does not allocate.
+pub fn validateJsonArrayTokens(
+    json_bytes: []const u8,
     field_specs: []const FieldSpec,
-) ValidationResult {
-    for (field_specs) |spec| {
-        const field_value = obj.get(spec.name) orelse {
-            return .{ .is_valid = false, .error_field = spec.name };
-        };
-        
-        const is_valid = switch (spec.validator_type) {
-            .Int => validateIntField(field_value, spec.param1, spec.param2),
-            .IntGt => blk: {
-                if (field_value != .integer) break :blk false;
-                break :blk validators.validateGt(i64, field_value.integer, spec.param1);
-            },
-            .IntGte => blk: {
-                if (field_value != .integer) break :blk false;
-                break :blk validators.validateGte(i64, field_value.integer, spec.param1);
-            },
-            .IntLt => blk: {
-                if (field_value != .integer) break :blk false;
-                break :blk validators.validateLt(i64, field_value.integer, spec.param1);
-            },
-            .IntLte => blk: {
-                if (field_value != .integer) break :blk false;
-                break :blk validators.validateLte(i64, field_value.integer, spec.param1);
-            },
-            .IntPositive => blk: {
-                if (field_value != .integer) break :blk false;
-                break :blk validators.validatePositive(i64, field_value.integer);
-            },
-            .IntNonNegative => blk: {
-                if (field_value != .integer) break :blk false;
-                break :blk validators.validateNonNegative(i64, field_value.integer);
-            },
-            .String => validateStringField(field_value, spec.param1, spec.param2),
-            .StringMinLen => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk field_value.string.len >= @as(usize, @intCast(spec.param1));
-            },
-            .StringMaxLen => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk field_value.string.len <= @as(usize, @intCast(spec.param1));
-            },
-            .Email => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateEmail(field_value.string);
-            },
-            .Url => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateUrl(field_value.string);
+    allocator: std.mem.Allocator,
+    sink: anytype,
+) !usize {
+    if (field_specs.len > max_fields) return error.TooManyFields;
+
+    var scanner = std.json.Scanner.initCompleteInput(allocator, json_bytes);
+    defer scanner.deinit();
+    var scratch = std.heap.ArenaAllocator.init(allocator);
+    defer scratch.deinit();
+
+    if ((try scanner.next()) != .array_begin) return error.ExpectedArray;
+
+    var count: usize = 0;
+    while (true) {
+        const result: ValidationResult = switch (try scanner.peekNextTokenType()) {
+            .array_end => break,
+            .object_begin => blk: {
+                _ = try scanner.next();
+                break :blk try validateObjectTokens(&scanner, scratch.allocator(), field_specs);
             },
-            .Uuid => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateUuid(field_value.string);
+            else => blk: {
+                try scanner.skipValue();
+                break :blk .{ .is_valid = false };
             },
-            .Ipv4 => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateIpv4(field_value.string);
+        };
+        _ = scratch.reset(.retain_capacity);
+
+        try sink.put(count, result);
+        count += 1;
+    }
+
+    _ = try scanner.next(); // array_end
+    if ((try scanner.next()) != .end_of_document) return error.SyntaxError;
+    return count;
+}
+
+/// Validate the members of an object whose `{` was already consumed
+/// Fields are checked in document order; after the first failure the
+/// remaining values are skipped.
+fn validateObjectTokens(
+    scanner: *std.json.Scanner,
+    scratch: std.mem.Allocator,
+    field_specs: []const FieldSpec,
+) !ValidationResult {
+    var seen = std.StaticBitSet(max_fields).initEmpty();
+    var error_field: ?[]const u8 = null;
+
+    while (true) {
+        const key = switch (try scanner.nextAlloc(scratch, .alloc_if_needed)) {
+            .object_end => break,
+            .string => |s| s,
+            .allocated_string => |s| s,
+            else => return error.UnexpectedToken,
+        };
+
+        const index = (if (error_field == null) findField(field_specs, key) else null) orelse {
+            try scanner.skipValue();
+            continue;
+        };
+        seen.set(index);
+        const probe = stats.begin();
+        const ok = try validateValueToken(scanner, scratch, field_specs[index]);
+        stats.end(stats.slotOf(field_specs[index].validator_type), ok, probe);
+        if (!ok) error_field = field_specs[index].name;
+    }
+
+    if (error_field) |name| return .{ .is_valid = false, .error_field = name };
+    for (field_specs, 0..) |spec, i| {
+        if (!seen.isSet(i)) return .{ .is_valid = false, .error_field = spec.name };
+    }
+    return .{ .is_valid = true };
+}
+
+inline fn findField(field_specs: []const FieldSpec, key: []const u8) ?usize {
+    for (field_specs, 0..) |spec, i| {
+        if (std.mem.eql(u8, spec.name, key)) return i;
+    }
+    return null;
+}
+
+/// Consume one value and check it against `spec`
+/// Objects and arrays never match a scalar spec and are skipped whole.
+fn validateValueToken(scanner: *std.json.Scanner, scratch: std.mem.Allocator, spec: FieldSpec) !bool {
+    switch (try scanner.peekNextTokenType()) {
+        .object_begin, .array_begin => {
+            try scanner.skipValue();
+            return false;
+        },
+        else => {},
+    }
+
+    return switch (try scanner.nextAlloc(scratch, .alloc_if_needed)) {
+        .string => |s| checkString(spec, s),
+        .allocated_string => |s| checkString(spec, s),
+        .number => |n| checkNumber(spec, n),
+        .allocated_number => |n| checkNumber(spec, n),
+        .true, .false => spec.validator_type == .Boolean,
+        .null => false,
+        else => error.UnexpectedToken,
+    };
+}
+
+// ============================================================================
+// Collect-all-errors mode: every failing field of every element
+// ============================================================================
+
+/// Validate a JSON array of objects, recording every violation in `report`
+/// (error_report.zig) instead of stopping at the first failing field.
+/// Uses the tokenizer path; the streaming validators above stay the fast
+/// path when only valid/invalid is needed. Returns number of elements.
+pub fn validateJsonArrayErrors(
+    json_bytes: []const u8,
+    field_specs: []const FieldSpec,
+    allocator: std.mem.Allocator,
+    report: *ErrorReport,
+) !usize {
+    if (field_specs.len > max_fields) return error.TooManyFields;
+
+    var scanner = std.json.Scanner.initCompleteInput(allocator, json_bytes);
+    defer scanner.deinit();
+    var scratch = std.heap.ArenaAllocator.init(allocator);
+    defer scratch.deinit();
+
+    if ((try scanner.next()) != .array_begin) return error.ExpectedArray;
+
+    var count: usize = 0;
+    while (true) : (count += 1) {
+        switch (try scanner.peekNextTokenType()) {
+            .array_end => break,
+            .object_begin => {
+                _ = try scanner.next();
+                try collectObjectTokens(&scanner, scratch.allocator(), field_specs, allocator, report, count);
             },
-            .Base64 => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateBase64(field_value.string);
+            else => {
+                try scanner.skipValue();
+                try report.add(allocator, count, error_report.no_field, Failure.of(.not_an_object));
             },
-            .IsoDate => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateIsoDate(field_value.string);
+        }
+        _ = scratch.reset(.retain_capacity);
+    }
+
+    _ = try scanner.next(); // array_end
+    if ((try scanner.next()) != .end_of_document) return error.SyntaxError;
+    return count;
+}
+
+/// validateObjectTokens without the early exit: each failing value, then
+/// each missing field, is added to `report` (ordered by field index)
+fn collectObjectTokens(
+    scanner: *std.json.Scanner,
+    scratch: std.mem.Allocator,
+    field_specs: []const FieldSpec,
+    allocator: std.mem.Allocator,
+    report: *ErrorReport,
+    item_index: usize,
+) !void {
+    var seen = std.StaticBitSet(max_fields).initEmpty();
+    var failures: [max_fields]Failure = undefined;
+    var failed = std.StaticBitSet(max_fields).initEmpty();
+
+    while (true) {
+        const key = switch (try scanner.nextAlloc(scratch, .alloc_if_needed)) {
+            .object_end => break,
+            .string => |s| s,
+            .allocated_string => |s| s,
+            else => return error.UnexpectedToken,
+        };
+
+        const index = findField(field_specs, key) orelse {
+            try scanner.skipValue();
+            continue;
+        };
+        seen.set(index);
+        failed.unset(index);
+        if (try valueFailureToken(scanner, scratch, field_specs[index])) |failure| {
+            failures[index] = failure;
+            failed.set(index);
+        }
+    }
+
+    for (0..field_specs.len) |i| {
+        if (!seen.isSet(i)) {
+            try report.add(allocator, item_index, i, Failure.of(.missing));
+        } else if (failed.isSet(i)) {
+            try report.add(allocator, item_index, i, failures[i]);
+        }
+    }
+}
+
+/// Consume one value; null if it passes `spec`, else why it failed
+fn valueFailureToken(scanner: *std.json.Scanner, scratch: std.mem.Allocator, spec: FieldSpec) !?Failure {
+    switch (try scanner.peekNextTokenType()) {
+        .object_begin, .array_begin => {
+            try scanner.skipValue();
+            return Failure.of(.wrong_type);
+        },
+        else => {},
+    }
+
+    return switch (try scanner.nextAlloc(scratch, .alloc_if_needed)) {
+        .string => |s| stringFailure(spec, s),
+        .allocated_string => |s| stringFailure(spec, s),
+        .number => |n| numberFailure(spec, n),
+        .allocated_number => |n| numberFailure(spec, n),
+        .true, .false => if (spec.validator_type == .Boolean) null else Failure.of(.wrong_type),
+        .null => Failure.of(.wrong_type),
+        else => error.UnexpectedToken,
+    };
+}
+
+/// null if checkString accepts `str`, else why it does not
+fn stringFailure(spec: FieldSpec, str: []const u8) ?Failure {
+    if (checkString(spec, str)) return null;
+    return switch (spec.validator_type) {
+        .String => if (str.len < lenParam(spec.param1))
+            Failure.bound(.too_small, spec.param1)
+        else
+            Failure.bound(.too_large, spec.param2),
+        .StringMinLen => Failure.bound(.too_small, spec.param1),
+        .StringMaxLen => Failure.bound(.too_large, spec.param1),
+        .Email, .Url, .Uuid, .Ipv4, .Base64, .IsoDate, .IsoDatetime => Failure.of(.invalid_format),
+        .Pattern => Failure.of(.pattern_mismatch),
+        else => Failure.of(.wrong_type),
+    };
+}
+
+/// null if checkNumber accepts `number`, else why it does not
+fn numberFailure(spec: FieldSpec, number: []const u8) ?Failure {
+    if (checkNumber(spec, number)) return null;
+    switch (spec.validator_type) {
+        .Int, .IntGt, .IntGte, .IntLt, .IntLte, .IntPositive, .IntNonNegative, .IntMultipleOf => {
+            if (!std.json.isNumberFormattedLikeAnInteger(number)) return Failure.of(.wrong_type);
+            const value = std.fmt.parseInt(i64, number, 10) catch
+                return Failure.bound(if (number[0] == '-') .too_small else .too_large, 0);
+            return switch (spec.validator_type) {
+                .Int => Failure.outside(value, spec.param1, spec.param2),
+                .IntGt, .IntGte => Failure.bound(.too_small, spec.param1),
+                .IntLt, .IntLte => Failure.bound(.too_large, spec.param1),
+                .IntPositive, .IntNonNegative => Failure.bound(.too_small, 0),
+                .IntMultipleOf => Failure.bound(.not_multiple, spec.param1),
+                else => unreachable,
+            };
+        },
+        .FloatGt => return if (std.fmt.parseFloat(f64, number)) |_|
+            Failure.bound(.too_small, spec.param1)
+        else |_|
+            Failure.of(.wrong_type),
+        .FloatFinite => return Failure.of(if (std.json.isNumberFormattedLikeAnInteger(number)) .wrong_type else .invalid_format),
+        else => return Failure.of(.wrong_type),
+    }
+}
+
+// ============================================================================
+// NDJSON: one object per line
+// ============================================================================
+
+/// Streaming core for NDJSON: calls `sink.put(index, result)` once per
+/// non-blank line. Lines that are not a single JSON object are invalid
+/// (not an error), so one bad record doesn't stop a large file.
+/// Returns number of records.
+pub fn validateNdjsonStream(
+    ndjson: []const u8,
+    field_specs: []const FieldSpec,
+    allocator: std.mem.Allocator,
+    sink: anytype,
+) !usize {
+    if (field_specs.len > max_fields) return error.TooManyFields;
+
+    // Backs the scanner stack and escaped strings; reset per record
+    var scratch = std.heap.ArenaAllocator.init(allocator);
+    defer scratch.deinit();
+
+    var count: usize = 0;
+    var lines = std.mem.splitScalar(u8, ndjson, '\n');
+    while (lines.next()) |raw| {
+        const line = std.mem.trim(u8, raw, " \t\r");
+        if (line.len == 0) continue;
+
+        const result = try validateJsonObject(line, field_specs, scratch.allocator());
+        _ = scratch.reset(.retain_capacity);
+
+        try sink.put(count, result);
+        count += 1;
+    }
+    return count;
+}
+
+/// Validate one complete JSON document that should be an object
+/// Malformed JSON is reported as invalid; only OutOfMemory is an error.
+pub fn validateJsonObject(json: []const u8, field_specs: []const FieldSpec, scratch: std.mem.Allocator) !ValidationResult {
+    var scanner = std.json.Scanner.initCompleteInput(scratch, json);
+    defer scanner.deinit();
+
+    const result = validateDocumentTokens(&scanner, scratch, field_specs) catch |err| switch (err) {
+        error.OutOfMemory => return error.OutOfMemory,
+        else => return .{ .is_valid = false },
+    };
+    return result;
+}
+
+fn validateDocumentTokens(scanner: *std.json.Scanner, scratch: std.mem.Allocator, field_specs: []const FieldSpec) !ValidationResult {
+    if ((try scanner.next()) != .object_begin) return error.ExpectedObject;
+    const result = try validateObjectTokens(scanner, scratch, field_specs);
+    if ((try scanner.next()) != .end_of_document) return error.SyntaxError;
+    return result;
+}
+
+// ============================================================================
+// Indexed path: walk the structural index instead of the bytes
+// ============================================================================
+
+/// Same results as validateJsonArrayTokens for well-formed input. Values of
+/// keys outside the schema are only checked structurally (bracket nesting and
+/// string boundaries), so some malformed scalars there are not reported.
+/// Allocates the structural index once (about 1 u32 per 4-8 input bytes).
+pub fn validateJsonArrayIndexed(
+    json_bytes: []const u8,
+    field_specs: []const FieldSpec,
+    allocator: std.mem.Allocator,
+    sink: anytype,
+) !usize {
+    if (field_specs.len > max_fields) return error.TooManyFields;
+
+    var index = try structural.buildIndex(allocator, json_bytes);
+    defer index.deinit(allocator);
+    var scratch = std.heap.ArenaAllocator.init(allocator);
+    defer scratch.deinit();
+
+    var walker: IndexWalker = .{ .json = json_bytes, .positions = index.positions };
+    if ((walker.peek() orelse return error.UnexpectedEndOfInput) != '[') return error.ExpectedArray;
+    walker.i += 1;
+
+    var count: usize = 0;
+    if (walker.peekIs(']')) {
+        walker.i += 1;
+    } else while (true) {
+        const result: ValidationResult = if (walker.peekIs('{'))
+            try validateObjectIndexed(&walker, scratch.allocator(), field_specs)
+        else blk: {
+            try walker.skipValue();
+            break :blk .{ .is_valid = false };
+        };
+        _ = scratch.reset(.retain_capacity);
+
+        try sink.put(count, result);
+        count += 1;
+
+        switch (walker.peek() orelse return error.UnexpectedEndOfInput) {
+            ',' => walker.i += 1,
+            ']' => {
+                walker.i += 1;
+                break;
             },
-            .IsoDatetime => blk: {
-                if (field_value != .string) break :blk false;
-                break :blk validators.validateIsoDatetime(field_value.string);
+            else => return error.SyntaxError,
+        }
+    }
+
+    if (walker.i != walker.positions.len) return error.SyntaxError;
+    return count;
+}
+
+/// Cursor over a structural index
+const IndexWalker = struct {
+    json: []const u8,
+    positions: []const u32,
+    i: usize = 0,
+
+    /// Byte at the current structural position
+    inline fn peek(self: *const IndexWalker) ?u8 {
+        if (self.i >= self.positions.len) return null;
+        return self.json[self.positions[self.i]];
+    }
+
+    inline fn peekIs(self: *const IndexWalker, c: u8) bool {
+        return (self.peek() orelse return false) == c;
+    }
+
+    fn expect(self: *IndexWalker, c: u8) !void {
+        if ((self.peek() orelse return error.UnexpectedEndOfInput) != c) return error.SyntaxError;
+        self.i += 1;
+    }
+
+    /// Consume a string (its opening and closing quotes are consecutive
+    /// positions); escapes are decoded into `scratch` only when present
+    fn string(self: *IndexWalker, scratch: std.mem.Allocator) ![]const u8 {
+        if (self.i + 1 >= self.positions.len) return error.UnexpectedEndOfInput;
+        const open = self.positions[self.i];
+        const close = self.positions[self.i + 1];
+        if (self.json[open] != '"' or self.json[close] != '"') return error.SyntaxError;
+        self.i += 2;
+
+        const raw = self.json[open + 1 .. close];
+        if (std.mem.indexOfScalar(u8, raw, '\\') == null) return raw;
+        return std.json.parseFromSliceLeaky([]const u8, scratch, self.json[open .. close + 1], .{});
+    }
+
+    /// Consume a scalar: bytes up to the next structural position, minus trailing whitespace
+    fn scalar(self: *IndexWalker) []const u8 {
+        const start = self.positions[self.i];
+        const end = if (self.i + 1 < self.positions.len) self.positions[self.i + 1] else self.json.len;
+        self.i += 1;
+        return std.mem.trimRight(u8, self.json[start..end], " \t\r\n");
+    }
+
+    /// Skip one value of any type without decoding it
+    fn skipValue(self: *IndexWalker) !void {
+        switch (self.peek() orelse return error.UnexpectedEndOfInput) {
+            '"' => {
+                if (self.i + 1 >= self.positions.len) return error.UnexpectedEndOfInput;
+                self.i += 2;
             },
-            .Float => field_value == .float or field_value == .integer,
-            .FloatGt => blk: {
-                const val = if (field_value == .float) field_value.float else if (field_value == .integer) @as(f64, @floatFromInt(field_value.integer)) else break :blk false;
-                break :blk validators.validateGt(f64, val, @as(f64, @floatFromInt(spec.param1)));
+            '{', '[' => {
+                var depth: usize = 0;
+                while (true) {
+                    switch (self.peek() orelse return error.UnexpectedEndOfInput) {
+                        '{', '[' => depth += 1,
+                        '}', ']' => {
+                            depth -= 1;
+                            if (depth == 0) {
+                                self.i += 1;
+                                return;
+                            }
+                        },
+                        '"' => {
+                            self.i += 2;
+                            continue;
+                        },
+                        else => {},
+                    }
+                    self.i += 1;
+                }
             },
-            .FloatFinite => blk: {
-                if (field_value != .float) break :blk false;
-                break :blk validators.validateFinite(field_value.float);
+            '}', ']', ':', ',' => return error.SyntaxError,
+            else => self.i += 1,
+        }
+    }
+};
+
+/// Indexed counterpart of validateObjectTokens (cursor is on the `{`)
+fn validateObjectIndexed(
+    walker: *IndexWalker,
+    scratch: std.mem.Allocator,
+    field_specs: []const FieldSpec,
+) !ValidationResult {
+    var seen = std.StaticBitSet(max_fields).initEmpty();
+    var error_field: ?[]const u8 = null;
+
+    try walker.expect('{');
+    if (walker.peekIs('}')) {
+        walker.i += 1;
+    } else while (true) {
+        const key = try walker.string(scratch);
+        try walker.expect(':');
+
+        if (if (error_field == null) findField(field_specs, key) else null) |index| {
+            seen.set(index);
+            const probe = stats.begin();
+            const ok = try validateValueIndexed(walker, scratch, field_specs[index]);
+            stats.end(stats.slotOf(field_specs[index].validator_type), ok, probe);
+            if (!ok) error_field = field_specs[index].name;
+        } else {
+            try walker.skipValue();
+        }
+
+        switch (walker.peek() orelse return error.UnexpectedEndOfInput) {
+            ',' => walker.i += 1,
+            '}' => {
+                walker.i += 1;
+                break;
             },
-            .Boolean => field_value == .bool,
-        };
-        
-        if (!is_valid) {
-            return .{ .is_valid = false, .error_field = spec.name };
+            else => return error.SyntaxError,
         }
     }
-    
+
+    if (error_field) |name| return .{ .is_valid = false, .error_field = name };
+    for (field_specs, 0..) |spec, i| {
+        if (!seen.isSet(i)) return .{ .is_valid = false, .error_field = spec.name };
+    }
     return .{ .is_valid = true };
 }
 
-fn validateIntField(value: std.json.Value, min: i64, max: i64) bool {
-    if (value != .integer) return false;
-    const int_val = value.integer;
-    return int_val >= min and int_val <= max;
+fn validateValueIndexed(walker: *IndexWalker, scratch: std.mem.Allocator, spec: FieldSpec) !bool {
+    switch (walker.peek() orelse return error.UnexpectedEndOfInput) {
+        '{', '[' => {
+            try walker.skipValue();
+            return false;
+        },
+        '"' => return checkString(spec, try walker.string(scratch)),
+        '}', ']', ':', ',' => return error.SyntaxError,
+        else => {
+            const atom = walker.scalar();
+            if (std.mem.eql(u8, atom, "true") or std.mem.eql(u8, atom, "false")) {
+                return spec.validator_type == .Boolean;
+            }
+            if (std.mem.eql(u8, atom, "null")) return false;
+            if (!isJsonNumber(atom)) return error.SyntaxError;
+            return checkNumber(spec, atom);
+        },
+    }
+}
+
+/// -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+fn isJsonNumber(s: []const u8) bool {
+    var i: usize = 0;
+    if (i < s.len and s[i] == '-') i += 1;
+    if (i >= s.len) return false;
+    if (s[i] == '0') {
+        i += 1;
+    } else if (std.ascii.isDigit(s[i])) {
+        while (i < s.len and std.ascii.isDigit(s[i])) i += 1;
+    } else return false;
+
+    if (i < s.len and s[i] == '.') {
+        i += 1;
+        const start = i;
+        while (i < s.len and std.ascii.isDigit(s[i])) i += 1;
+        if (i == start) return false;
+    }
+    if (i < s.len and (s[i] == 'e' or s[i] == 'E')) {
+        i += 1;
+        if (i < s.len and (s[i] == '+' or s[i] == '-')) i += 1;
+        const start = i;
+        while (i < s.len and std.ascii.isDigit(s[i])) i += 1;
+        if (i == start) return false;
+    }
+    return i == s.len;
+}
+
+fn checkString(spec: FieldSpec, str: []const u8) bool {
+    return switch (spec.validator_type) {
+        .String => str.len >= lenParam(spec.param1) and str.len <= lenParam(spec.param2),
+        .StringMinLen => str.len >= lenParam(spec.param1),
+        .StringMaxLen => str.len <= lenParam(spec.param1),
+        .Email => validators.validateEmail(str),
+        .Url => validators.validateUrl(str),
+        .Uuid => validators.validateUuid(str),
+        .Ipv4 => validators.validateIpv4(str),
+        .Base64 => validators.validateBase64(str),
+        .IsoDate => validators.validateIsoDate(str),
+        .IsoDatetime => validators.validateIsoDatetime(str),
+        .Pattern => if (spec.pattern) |re| re.isMatch(str) else false,
+        else => false,
+    };
+}
+
+/// `number` is the raw token text; ints must be integer-formatted and fit in i64
+fn checkNumber(spec: FieldSpec, number: []const u8) bool {
+    const is_int = std.json.isNumberFormattedLikeAnInteger(number);
+    switch (spec.validator_type) {
+        .Int, .IntGt, .IntGte, .IntLt, .IntLte, .IntPositive, .IntNonNegative, .IntMultipleOf => {
+            if (!is_int) return false;
+            const value = std.fmt.parseInt(i64, number, 10) catch return false;
+            return switch (spec.validator_type) {
+                .Int => value >= spec.param1 and value <= spec.param2,
+                .IntGt => validators.validateGt(i64, value, spec.param1),
+                .IntGte => validators.validateGte(i64, value, spec.param1),
+                .IntLt => validators.validateLt(i64, value, spec.param1),
+                .IntLte => validators.validateLte(i64, value, spec.param1),
+                .IntPositive => validators.validatePositive(i64, value),
+                .IntNonNegative => validators.validateNonNegative(i64, value),
+                .IntMultipleOf => validators.validateMultipleOf(i64, value, spec.param1),
+                else => unreachable,
+            };
+        },
+        .Float => return true,
+        .FloatGt => {
+            const value = std.fmt.parseFloat(f64, number) catch return false;
+            return validators.validateGt(f64, value, @as(f64, @floatFromInt(spec.param1)));
+        },
+        .FloatFinite => {
+            if (is_int) return false;
+            const value = std.fmt.parseFloat(f64, number) catch return false;
+            return validators.validateFinite(value);
+        },
+        else => return false,
+    }
 }
 
-fn validateStringField(value: std.json.Value, min_len: i64, max_len: i64) bool {
-    if (value != .string) return false;
-    const len = value.string.len;
-    return len >= @as(usize, @intCast(min_len)) and len <= @as(usize, @intCast(max_len));
+/// Negative length bounds clamp to 0
+inline fn lenParam(param: i64) usize {
+    return if (param < 0) 0 else @intCast(param);
 }
 
 test "JSON array validation" {
@@ -200,3 +714,195 @@ test "JSON array validation" {
     try std.testing.expect(results[1].is_valid);
     try std.testing.expect(!results[2].is_valid); // Multiple failures
 }
+
+test "email - same verdict on the single, batch, bitmap and JSON paths" {
+    const allocator = std.testing.allocator;
+    const emails = [_][*:0]const u8{ "alice@example.com", "first last@example.org", "@example.com", "bob@example" };
+    const expected = [_]bool{ true, false, false, false };
+
+    var bytes: [emails.len]u8 = undefined;
+    var bits: [1]u8 = undefined;
+    try std.testing.expectEqual(@as(usize, 1), batch.validateEmailBatch(&emails, &bytes));
+    try std.testing.expectEqual(@as(usize, 1), batch.validateEmailBatchBitmap(&emails, &bits));
+
+    const specs = [_]FieldSpec{.{ .name = "email", .validator_type = .Email }};
+    for (emails, expected, 0..) |email, valid, i| {
+        const span = std.mem.span(email);
+        try std.testing.expectEqual(valid, validators.validateEmail(span));
+        try std.testing.expectEqual(@as(u8, @intFromBool(valid)), bytes[i]);
+        try std.testing.expectEqual(@as(u8, @intFromBool(valid)), (bits[0] >> @intCast(i)) & 1);
+
+        const json = try std.fmt.allocPrint(allocator, "[{{\"email\": \"{s}\"}}]", .{span});
+        defer allocator.free(json);
+        const results = try validateJsonArray(json, &specs, allocator);
+        defer allocator.free(results);
+        try std.testing.expectEqual(valid, results[0].is_valid);
+    }
+}
+
+test "JSON array validation - pattern fields" {
+    const allocator = std.testing.allocator;
+    var sku = try regex.compile(allocator, "^[A-Z]{3}-\\d{4}$");
+    defer sku.deinit(allocator);
+
+    const specs = [_]FieldSpec{.{ .name = "sku", .validator_type = .Pattern, .pattern = &sku }};
+    const results = try validateJsonArray("[{\"sku\": \"ABC-1234\"}, {\"sku\": \"ABC\"}, {\"sku\": 1234}]", &specs, allocator);
+    defer allocator.free(results);
+
+    try std.testing.expect(results[0].is_valid);
+    try std.testing.expect(!results[1].is_valid);
+    try std.testing.expect(!results[2].is_valid);
+}
+
+test "streaming validation - skips unknown keys and nested values" {
+    const allocator = std.testing.allocator;
+
+    const json =
+        \\[
+        \\  {"id": 1, "meta": {"tags": ["a", "b"]}, "name": "Al\u0069ce", "age": 25},
+        \\  {"name": "Bob", "age": 30.5},
+        \\  {"name": "Carol", "age": {"years": 40}},
+        \\  "not an object",
+        \\  {"age": 50}
+        \\]
+    ;
+
+    const specs = [_]FieldSpec{
+        .{ .name = "name", .validator_type = .String, .param1 = 2, .param2 = 100 },
+        .{ .name = "age", .validator_type = .Int, .param1 = 18, .param2 = 120 },
+    };
+
+    const results = try validateJsonArray(json, &specs, allocator);
+    defer allocator.free(results);
+
+    try std.testing.expectEqual(@as(usize, 5), results.len);
+    try std.testing.expect(results[0].is_valid);
+    try std.testing.expectEqualStrings("age", results[1].error_field.?); // float for int
+    try std.testing.expectEqualStrings("age", results[2].error_field.?); // object for int
+    try std.testing.expect(!results[3].is_valid);
+    try std.testing.expectEqualStrings("name", results[4].error_field.?); // missing
+}
+
+test "streaming validation - malformed input" {
+    const allocator = std.testing.allocator;
+    const specs = [_]FieldSpec{.{ .name = "a", .validator_type = .Boolean }};
+
+    try std.testing.expectError(error.ExpectedArray, validateJsonArray("{\"a\": true}", &specs, allocator));
+    try std.testing.expectError(error.UnexpectedEndOfInput, validateJsonArray("[{\"a\": true}", &specs, allocator));
+}
+
+test "indexed validation - matches tokenizer" {
+    const allocator = std.testing.allocator;
+
+    const Collector = struct {
+        results: [16]bool = undefined,
+
+        pub fn put(self: *@This(), index: usize, result: ValidationResult) !void {
+            self.results[index] = result.is_valid;
+        }
+    };
+
+    const specs = [_]FieldSpec{
+        .{ .name = "name", .validator_type = .String, .param1 = 2, .param2 = 100 },
+        .{ .name = "age", .validator_type = .Int, .param1 = 18, .param2 = 120 },
+        .{ .name = "ok", .validator_type = .Boolean },
+    };
+    const json =
+        \\[ {"name": "Al\"ice", "age": 25, "ok": true, "skip": [{"a": "]}"}, -1.5e3]},
+        \\  {"name": "Bob", "age": 2.5e1, "ok": false},
+        \\  {"age": 40, "ok": null, "name": "Carol"},
+        \\  {"n\u0061me": "Dave", "age": 0, "ok": false},
+        \\  {"name": "Eve", "age": 99, "ok": true}, [], 7, {} ]
+    ;
+
+    var tokens: Collector = .{};
+    var indexed: Collector = .{};
+    const token_count = try validateJsonArrayTokens(json, &specs, allocator, &tokens);
+    const indexed_count = try validateJsonArrayIndexed(json, &specs, allocator, &indexed);
+
+    try std.testing.expectEqual(@as(usize, 8), token_count);
+    try std.testing.expectEqual(token_count, indexed_count);
+    try std.testing.expectEqualSlices(bool, tokens.results[0..token_count], indexed.results[0..indexed_count]);
+    try std.testing.expectEqualSlices(bool, &.{ true, false, false, false, true, false, false, false }, indexed.results[0..8]);
+
+    try std.testing.expectError(error.ExpectedArray, validateJsonArrayIndexed("{}", &specs, allocator, &indexed));
+    try std.testing.expectError(error.SyntaxError, validateJsonArrayIndexed("[{}] {}", &specs, allocator, &indexed));
+    try std.testing.expectError(error.SyntaxError, validateJsonArrayIndexed("[{\"age\": 01}]", &specs, allocator, &indexed));
+}
+
+test "ndjson validation - bad lines are invalid records" {
+    const allocator = std.testing.allocator;
+
+    const Collector = struct {
+        results: [8]bool = undefined,
+
+        pub fn put(self: *@This(), index: usize, result: ValidationResult) !void {
+            self.results[index] = result.is_valid;
+        }
+    };
+
+    const specs = [_]FieldSpec{
+        .{ .name = "name", .validator_type = .String, .param1 = 2, .param2 = 100 },
+        .{ .name = "age", .validator_type = .Int, .param1 = 18, .param2 = 120 },
+    };
+    const ndjson = "{\"name\": \"Alice\", \"age\": 25}\r\n" ++
+        "\n" ++
+        "{\"name\": \"Bob\", \"age\": 12}\n" ++
+        "{\"name\": \"Carol\", \n" ++
+        "[1, 2]\n" ++
+        "{\"name\": \"Dave\", \"age\": 40} {}\n" ++
+        "  {\"age\": 33, \"name\": \"Eve\"}";
+
+    var collector: Collector = .{};
+    const count = try validateNdjsonStream(ndjson, &specs, allocator, &collector);
+
+    try std.testing.expectEqual(@as(usize, 6), count);
+    try std.testing.expectEqualSlices(bool, &.{ true, false, false, false, false, true }, collector.results[0..6]);
+}
+
+test "collect-all-errors mode - every failing field" {
+    const allocator = std.testing.allocator;
+
+    const specs = [_]FieldSpec{
+        .{ .name = "name", .validator_type = .String, .param1 = 2, .param2 = 100 },
+        .{ .name = "age", .validator_type = .Int, .param1 = 18, .param2 = 120 },
+        .{ .name = "email", .validator_type = .Email },
+        .{ .name = "score", .validator_type = .IntMultipleOf, .param1 = 5 },
+    };
+    const json =
+        \\[
+        \\  {"name": "Alice", "age": 25, "email": "alice@example.com", "score": 10},
+        \\  {"name": "X", "age": 150, "email": "invalid", "score": 7},
+        \\  {"age": "old", "extra": [1, 2], "email": "bob@example.com", "score": 5},
+        \\  42
+        \\]
+    ;
+
+    var report: ErrorReport = .{};
+    defer report.deinit(allocator);
+    try std.testing.expectEqual(@as(usize, 4), try validateJsonArrayErrors(json, &specs, allocator, &report));
+
+    const data = try report.pack(allocator);
+    defer allocator.free(data);
+    const n = report.len();
+    try std.testing.expectEqual(@as(usize, 7), n);
+
+    const V = error_report.Violation;
+    const expected = [_]V{
+        .{ .item_index = 1, .field_index = 0, .code = .too_small, .param = 2 },
+        .{ .item_index = 1, .field_index = 1, .code = .too_large, .param = 120 },
+        .{ .item_index = 1, .field_index = 2, .code = .invalid_format, .param = 0 },
+        .{ .item_index = 1, .field_index = 3, .code = .not_multiple, .param = 5 },
+        .{ .item_index = 2, .field_index = 0, .code = .missing, .param = 0 },
+        .{ .item_index = 2, .field_index = 1, .code = .wrong_type, .param = 0 },
+        .{ .item_index = 3, .field_index = error_report.no_field, .code = .not_an_object, .param = 0 },
+    };
+    for (expected, 0..) |violation, i| {
+        try std.testing.expectEqual(violation, error_report.get(data, n, i));
+    }
+
+    // Items without violations are exactly the ones the fast path accepts
+    const results = try validateJsonArray(json, &specs, allocator);
+    defer allocator.free(results);
+    try std.testing.expect(results[0].is_valid and !results[1].is_valid and !results[2].is_valid);
+}
@@ -0,0 +1,166 @@
+/// SIMD structural indexing for JSON (simdjson-style stage 1)
+/// Classifies 64 bytes per step into bitmasks and records the offset of
+/// every structural character ({ } [ ] : ,), both quotes of every string
+/// and the first byte of every scalar (number, true, false, null).
+/// Validators then walk the index instead of the bytes
+/// (see json_batch_validator.zig).
+const std = @import("std");
+
+pub const block_size = 64;
+const Block = @Vector(block_size, u8);
+
+/// Offsets are u32; larger inputs must use the byte-at-a-time scanner
+pub const max_input_len: usize = std.math.maxInt(u32);
+
+pub const Error = error{ UnclosedString, InputTooLarge, OutOfMemory };
+
+/// Offsets of structural bytes in input order; caller owns `positions`
+pub const StructuralIndex = struct {
+    positions: []u32,
+
+    pub fn deinit(self: *StructuralIndex, allocator: std.mem.Allocator) void {
+        allocator.free(self.positions);
+    }
+};
+
+inline fn eqMask(block: Block, c: u8) u64 {
+    return @bitCast(block == @as(Block, @splat(c)));
+}
+
+/// XOR of all lower bits into each bit: turns quote bits into a mask that is
+/// set from an opening quote up to (not including) its closing quote.
+/// Same result as a carry-less multiply of the quote mask by all ones.
+inline fn prefixXor(bits: u64) u64 {
+    var x = bits;
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+/// Bits of characters escaped by an odd-length run of backslashes
+/// `prev_odd` is 1 when the previous block ended in such a run.
+inline fn escapedMask(backslash: u64, prev_odd: *u64) u64 {
+    const even_bits: u64 = 0x5555_5555_5555_5555;
+    const odd_bits: u64 = ~even_bits;
+
+    const start_edges = backslash & ~(backslash << 1);
+    const even_start_mask = even_bits ^ prev_odd.*;
+    const even_starts = start_edges & even_start_mask;
+    const odd_starts = start_edges & ~even_start_mask;
+
+    const even_carries = backslash +% even_starts;
+    const odd_sum = @addWithOverflow(backslash, odd_starts);
+    const odd_carries = odd_sum[0] | prev_odd.*;
+    prev_odd.* = odd_sum[1];
+
+    const even_carry_ends = even_carries & ~backslash;
+    const odd_carry_ends = odd_carries & ~backslash;
+    return (even_carry_ends & odd_bits) | (odd_carry_ends & even_bits);
+}
+
+/// Classification state carried from one block to the next
+const Scanner = struct {
+    prev_odd_backslash: u64 = 0,
+    in_string: u64 = 0, // all ones when the previous block ended inside a string
+    prev_scalar: u64 = 0, // 1 when the previous block ended on a scalar byte
+
+    /// Structural bits of one 64-byte block
+    fn next(self: *Scanner, block: Block) u64 {
+        const escaped = escapedMask(eqMask(block, '\\'), &self.prev_odd_backslash);
+        const quote = eqMask(block, '"') & ~escaped;
+
+        const in_string = prefixXor(quote) ^ self.in_string;
+        self.in_string = @bitCast(@as(i64, @bitCast(in_string)) >> 63);
+
+        const op = eqMask(block, '{') | eqMask(block, '}') | eqMask(block, '[') |
+            eqMask(block, ']') | eqMask(block, ':') | eqMask(block, ',');
+        const whitespace = eqMask(block, ' ') | eqMask(block, '\t') |
+            eqMask(block, '\n') | eqMask(block, '\r');
+
+        // Scalars: anything outside strings that isn't an operator, space or quote
+        const scalar = ~(op | whitespace | quote | in_string);
+        const scalar_start = scalar & ~((scalar << 1) | self.prev_scalar);
+        self.prev_scalar = scalar >> 63;
+
+        return (op & ~in_string) | quote | scalar_start;
+    }
+};
+
+/// Build the structural index of `json`
+/// Fails with UnclosedString when the input ends inside a string.
+pub fn buildIndex(allocator: std.mem.Allocator, json: []const u8) Error!StructuralIndex {
+    if (json.len > max_input_len) return error.InputTooLarge;
+
+    var positions: std.ArrayList(u32) = .empty;
+    errdefer positions.deinit(allocator);
+    // Typical JSON has one structural byte per 4-8 input bytes
+    try positions.ensureTotalCapacity(allocator, json.len / 4 + 16);
+
+    var scanner: Scanner = .{};
+    var offset: usize = 0;
+    while (offset < json.len) : (offset += block_size) {
+        const block: Block = if (offset + block_size <= json.len)
+            json[offset..][0..block_size].*
+        else blk: {
+            // Pad the tail with spaces (never structural)
+            var tail = [_]u8{' '} ** block_size;
+            @memcpy(tail[0 .. json.len - offset], json[offset..]);
+            break :blk tail;
+        };
+
+        var bits = scanner.next(block);
+        try positions.ensureUnusedCapacity(allocator, @popCount(bits));
+        while (bits != 0) : (bits &= bits - 1) {
+            positions.appendAssumeCapacity(@intCast(offset + @ctz(bits)));
+        }
+    }
+
+    if (scanner.in_string != 0) return error.UnclosedString;
+    return .{ .positions = try positions.toOwnedSlice(allocator) };
+}
+
+test "prefixXor marks string interiors" {
+    // quotes at bits 1 and 5
+    try std.testing.expectEqual(@as(u64, 0b1_1110), prefixXor(0b10_0010));
+}
+
+test "escapedMask - odd and even backslash runs" {
+    var prev: u64 = 0;
+    // \" at 0-1 (escaped), \\" at 3-5 (quote not escaped)
+    const backslash: u64 = 0b01_1001;
+    const escaped = escapedMask(backslash, &prev);
+    try std.testing.expect(escaped & (1 << 1) != 0);
+    try std.testing.expect(escaped & (1 << 5) == 0);
+    try std.testing.expectEqual(@as(u64, 0), prev);
+
+    // Run at the top of a block carries into the next one
+    _ = escapedMask(@as(u64, 1) << 63, &prev);
+    try std.testing.expectEqual(@as(u64, 1), prev);
+    try std.testing.expectEqual(@as(u64, 1), escapedMask(0, &prev) & 1);
+}
+
+test "buildIndex - small document" {
+    const json = "{\"a\\\"b\": [1, true], \"c\": \"x,y\"}";
+    var index = try buildIndex(std.testing.allocator, json);
+    defer index.deinit(std.testing.allocator);
+
+    var found: [32]u8 = undefined;
+    for (index.positions, 0..) |p, i| found[i] = json[p];
+    try std.testing.expectEqualStrings("{\"\":[1,t],\"\":\"\"}", found[0..index.positions.len]);
+}
+
+test "buildIndex - strings spanning blocks" {
+    const allocator = std.testing.allocator;
+    const json = "[\"" ++ "\\\\" ** 40 ++ "\\\"" ++ "x" ** 30 ++ "\", 12345]";
+    var index = try buildIndex(allocator, json);
+    defer index.deinit(allocator);
+
+    const expected = [_]u32{ 0, 1, json.len - 9, json.len - 8, json.len - 6, json.len - 1 };
+    try std.testing.expectEqualSlices(u32, &expected, index.positions);
+
+    try std.testing.expectError(error.UnclosedString, buildIndex(allocator, "[\"abc"));
+}
@@ -1,5 +1,6 @@
 const std = @import("std");
 const validator = @import("validator");
+const bitmap = @import("bitmap.zig");
 
 /// ParseAndValidate combines JSON parsing with validation in one step.
 /// Inspired by satya's StreamValidator pattern.
@@ -7,16 +8,35 @@ const validator = @import("validator");
 /// Example:
 ///   const user = try parseAndValidate(User, json_string, allocator);
 pub fn parseAndValidate(comptime T: type, json_str: []const u8, allocator: std.mem.Allocator) !T {
+    return parseAndValidateLogged(T, json_str, allocator, true);
+}
+
+/// parseAndValidate with `log_errors` as in fromJsonValue
+fn parseAndValidateLogged(comptime T: type, json_str: []const u8, allocator: std.mem.Allocator, comptime log_errors: bool) !T {
     // Parse JSON to intermediate representation
     const parsed = try std.json.parseFromSlice(std.json.Value, allocator, json_str, .{});
     defer parsed.deinit();
 
     // Convert to target type with validation
-    return try fromJsonValue(T, parsed.value, allocator);
+    return try fromJsonValue(T, parsed.value, allocator, log_errors);
 }
 
 /// Convert a JSON Value to a typed struct with validation
-fn fromJsonValue(comptime T: type, value: std.json.Value, allocator: std.mem.Allocator) !T {
+/// `log_errors` prints validation errors to stderr (off for bulk streams)
+fn fromJsonValue(comptime T: type, value: std.json.Value, allocator: std.mem.Allocator, comptime log_errors: bool) !T {
+    var errors = validator.ValidationErrors.init(allocator);
+    defer errors.deinit();
+    return fromJsonValueCollect(T, value, allocator, &errors, log_errors);
+}
+
+/// fromJsonValue with errors collected into `errors` (which may be arena-backed)
+fn fromJsonValueCollect(
+    comptime T: type,
+    value: std.json.Value,
+    allocator: std.mem.Allocator,
+    errors: *validator.ValidationErrors,
+    comptime log_errors: bool,
+) !T {
     const type_info = @typeInfo(T);
 
     switch (type_info) {
@@ -24,8 +44,6 @@ fn fromJsonValue(comptime T: type, value: std.json.Value, allocator: std.mem.All
             if (value != .object) return error.ExpectedObject;
 
             var result: T = undefined;
-            var errors = validator.ValidationErrors.init(allocator);
-            defer errors.deinit();
 
             // Process fields manually to avoid comptime control flow issues
             comptime var field_index = 0;
@@ -47,38 +65,22 @@ fn fromJsonValue(comptime T: type, value: std.json.Value, allocator: std.mem.All
                     if (field_result) |field_value| {
                         @field(result, field.name) = field_value;
                     } else |err| {
-                        const msg = try std.fmt.allocPrint(allocator, "Invalid value: {}", .{err});
-                        defer allocator.free(msg);
-                        try errors.add(field.name, msg);
-                        // Set default values based on type
-                        @field(result, field.name) = switch (@typeInfo(field.type)) {
-                            .@"bool" => false,
-                            .@"int" => 0,
-                            .@"float" => 0.0,
-                            .@"pointer" => |ptr_info| blk: {
-                                if (ptr_info.size == .slice and ptr_info.child == u8) {
-                                    break :blk "";
-                                } else {
-                                    return error.UnsupportedType;
-                                }
-                            },
-                            .@"optional" => null,
-                            else => return error.UnsupportedType,
-                        };
+                        try errors.addFmt(field.name, "Invalid value: {}", .{err});
+                        @field(result, field.name) = try placeholder(field.type);
                     }
                 }
             }
 
             if (errors.hasErrors()) {
-                std.debug.print("JSON validation errors:\n{f}\n", .{errors});
+                if (log_errors) std.debug.print("JSON validation errors:\n{f}\n", .{errors.*});
                 return error.ValidationFailed;
             }
 
             // Run additional struct-level validation
-            try validator.validateStruct(T, result, &errors);
+            try validator.validateStruct(T, result, errors);
 
             if (errors.hasErrors()) {
-                std.debug.print("Struct validation errors:\n{f}\n", .{errors});
+                if (log_errors) std.debug.print("Struct validation errors:\n{f}\n", .{errors.*});
                 return error.ValidationFailed;
             }
 
@@ -88,6 +90,18 @@ fn fromJsonValue(comptime T: type, value: std.json.Value, allocator: std.mem.All
     }
 }
 
+/// Value stored in a field that failed to convert (the item is invalid anyway)
+fn placeholder(comptime T: type) !T {
+    return switch (@typeInfo(T)) {
+        .@"bool" => false,
+        .@"int" => 0,
+        .@"float" => 0.0,
+        .@"pointer" => |ptr_info| if (ptr_info.size == .slice and ptr_info.child == u8) "" else error.UnsupportedType,
+        .@"optional" => null,
+        else => error.UnsupportedType,
+    };
+}
+
 /// Convert JSON value to a specific type
 fn fromJsonValueTyped(comptime T: type, value: std.json.Value, allocator: std.mem.Allocator) !T {
     const type_info = @typeInfo(T);
@@ -125,7 +139,7 @@ pub fn batchValidate(comptime T: type, json_array: []const u8, allocator: std.me
     var results = try allocator.alloc(validator.ValidationResult(T), items.len);
 
     for (items, 0..) |item, i| {
-        const result = fromJsonValue(T, item, allocator);
+        const result = fromJsonValue(T, item, allocator, true);
         if (result) |val| {
             results[i] = validator.ValidationResult(T){ .valid = val };
         } else |_| {
@@ -138,32 +152,425 @@ pub fn batchValidate(comptime T: type, json_array: []const u8, allocator: std.me
     return results;
 }
 
+/// BatchValidate with the per-item errors collected in `arena`
+/// Invalid results carry every field error (not just "Validation failed")
+/// without per-error heap traffic; they stay valid until `arena.reset()`.
+/// Valid values are allocated with `allocator` as in batchValidate.
+pub fn batchValidateArena(
+    comptime T: type,
+    json_array: []const u8,
+    allocator: std.mem.Allocator,
+    arena: *validator.ErrorArena,
+) ![]validator.ValidationResult(T) {
+    const parsed = try std.json.parseFromSlice(std.json.Value, allocator, json_array, .{});
+    defer parsed.deinit();
+
+    if (parsed.value != .array) return error.ExpectedArray;
+
+    const items = parsed.value.array.items;
+    var results = try allocator.alloc(validator.ValidationResult(T), items.len);
+
+    for (items, 0..) |item, i| {
+        var errors = arena.errors();
+        const result = fromJsonValueCollect(T, item, allocator, &errors, false);
+        if (result) |val| {
+            results[i] = validator.ValidationResult(T){ .valid = val };
+        } else |err| {
+            if (!errors.hasErrors()) try errors.add("item", @errorName(err));
+            results[i] = validator.ValidationResult(T){ .invalid = errors };
+        }
+    }
+
+    return results;
+}
+
+/// parseAndValidate without heap allocation. Strings in the result are
+/// slices of `json_str` unless they need unescaping; escaped strings and the
+/// parser's nesting state go into `scratch` (error.OutOfMemory when it runs
+/// out). Field errors go to `errors`; with a collector from ErrorArena.errors()
+/// failures are allocation-free after warm-up too. The result borrows from
+/// both `json_str` and `scratch`.
+pub fn parseAndValidateBorrowed(
+    comptime T: type,
+    json_str: []const u8,
+    scratch: []u8,
+    errors: *validator.ValidationErrors,
+) !T {
+    var fba = std.heap.FixedBufferAllocator.init(scratch);
+    var scanner = std.json.Scanner.initCompleteInput(fba.allocator(), json_str);
+    defer scanner.deinit();
+
+    const value = try borrowedStruct(T, &scanner, fba.allocator(), errors);
+    if (try scanner.next() != .end_of_document) return error.SyntaxError;
+    return value;
+}
+
+/// batchValidateArena into caller-provided storage, without heap allocation:
+/// each element of `json_array` is parsed as in parseAndValidateBorrowed into
+/// `out`, sharing `scratch`. Returns the filled prefix of `out`
+/// (error.NoSpaceLeft when the array has more elements). Invalid results
+/// carry their errors in `arena`, valid until `arena.reset()`.
+pub fn batchValidateInto(
+    comptime T: type,
+    json_array: []const u8,
+    out: []validator.ValidationResult(T),
+    scratch: []u8,
+    arena: *validator.ErrorArena,
+) ![]validator.ValidationResult(T) {
+    var fba = std.heap.FixedBufferAllocator.init(scratch);
+    var scanner = std.json.Scanner.initCompleteInput(fba.allocator(), json_array);
+    defer scanner.deinit();
+
+    if (try scanner.next() != .array_begin) return error.ExpectedArray;
+    var count: usize = 0;
+    while (try scanner.peekNextTokenType() != .array_end) : (count += 1) {
+        if (count == out.len) return error.NoSpaceLeft;
+        var errors = arena.errors();
+        if (borrowedStruct(T, &scanner, fba.allocator(), &errors)) |val| {
+            out[count] = .{ .valid = val };
+        } else |err| switch (err) {
+            error.ValidationFailed, error.ExpectedObject => {
+                if (!errors.hasErrors()) try errors.add("item", @errorName(err));
+                out[count] = .{ .invalid = errors };
+            },
+            else => return err,
+        }
+    }
+    _ = try scanner.next();
+    if (try scanner.next() != .end_of_document) return error.SyntaxError;
+    return out[0..count];
+}
+
+/// fromJsonValueCollect straight from tokens: one object into T. Consumes the
+/// whole value (a non-object is skipped and reported as error.ExpectedObject).
+fn borrowedStruct(
+    comptime T: type,
+    scanner: *std.json.Scanner,
+    allocator: std.mem.Allocator,
+    errors: *validator.ValidationErrors,
+) !T {
+    const fields = @typeInfo(T).@"struct".fields;
+    if (try scanner.peekNextTokenType() != .object_begin) {
+        try scanner.skipValue();
+        return error.ExpectedObject;
+    }
+    _ = try scanner.next();
+
+    var result: T = undefined;
+    var seen = std.StaticBitSet(fields.len).initEmpty();
+    while (true) {
+        const key: []const u8 = switch (try scanner.nextAlloc(allocator, .alloc_if_needed)) {
+            .object_end => break,
+            .string => |key| key,
+            .allocated_string => |key| key,
+            else => return error.SyntaxError,
+        };
+        var matched = false;
+        inline for (fields, 0..) |field, i| {
+            if (!matched and std.mem.eql(u8, key, field.name)) {
+                matched = true;
+                seen.set(i);
+                if (borrowedValue(field.type, scanner, allocator)) |field_value| {
+                    @field(result, field.name) = field_value;
+                } else |err| switch (err) {
+                    error.TypeMismatch, error.IntegerOverflow, error.UnsupportedType => {
+                        try errors.addFmt(field.name, "Invalid value: {}", .{err});
+                        @field(result, field.name) = try placeholder(field.type);
+                    },
+                    else => return err,
+                }
+            }
+        }
+        if (!matched) try scanner.skipValue();
+    }
+
+    inline for (fields, 0..) |field, i| {
+        if (!seen.isSet(i)) {
+            if (@typeInfo(field.type) == .@"optional") {
+                @field(result, field.name) = null;
+            } else {
+                try errors.add(field.name, "Required field missing");
+            }
+        }
+    }
+    if (errors.hasErrors()) return error.ValidationFailed;
+
+    try validator.validateStruct(T, result, errors);
+    if (errors.hasErrors()) return error.ValidationFailed;
+    return result;
+}
+
+/// fromJsonValueTyped from the next value's tokens; strings are borrowed when
+/// possible. Always consumes the whole value.
+fn borrowedValue(comptime T: type, scanner: *std.json.Scanner, allocator: std.mem.Allocator) !T {
+    const next = try scanner.peekNextTokenType();
+    if (@typeInfo(T) == .@"optional") {
+        if (next == .null) {
+            _ = try scanner.next();
+            return null;
+        }
+        return try borrowedValue(@typeInfo(T).@"optional".child, scanner, allocator);
+    }
+    if (next == .object_begin or next == .array_begin) {
+        try scanner.skipValue();
+        return error.TypeMismatch;
+    }
+
+    const token = try scanner.nextAlloc(allocator, .alloc_if_needed);
+    const text: ?[]const u8 = switch (token) {
+        .number, .string => |str| str,
+        .allocated_number, .allocated_string => |str| str,
+        else => null,
+    };
+    const is_number = token == .number or token == .allocated_number;
+    switch (@typeInfo(T)) {
+        .@"bool" => return switch (token) {
+            .true => true,
+            .false => false,
+            else => error.TypeMismatch,
+        },
+        .@"int" => {
+            // Same as std.json.Value: anything but an i64 literal is not an integer
+            if (!is_number or !std.json.isNumberFormattedLikeAnInteger(text.?)) return error.TypeMismatch;
+            const v = std.fmt.parseInt(i64, text.?, 10) catch return error.TypeMismatch;
+            return std.math.cast(T, v) orelse error.IntegerOverflow;
+        },
+        .@"float" => {
+            if (!is_number) return error.TypeMismatch;
+            const v = std.fmt.parseFloat(f64, text.?) catch return error.TypeMismatch;
+            return @floatCast(v);
+        },
+        .@"pointer" => |ptr_info| {
+            if (ptr_info.size != .slice or ptr_info.child != u8) return error.UnsupportedType;
+            return if (is_number) error.TypeMismatch else text orelse error.TypeMismatch;
+        },
+        else => return error.UnsupportedType,
+    }
+}
+
+/// Options for the NDJSON stream readers
+pub const StreamOptions = struct {
+    /// Bytes read per step; records are validated a chunk at a time
+    chunk_size: usize = 1 << 20,
+    /// Longest single record accepted (the buffer grows up to this)
+    max_record_len: usize = 64 << 20,
+};
+
 /// StreamValidate processes NDJSON (newline-delimited JSON) with constant memory.
 /// Inspired by satya's validate_stream pattern.
+/// Input is read in 1 MB chunks, so lines of any length up to
+/// `StreamOptions.max_record_len` are accepted. Valid values are allocated
+/// with `allocator` and owned by the callback.
 pub fn streamValidate(comptime T: type, reader: anytype, allocator: std.mem.Allocator, callback: fn (validator.ValidationResult(T)) anyerror!void) !void {
-    var line_buf: [4096]u8 = undefined;
+    var chunks = try ChunkReader(@TypeOf(reader)).init(reader, allocator, .{});
+    defer chunks.deinit();
+
+    while (try chunks.next()) |chunk| {
+        var records = RecordIterator{ .bytes = chunk.bytes };
+        while (records.next()) |record| {
+            const result = parseAndValidateLogged(T, record.line, allocator, false);
+            if (result) |val| {
+                const validation_result = validator.ValidationResult(T){ .valid = val };
+                try callback(validation_result);
+            } else |_| {
+                var errors = validator.ValidationErrors.init(allocator);
+                try errors.add("line", "Parse or validation failed");
+                const validation_result = validator.ValidationResult(T){ .invalid = errors };
+                try callback(validation_result);
+            }
+        }
+    }
+}
 
-    while (true) {
-        const line = reader.readUntilDelimiterOrEof(&line_buf, '\n') catch |err| {
-            if (err == error.EndOfStream) break;
-            return err;
-        } orelse break;
+/// Results for one chunk of NDJSON records
+/// All slices live in the stream's arena and are only valid inside `onBatch`.
+pub fn RecordBatch(comptime T: type) type {
+    return struct {
+        /// Stream-wide index of the first record in this batch
+        first_index: u64,
+        /// Stream byte offset of each record's first byte
+        offsets: []const u64,
+        /// Bit i (LSB-first, see bitmap.zig) is 1 when record i is valid
+        valid_bits: []const u8,
+        /// values[i] is only set when record i is valid
+        values: []const T,
+        valid_count: usize,
+
+        pub fn len(self: @This()) usize {
+            return self.offsets.len;
+        }
 
-        if (line.len == 0) continue;
+        pub fn isValid(self: @This(), i: usize) bool {
+            return bitmap.isValid(self.valid_bits, i);
+        }
 
-        const result = parseAndValidate(T, line, allocator);
-        if (result) |val| {
-            const validation_result = validator.ValidationResult(T){ .valid = val };
-            try callback(validation_result);
-        } else |_| {
-            var errors = validator.ValidationErrors.init(allocator);
-            try errors.add("line", "Parse or validation failed");
-            const validation_result = validator.ValidationResult(T){ .invalid = errors };
-            try callback(validation_result);
+        pub fn invalidIndices(self: @This()) bitmap.InvalidIterator {
+            return bitmap.invalidIterator(self.valid_bits, self.len());
         }
+    };
+}
+
+/// Totals for a whole stream
+pub const StreamStats = struct {
+    records: u64 = 0,
+    valid: u64 = 0,
+    bytes: u64 = 0,
+};
+
+/// StreamValidateBatches validates NDJSON a chunk at a time.
+/// Calls `sink.onBatch(RecordBatch(T))` once per chunk. Records may straddle
+/// chunk boundaries. Parsing uses an arena that is reset (keeping its
+/// capacity) after every chunk, so steady state does no allocation.
+pub fn streamValidateBatches(
+    comptime T: type,
+    reader: anytype,
+    allocator: std.mem.Allocator,
+    options: StreamOptions,
+    sink: anytype,
+) !StreamStats {
+    var chunks = try ChunkReader(@TypeOf(reader)).init(reader, allocator, options);
+    defer chunks.deinit();
+    var arena = std.heap.ArenaAllocator.init(allocator);
+    defer arena.deinit();
+
+    var stats: StreamStats = .{};
+    while (try chunks.next()) |chunk| {
+        defer _ = arena.reset(.retain_capacity);
+        const scratch = arena.allocator();
+
+        // Upper bound on records in this chunk
+        const max_records = std.mem.count(u8, chunk.bytes, "\n") + 1;
+        const offsets = try scratch.alloc(u64, max_records);
+        const values = try scratch.alloc(T, max_records);
+        const valid_bits = try scratch.alloc(u8, bitmap.byteLen(max_records));
+        @memset(valid_bits, 0);
+
+        var count: usize = 0;
+        var valid_count: usize = 0;
+        var records = RecordIterator{ .bytes = chunk.bytes };
+        while (records.next()) |record| : (count += 1) {
+            offsets[count] = chunk.offset + record.offset;
+            const parsed = std.json.parseFromSliceLeaky(std.json.Value, scratch, record.line, .{}) catch continue;
+            values[count] = fromJsonValue(T, parsed, scratch, false) catch continue;
+            bitmap.set(valid_bits, count, true);
+            valid_count += 1;
+        }
+        stats.bytes = chunk.offset + chunk.bytes.len;
+        if (count == 0) continue;
+
+        try sink.onBatch(RecordBatch(T){
+            .first_index = stats.records,
+            .offsets = offsets[0..count],
+            .valid_bits = valid_bits[0..bitmap.byteLen(count)],
+            .values = values[0..count],
+            .valid_count = valid_count,
+        });
+        stats.records += count;
+        stats.valid += valid_count;
     }
+    return stats;
 }
 
+/// Reads large chunks and hands out runs of whole lines
+/// A line longer than the buffer grows it, up to max_record_len.
+fn ChunkReader(comptime Reader: type) type {
+    return struct {
+        const Self = @This();
+
+        const Chunk = struct {
+            bytes: []const u8,
+            /// Stream offset of bytes[0]
+            offset: u64,
+        };
+
+        reader: Reader,
+        allocator: std.mem.Allocator,
+        buf: []u8,
+        max_record_len: usize,
+        filled: usize = 0,
+        consumed: usize = 0,
+        offset: u64 = 0,
+        eof: bool = false,
+
+        fn init(reader: Reader, allocator: std.mem.Allocator, options: StreamOptions) !Self {
+            const size = @max(1, @min(options.chunk_size, options.max_record_len));
+            return .{
+                .reader = reader,
+                .allocator = allocator,
+                .buf = try allocator.alloc(u8, size),
+                .max_record_len = @max(size, options.max_record_len),
+            };
+        }
+
+        fn deinit(self: *Self) void {
+            self.allocator.free(self.buf);
+        }
+
+        /// Next run of complete lines, or null at end of input
+        /// The last line of the input does not need a trailing newline.
+        fn next(self: *Self) !?Chunk {
+            // Move the partial line left over from the last chunk to the front
+            if (self.consumed > 0) {
+                std.mem.copyForwards(u8, self.buf, self.buf[self.consumed..self.filled]);
+                self.filled -= self.consumed;
+                self.offset += self.consumed;
+                self.consumed = 0;
+            }
+
+            while (true) {
+                while (!self.eof and self.filled < self.buf.len) {
+                    const n = try readSome(self.reader, self.buf[self.filled..]);
+                    if (n == 0) self.eof = true else self.filled += n;
+                }
+                if (self.filled == 0) return null;
+
+                if (std.mem.lastIndexOfScalar(u8, self.buf[0..self.filled], '\n')) |newline| {
+                    self.consumed = newline + 1;
+                } else if (self.eof) {
+                    self.consumed = self.filled;
+                } else {
+                    // A single line fills the whole buffer
+                    if (self.buf.len >= self.max_record_len) return error.RecordTooLong;
+                    const new_len = @min(self.buf.len * 2, self.max_record_len);
+                    self.buf = try self.allocator.realloc(self.buf, new_len);
+                    continue;
+                }
+                return .{ .bytes = self.buf[0..self.consumed], .offset = self.offset };
+            }
+        }
+    };
+}
+
+/// Reads from either a *std.Io.Reader or an older `read(buf)` style reader
+fn readSome(reader: anytype, buf: []u8) !usize {
+    if (@TypeOf(reader) == *std.Io.Reader) return reader.readSliceShort(buf);
+    return reader.read(buf);
+}
+
+/// Non-blank lines of a chunk with their offsets inside it
+const RecordIterator = struct {
+    bytes: []const u8,
+    pos: usize = 0,
+
+    const Record = struct {
+        line: []const u8,
+        offset: usize,
+    };
+
+    fn next(self: *RecordIterator) ?Record {
+        while (self.pos < self.bytes.len) {
+            const start = self.pos;
+            const end = std.mem.indexOfScalarPos(u8, self.bytes, start, '\n') orelse self.bytes.len;
+            self.pos = end + 1;
+
+            const line = std.mem.trim(u8, self.bytes[start..end], " \t\r");
+            if (line.len == 0) continue;
+            return .{ .line = line, .offset = @intFromPtr(line.ptr) - @intFromPtr(self.bytes.ptr) };
+        }
+        return null;
+    }
+};
+
 // ============================================================================
 // Tests
 // ============================================================================
@@ -261,3 +668,175 @@ test "batchValidate - array of objects" {
     try std.testing.expect(results[0].isValid());
     try std.testing.expect(results[1].isValid());
 }
+
+test "streamValidateBatches - records straddle chunks" {
+    const User = struct {
+        name: []const u8,
+        age: u8,
+    };
+
+    const ndjson = "{\"name\": \"Alice\", \"age\": 25}\n" ++
+        "\n" ++
+        "{\"name\": \"Bob\", \"age\": \"old\"}\r\n" ++
+        "{\"name\": \"" ++ "x" ** 100 ++ "\", \"age\": 40}\n" ++
+        "not json\n" ++
+        "{\"name\": \"Carol\", \"age\": 30}";
+
+    const Sink = struct {
+        valid: [8]bool = undefined,
+        offsets: [8]u64 = undefined,
+        name_lens: [8]usize = undefined,
+        batches: usize = 0,
+
+        pub fn onBatch(self: *@This(), batch: RecordBatch(User)) !void {
+            self.batches += 1;
+            for (0..batch.len()) |i| {
+                const index: usize = @intCast(batch.first_index + i);
+                self.valid[index] = batch.isValid(i);
+                self.offsets[index] = batch.offsets[i];
+                if (batch.isValid(i)) self.name_lens[index] = batch.values[i].name.len;
+            }
+        }
+    };
+
+    var stream = std.io.fixedBufferStream(ndjson);
+    var sink: Sink = .{};
+    const stats = try streamValidateBatches(User, stream.reader(), std.testing.allocator, .{ .chunk_size = 16 }, &sink);
+
+    try std.testing.expectEqual(@as(u64, 5), stats.records);
+    try std.testing.expectEqual(@as(u64, 3), stats.valid);
+    try std.testing.expectEqual(@as(u64, ndjson.len), stats.bytes);
+    try std.testing.expect(sink.batches > 1);
+    try std.testing.expectEqualSlices(bool, &.{ true, false, true, false, true }, sink.valid[0..5]);
+    try std.testing.expectEqual(@as(usize, 100), sink.name_lens[2]);
+    try std.testing.expectEqual(@as(u64, 0), sink.offsets[0]);
+    try std.testing.expectEqualStrings("not json", ndjson[@intCast(sink.offsets[3])..][0..8]);
+
+    // Lines longer than max_record_len are rejected
+    var short = std.io.fixedBufferStream(ndjson);
+    try std.testing.expectError(
+        error.RecordTooLong,
+        streamValidateBatches(User, short.reader(), std.testing.allocator, .{ .chunk_size = 16, .max_record_len = 64 }, &sink),
+    );
+}
+
+test "streamValidate - lines longer than 4 KB" {
+    const User = struct {
+        name: []const u8,
+    };
+
+    const ndjson = "{\"name\": \"" ++ "y" ** 5000 ++ "\"}\n\n{\"name\": 7}\n";
+
+    const Counter = struct {
+        var valid: usize = 0;
+        var invalid: usize = 0;
+
+        fn onResult(result: validator.ValidationResult(User)) anyerror!void {
+            var r = result;
+            switch (r) {
+                .valid => |user| {
+                    valid += 1;
+                    std.testing.allocator.free(user.name);
+                },
+                .invalid => {
+                    invalid += 1;
+                    r.deinit();
+                },
+            }
+        }
+    };
+
+    var reader = std.Io.Reader.fixed(ndjson);
+    try streamValidate(User, &reader, std.testing.allocator, Counter.onResult);
+    try std.testing.expectEqual(@as(usize, 1), Counter.valid);
+    try std.testing.expectEqual(@as(usize, 1), Counter.invalid);
+}
+
+test "parseAndValidateBorrowed - borrows unescaped strings" {
+    const User = struct {
+        name: []const u8,
+        city: []const u8,
+        age: u8,
+        nick: ?[]const u8,
+    };
+
+    const json =
+        \\{"name": "Rach", "city": "Z\u00fcrich", "extra": [1, {"a": 2}], "age": 27}
+    ;
+    var scratch: [256]u8 = undefined;
+    var errors = validator.ValidationErrors.init(std.testing.failing_allocator);
+    defer errors.deinit();
+
+    const user = try parseAndValidateBorrowed(User, json, &scratch, &errors);
+    try std.testing.expectEqualStrings("Rach", user.name);
+    try std.testing.expectEqual(@intFromPtr(json.ptr) + 10, @intFromPtr(user.name.ptr));
+    try std.testing.expectEqualStrings("Z\xc3\xbcrich", user.city);
+    try std.testing.expect(@intFromPtr(user.city.ptr) >= @intFromPtr(&scratch));
+    try std.testing.expectEqual(@as(u8, 27), user.age);
+    try std.testing.expectEqual(@as(?[]const u8, null), user.nick);
+
+    var arena = validator.ErrorArena.init(std.testing.allocator);
+    defer arena.deinit();
+    var failures = arena.errors();
+    try std.testing.expectError(error.ValidationFailed, parseAndValidateBorrowed(User, "{\"name\": 1, \"age\": 1.5}", &scratch, &failures));
+    try std.testing.expectEqual(@as(usize, 3), failures.count());
+}
+
+test "batchValidateInto - same results as batchValidateArena" {
+    const User = struct {
+        name: []const u8,
+        age: u8,
+    };
+
+    const json =
+        \\[
+        \\  {"name": "Alice", "age": 25},
+        \\  {"name": "Bob", "age": "old"},
+        \\  {"age": 300},
+        \\  7
+        \\]
+    ;
+
+    var arena = validator.ErrorArena.init(std.testing.allocator);
+    defer arena.deinit();
+    var scratch: [64]u8 = undefined;
+    var out: [4]validator.ValidationResult(User) = undefined;
+
+    const results = try batchValidateInto(User, json, &out, &scratch, &arena);
+    try std.testing.expectEqual(@as(usize, 4), results.len);
+    try std.testing.expectEqualStrings("Alice", results[0].valid.name);
+    try std.testing.expectEqualStrings("age", results[1].invalid.errors.items[0].field);
+    try std.testing.expectEqual(@as(usize, 2), results[2].errors().?.count());
+    try std.testing.expectEqualStrings("ExpectedObject", results[3].invalid.errors.items[0].message);
+
+    try std.testing.expectError(error.NoSpaceLeft, batchValidateInto(User, json, out[0..2], &scratch, &arena));
+}
+
+test "batchValidateArena - collects every field error" {
+    const User = struct {
+        name: []const u8,
+        age: u8,
+    };
+
+    const json =
+        \\[
+        \\  {"name": "Alice", "age": 25},
+        \\  {"name": "Bob", "age": "old"},
+        \\  {"age": 300},
+        \\  7
+        \\]
+    ;
+
+    // Values of invalid items are not freed (as in batchValidate), so keep them in an arena
+    var values = std.heap.ArenaAllocator.init(std.testing.allocator);
+    defer values.deinit();
+    var arena = validator.ErrorArena.init(std.testing.allocator);
+    defer arena.deinit();
+
+    const results = try batchValidateArena(User, json, values.allocator(), &arena);
+
+    try std.testing.expect(results[0].isValid());
+    try std.testing.expectEqualStrings("age", results[1].invalid.errors.items[0].field);
+    try std.testing.expectEqual(@as(usize, 2), results[2].errors().?.count());
+    try std.testing.expectEqualStrings("ExpectedObject", results[3].invalid.errors.items[0].message);
+}
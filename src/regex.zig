@@ -0,0 +1,703 @@
+/// Small regular expression engine for pattern validators
+/// Patterns become a DFA (Thompson NFA, then subset construction), either at
+/// comptime (`comptimeCompile`, used by validator.Pattern) or once at schema
+/// build time (`compile` / `Cache`, used by the C, WASM and Python APIs).
+/// Matching is one table lookup per input byte: linear in the input, with no
+/// backtracking whatever the pattern or the input.
+///
+/// Syntax (byte-oriented; non-ASCII literals match their UTF-8 bytes):
+///   literals, `.` (any byte but '\n'), `[...]` and `[^...]` with ranges,
+///   `\d \w \s \D \W \S`, `\n \r \t \f \v \xHH`, escaped punctuation,
+///   `(...)` and `(?:...)`, `|`, `* + ?`, `{n}` `{n,}` `{n,m}` (a trailing
+///   lazy `?` is accepted and changes nothing for matching), `^` as the first
+///   byte of the pattern and `$` (end of input) as the last.
+/// Like Python's re.search, an unanchored pattern matches anywhere in the
+/// input; `^...$` has to match all of it. Backreferences, lookaround and
+/// `\b` need backtracking or context and are rejected.
+const std = @import("std");
+
+pub const Error = error{
+    /// Malformed pattern (unbalanced parens, bad class, nothing to repeat)
+    InvalidPattern,
+    /// Valid regex syntax this engine does not implement
+    UnsupportedSyntax,
+    /// More NFA / DFA states than the fixed limits below
+    PatternTooComplex,
+    OutOfMemory,
+};
+
+pub const max_nfa_states = 512;
+pub const max_dfa_states = 512;
+/// Entries in the transition table (DFA states x byte classes)
+pub const max_table_len = 1 << 16;
+const max_ast_nodes = 1024;
+const max_group_depth = 32;
+const max_repeat = 1000;
+const unbounded: u16 = std.math.maxInt(u16);
+
+/// Compiled pattern
+/// State 0 is the dead state and state 1 the start state.
+pub const Regex = struct {
+    /// Bytes with identical transitions share a class (one table column)
+    byte_class: [256]u8,
+    num_classes: usize,
+    /// table[state * num_classes + class] is the next state
+    table: []const u16,
+    accepting: []const bool,
+    /// Without `$` the first accepting state reached is a match
+    anchored_end: bool,
+
+    pub fn isMatch(self: *const Regex, input: []const u8) bool {
+        var state: usize = 1;
+        if (!self.anchored_end and self.accepting[state]) return true;
+        for (input) |c| {
+            state = self.table[state * self.num_classes + self.byte_class[c]];
+            if (state == 0) return false;
+            if (!self.anchored_end and self.accepting[state]) return true;
+        }
+        return self.accepting[state];
+    }
+
+    /// Only for patterns from `compile`
+    pub fn deinit(self: *Regex, allocator: std.mem.Allocator) void {
+        allocator.free(self.table);
+        allocator.free(self.accepting);
+    }
+};
+
+/// Compile `pattern` with its tables allocated from `allocator`
+pub fn compile(allocator: std.mem.Allocator, pattern: []const u8) Error!Regex {
+    const scratch = try allocator.create(Scratch);
+    defer allocator.destroy(scratch);
+    const shape = try build(scratch, pattern);
+
+    const table = try allocator.dupe(u16, scratch.table[0 .. shape.num_states * shape.num_classes]);
+    errdefer allocator.free(table);
+    const accepting = try allocator.dupe(bool, scratch.accepting[0..shape.num_states]);
+    return .{
+        .byte_class = scratch.byte_class,
+        .num_classes = shape.num_classes,
+        .table = table,
+        .accepting = accepting,
+        .anchored_end = shape.anchored_end,
+    };
+}
+
+/// Compile `pattern` at comptime; an invalid pattern is a compile error
+pub fn comptimeCompile(comptime pattern: []const u8) Regex {
+    return comptime blk: {
+        @setEvalBranchQuota(20_000_000);
+        var scratch: Scratch = undefined;
+        const shape = build(&scratch, pattern) catch |err|
+            @compileError("regex \"" ++ pattern ++ "\": " ++ @errorName(err));
+        const table: [shape.num_states * shape.num_classes]u16 = scratch.table[0 .. shape.num_states * shape.num_classes].*;
+        const accepting: [shape.num_states]bool = scratch.accepting[0..shape.num_states].*;
+        break :blk .{
+            .byte_class = scratch.byte_class,
+            .num_classes = shape.num_classes,
+            .table = &table,
+            .accepting = &accepting,
+            .anchored_end = shape.anchored_end,
+        };
+    };
+}
+
+/// Patterns compiled on first use, keyed by source text
+/// Schemas keep one so each distinct pattern is compiled once. Not thread-safe.
+pub const Cache = struct {
+    allocator: std.mem.Allocator,
+    entries: std.StringHashMapUnmanaged(*Regex) = .empty,
+
+    pub fn init(allocator: std.mem.Allocator) Cache {
+        return .{ .allocator = allocator };
+    }
+
+    pub fn deinit(self: *Cache) void {
+        var it = self.entries.iterator();
+        while (it.next()) |entry| {
+            self.allocator.free(entry.key_ptr.*);
+            entry.value_ptr.*.deinit(self.allocator);
+            self.allocator.destroy(entry.value_ptr.*);
+        }
+        self.entries.deinit(self.allocator);
+    }
+
+    /// The returned pointer stays valid until deinit
+    pub fn get(self: *Cache, pattern: []const u8) Error!*const Regex {
+        if (self.entries.get(pattern)) |re| return re;
+
+        const re = try self.allocator.create(Regex);
+        errdefer self.allocator.destroy(re);
+        re.* = try compile(self.allocator, pattern);
+        errdefer re.deinit(self.allocator);
+        const key = try self.allocator.dupe(u8, pattern);
+        errdefer self.allocator.free(key);
+        try self.entries.put(self.allocator, key, re);
+        return re;
+    }
+};
+
+// ============================================================================
+// Compiler
+// ============================================================================
+
+const ByteSet = struct {
+    bits: [4]u64 = .{ 0, 0, 0, 0 },
+
+    fn add(self: *ByteSet, c: u8) void {
+        self.bits[c >> 6] |= @as(u64, 1) << @intCast(c & 63);
+    }
+
+    fn addRange(self: *ByteSet, lo: u8, hi: u8) void {
+        var c: u16 = lo;
+        while (c <= hi) : (c += 1) self.add(@intCast(c));
+    }
+
+    fn addAll(self: *ByteSet, chars: []const u8) void {
+        for (chars) |c| self.add(c);
+    }
+
+    fn has(self: ByteSet, c: u8) bool {
+        return self.bits[c >> 6] & (@as(u64, 1) << @intCast(c & 63)) != 0;
+    }
+
+    fn merge(self: *ByteSet, other: ByteSet) void {
+        for (&self.bits, other.bits) |*word, o| word.* |= o;
+    }
+
+    fn invert(self: *ByteSet) void {
+        for (&self.bits) |*word| word.* = ~word.*;
+    }
+
+    fn count(self: ByteSet) usize {
+        var n: usize = 0;
+        for (self.bits) |word| n += @popCount(word);
+        return n;
+    }
+
+    /// Lowest member (the set must not be empty)
+    fn first(self: ByteSet) u8 {
+        for (self.bits, 0..) |word, i| {
+            if (word != 0) return @intCast(i * 64 + @ctz(word));
+        }
+        unreachable;
+    }
+
+    fn single(c: u8) ByteSet {
+        var set: ByteSet = .{};
+        set.add(c);
+        return set;
+    }
+};
+
+/// Parsed pattern; concat and alt are binary, repeat covers * + ? {n,m}
+const Node = struct {
+    tag: enum { empty, set, concat, alt, repeat },
+    set: ByteSet = .{},
+    left: u16 = 0,
+    right: u16 = 0,
+    min: u16 = 0,
+    max: u16 = 0,
+};
+
+const State = struct {
+    tag: enum { set, split, match },
+    set: ByteSet = .{},
+    out: u16 = 0,
+    out2: u16 = 0,
+};
+
+const NfaSet = [max_nfa_states / 64]u64;
+
+/// Fixed working storage, so compilation also runs at comptime
+const Scratch = struct {
+    ast: [max_ast_nodes]Node,
+    nfa: [max_nfa_states]State,
+    dfa_sets: [max_dfa_states]NfaSet,
+    table: [max_table_len]u16,
+    dfa_hashes: [max_dfa_states]u64,
+    accepting: [max_dfa_states]bool,
+    byte_class: [256]u8,
+    /// Each state is pushed at most twice per closure
+    stack: [2 * max_nfa_states + 1]u16,
+};
+
+const Shape = struct {
+    num_states: usize,
+    num_classes: usize,
+    anchored_end: bool,
+};
+
+fn build(s: *Scratch, pattern: []const u8) Error!Shape {
+    const anchored_start = pattern.len > 0 and pattern[0] == '^';
+    const anchored_end = pattern.len > 0 and pattern[pattern.len - 1] == '$' and !isEscaped(pattern, pattern.len - 1);
+
+    var parser = Parser{ .s = s, .src = pattern, .pos = @intFromBool(anchored_start) };
+    var root = try parser.parseAlt();
+    if (parser.pos != pattern.len - @intFromBool(anchored_end)) return error.InvalidPattern;
+    // `^a|b` anchors only its first branch, which this DFA shape can't express
+    if (parser.top_level_alt and (anchored_start or anchored_end)) return error.UnsupportedSyntax;
+
+    if (!anchored_start) {
+        // Unanchored: any prefix may come first
+        var any: ByteSet = .{};
+        any.invert();
+        const prefix = try parser.node(.{ .tag = .repeat, .left = try parser.node(.{ .tag = .set, .set = any }), .max = unbounded });
+        root = try parser.node(.{ .tag = .concat, .left = prefix, .right = root });
+    }
+
+    var nfa = Nfa{ .s = s };
+    const match = try nfa.add(.{ .tag = .match });
+    const start = try nfa.compile(root, match);
+
+    const num_classes = computeClasses(s, nfa.len);
+    const num_states = try buildDfa(s, nfa.len, start, num_classes);
+    return .{ .num_states = num_states, .num_classes = num_classes, .anchored_end = anchored_end };
+}
+
+/// Whether pattern[i] follows an odd number of backslashes
+fn isEscaped(pattern: []const u8, i: usize) bool {
+    var n: usize = 0;
+    while (n < i and pattern[i - 1 - n] == '\\') n += 1;
+    return n % 2 == 1;
+}
+
+const Parser = struct {
+    s: *Scratch,
+    src: []const u8,
+    pos: usize,
+    num_nodes: usize = 0,
+    depth: usize = 0,
+    top_level_alt: bool = false,
+
+    fn node(self: *Parser, n: Node) Error!u16 {
+        if (self.num_nodes == max_ast_nodes) return error.PatternTooComplex;
+        self.s.ast[self.num_nodes] = n;
+        self.num_nodes += 1;
+        return @intCast(self.num_nodes - 1);
+    }
+
+    fn peek(self: *const Parser) ?u8 {
+        return if (self.pos < self.src.len) self.src[self.pos] else null;
+    }
+
+    fn parseAlt(self: *Parser) Error!u16 {
+        var left = try self.parseConcat();
+        while (self.peek() == '|') {
+            self.pos += 1;
+            if (self.depth == 0) self.top_level_alt = true;
+            const right = try self.parseConcat();
+            left = try self.node(.{ .tag = .alt, .left = left, .right = right });
+        }
+        return left;
+    }
+
+    fn parseConcat(self: *Parser) Error!u16 {
+        var result: ?u16 = null;
+        while (self.peek()) |c| {
+            if (c == '|' or c == ')') break;
+            if (c == '$') {
+                // Only the pattern's final `$` is an anchor (see build)
+                if (self.pos + 1 == self.src.len and self.depth == 0) break;
+                return error.UnsupportedSyntax;
+            }
+            const item = try self.parseRepeat();
+            result = if (result) |r| try self.node(.{ .tag = .concat, .left = r, .right = item }) else item;
+        }
+        return result orelse self.node(.{ .tag = .empty });
+    }
+
+    fn parseRepeat(self: *Parser) Error!u16 {
+        var atom = try self.parseAtom();
+        while (self.peek()) |c| {
+            var min: u16 = 0;
+            var max: u16 = unbounded;
+            switch (c) {
+                '*' => self.pos += 1,
+                '+' => {
+                    min = 1;
+                    self.pos += 1;
+                },
+                '?' => {
+                    max = 1;
+                    self.pos += 1;
+                },
+                '{' => {
+                    self.pos += 1;
+                    min = try self.parseCount();
+                    max = min;
+                    if (self.peek() == ',') {
+                        self.pos += 1;
+                        max = if (self.peek() == '}') unbounded else try self.parseCount();
+                    }
+                    if (self.peek() != '}' or max < min) return error.InvalidPattern;
+                    self.pos += 1;
+                },
+                else => break,
+            }
+            if (self.peek() == '?') self.pos += 1;
+            atom = try self.node(.{ .tag = .repeat, .left = atom, .min = min, .max = max });
+        }
+        return atom;
+    }
+
+    fn parseCount(self: *Parser) Error!u16 {
+        const start = self.pos;
+        var value: u32 = 0;
+        while (self.peek()) |c| {
+            if (!std.ascii.isDigit(c)) break;
+            value = value * 10 + (c - '0');
+            if (value > max_repeat) return error.PatternTooComplex;
+            self.pos += 1;
+        }
+        if (self.pos == start) return error.InvalidPattern;
+        return @intCast(value);
+    }
+
+    fn parseAtom(self: *Parser) Error!u16 {
+        const c = self.src[self.pos];
+        self.pos += 1;
+        switch (c) {
+            '(' => {
+                if (std.mem.startsWith(u8, self.src[self.pos..], "?:")) {
+                    self.pos += 2;
+                } else if (self.peek() == '?') {
+                    // Lookaround, named groups, inline flags
+                    return error.UnsupportedSyntax;
+                }
+                if (self.depth == max_group_depth) return error.PatternTooComplex;
+                self.depth += 1;
+                const inner = try self.parseAlt();
+                self.depth -= 1;
+                if (self.peek() != ')') return error.InvalidPattern;
+                self.pos += 1;
+                return inner;
+            },
+            '*', '+', '?', '{' => return error.InvalidPattern,
+            '^' => return error.UnsupportedSyntax,
+            '[' => return self.node(.{ .tag = .set, .set = try self.parseClass() }),
+            '.' => {
+                var set = ByteSet.single('\n');
+                set.invert();
+                return self.node(.{ .tag = .set, .set = set });
+            },
+            '\\' => return self.node(.{ .tag = .set, .set = try self.parseEscape() }),
+            else => return self.node(.{ .tag = .set, .set = ByteSet.single(c) }),
+        }
+    }
+
+    /// Escape after a backslash
+    fn parseEscape(self: *Parser) Error!ByteSet {
+        const c = self.peek() orelse return error.InvalidPattern;
+        self.pos += 1;
+        var set: ByteSet = .{};
+        switch (c) {
+            'd', 'D' => set.addRange('0', '9'),
+            'w', 'W' => {
+                set.addRange('a', 'z');
+                set.addRange('A', 'Z');
+                set.addRange('0', '9');
+                set.add('_');
+            },
+            's', 'S' => set.addAll(" \t\n\r\x0b\x0c"),
+            'n' => set.add('\n'),
+            'r' => set.add('\r'),
+            't' => set.add('\t'),
+            'f' => set.add('\x0c'),
+            'v' => set.add('\x0b'),
+            'x' => {
+                if (self.pos + 2 > self.src.len) return error.InvalidPattern;
+                set.add(std.fmt.parseInt(u8, self.src[self.pos..][0..2], 16) catch return error.InvalidPattern);
+                self.pos += 2;
+            },
+            else => {
+                // \b, \A, \1 and friends
+                if (std.ascii.isAlphanumeric(c)) return error.UnsupportedSyntax;
+                set.add(c);
+            },
+        }
+        if (std.ascii.isUpper(c)) set.invert();
+        return set;
+    }
+
+    /// Class body after '['
+    fn parseClass(self: *Parser) Error!ByteSet {
+        var set: ByteSet = .{};
+        const negate = self.peek() == '^';
+        if (negate) self.pos += 1;
+
+        var first = true;
+        while (true) : (first = false) {
+            const c = self.peek() orelse return error.InvalidPattern;
+            self.pos += 1;
+            // A leading ']' is a literal
+            if (c == ']' and !first) break;
+
+            var lo = c;
+            if (c == '\\') {
+                const esc = try self.parseEscape();
+                // \d, \w and friends are added whole and can't start a range
+                if (esc.count() != 1) {
+                    set.merge(esc);
+                    continue;
+                }
+                lo = esc.first();
+            }
+            if (self.peek() == '-' and self.pos + 1 < self.src.len and self.src[self.pos + 1] != ']') {
+                var hi = self.src[self.pos + 1];
+                self.pos += 2;
+                if (hi == '\\') {
+                    const esc = try self.parseEscape();
+                    if (esc.count() != 1) return error.InvalidPattern;
+                    hi = esc.first();
+                }
+                if (hi < lo) return error.InvalidPattern;
+                set.addRange(lo, hi);
+            } else {
+                set.add(lo);
+            }
+        }
+        if (negate) set.invert();
+        return set;
+    }
+};
+
+const Nfa = struct {
+    s: *Scratch,
+    len: usize = 0,
+
+    fn add(self: *Nfa, state: State) Error!u16 {
+        if (self.len == max_nfa_states) return error.PatternTooComplex;
+        self.s.nfa[self.len] = state;
+        self.len += 1;
+        return @intCast(self.len - 1);
+    }
+
+    /// States for AST node `id` followed by `next`; returns the entry state
+    fn compile(self: *Nfa, id: u16, next: u16) Error!u16 {
+        const n = self.s.ast[id];
+        switch (n.tag) {
+            .empty => return next,
+            .set => return self.add(.{ .tag = .set, .set = n.set, .out = next }),
+            .concat => return self.compile(n.left, try self.compile(n.right, next)),
+            .alt => {
+                const left = try self.compile(n.left, next);
+                const right = try self.compile(n.right, next);
+                return self.add(.{ .tag = .split, .out = left, .out2 = right });
+            },
+            .repeat => {
+                // Optional copies nest from the end, (e(e)?)? for e{0,2},
+                // then the required copies go in front
+                var entry = next;
+                if (n.max == unbounded) {
+                    const loop = try self.add(.{ .tag = .split, .out2 = next });
+                    self.s.nfa[loop].out = try self.compile(n.left, loop);
+                    entry = loop;
+                } else {
+                    for (n.min..n.max) |_| {
+                        const body = try self.compile(n.left, entry);
+                        entry = try self.add(.{ .tag = .split, .out = body, .out2 = next });
+                    }
+                }
+                for (0..n.min) |_| entry = try self.compile(n.left, entry);
+                return entry;
+            },
+        }
+    }
+};
+
+fn setBit(set: *NfaSet, i: usize) void {
+    set[i / 64] |= @as(u64, 1) << @intCast(i % 64);
+}
+
+fn hasBit(set: NfaSet, i: usize) bool {
+    return set[i / 64] & (@as(u64, 1) << @intCast(i % 64)) != 0;
+}
+
+fn hashSet(set: NfaSet) u64 {
+    var h: u64 = 0;
+    for (set) |word| h = (h ^ word) *% 0x9E3779B97F4A7C15;
+    return h;
+}
+
+/// Add `start` and every state reachable from it without consuming input
+fn closure(s: *Scratch, set: *NfaSet, start: u16) void {
+    s.stack[0] = start;
+    var sp: usize = 1;
+    while (sp > 0) {
+        sp -= 1;
+        const i = s.stack[sp];
+        if (hasBit(set.*, i)) continue;
+        setBit(set, i);
+        const state = s.nfa[i];
+        if (state.tag == .split) {
+            s.stack[sp] = state.out;
+            s.stack[sp + 1] = state.out2;
+            sp += 2;
+        }
+    }
+}
+
+/// Group bytes that every set state treats alike; returns the class count
+fn computeClasses(s: *Scratch, nfa_len: usize) usize {
+    var reps: [256]NfaSet = undefined;
+    var num_classes: usize = 0;
+    for (0..256) |c| {
+        var members: NfaSet = @splat(0);
+        for (s.nfa[0..nfa_len], 0..) |state, i| {
+            if (state.tag == .set and state.set.has(@intCast(c))) setBit(&members, i);
+        }
+        const class = for (reps[0..num_classes], 0..) |rep, k| {
+            if (std.mem.eql(u64, &rep, &members)) break k;
+        } else blk: {
+            reps[num_classes] = members;
+            num_classes += 1;
+            break :blk num_classes - 1;
+        };
+        s.byte_class[c] = @intCast(class);
+    }
+    return num_classes;
+}
+
+/// Subset construction over the NFA (its match state is state 0)
+/// Returns the number of DFA states
+fn buildDfa(s: *Scratch, nfa_len: usize, start: u16, num_classes: usize) Error!usize {
+    std.debug.assert(nfa_len > 0 and s.nfa[0].tag == .match);
+    var class_byte: [256]u8 = undefined;
+    var c: usize = 256;
+    while (c > 0) {
+        c -= 1;
+        class_byte[s.byte_class[c]] = @intCast(c);
+    }
+
+    // 0 = dead (no NFA states), 1 = start
+    s.dfa_sets[0] = @splat(0);
+    s.dfa_sets[1] = @splat(0);
+    closure(s, &s.dfa_sets[1], start);
+    s.dfa_hashes[0] = hashSet(s.dfa_sets[0]);
+    s.dfa_hashes[1] = hashSet(s.dfa_sets[1]);
+    var num_states: usize = 2;
+    if (num_states * num_classes > max_table_len) return error.PatternTooComplex;
+
+    var current: usize = 0;
+    while (current < num_states) : (current += 1) {
+        const set = s.dfa_sets[current];
+        s.accepting[current] = hasBit(set, 0);
+        for (0..num_classes) |class| {
+            var next: NfaSet = @splat(0);
+            for (set, 0..) |word, w| {
+                var bits = word;
+                while (bits != 0) : (bits &= bits - 1) {
+                    const state = s.nfa[w * 64 + @ctz(bits)];
+                    if (state.tag == .set and state.set.has(class_byte[class])) closure(s, &next, state.out);
+                }
+            }
+
+            const hash = hashSet(next);
+            const target = for (s.dfa_sets[0..num_states], s.dfa_hashes[0..num_states], 0..) |existing, h, k| {
+                if (h == hash and std.mem.eql(u64, &existing, &next)) break k;
+            } else blk: {
+                if (num_states == max_dfa_states or (num_states + 1) * num_classes > max_table_len)
+                    return error.PatternTooComplex;
+                s.dfa_sets[num_states] = next;
+                s.dfa_hashes[num_states] = hash;
+                num_states += 1;
+                break :blk num_states - 1;
+            };
+            s.table[current * num_classes + class] = @intCast(target);
+        }
+    }
+    return num_states;
+}
+
+fn expectMatches(pattern: []const u8, matching: []const []const u8, non_matching: []const []const u8) !void {
+    var re = try compile(std.testing.allocator, pattern);
+    defer re.deinit(std.testing.allocator);
+    for (matching) |input| {
+        if (!re.isMatch(input)) {
+            std.debug.print("\"{s}\" should match /{s}/\n", .{ input, pattern });
+            return error.TestUnexpectedResult;
+        }
+    }
+    for (non_matching) |input| {
+        if (re.isMatch(input)) {
+            std.debug.print("\"{s}\" should not match /{s}/\n", .{ input, pattern });
+            return error.TestUnexpectedResult;
+        }
+    }
+}
+
+test "anchored patterns match the whole input" {
+    try expectMatches("^[A-Z]{3}-\\d{4}$", &.{"ABC-1234"}, &.{ "AB-1234", "ABC-12345", "abc-1234", " ABC-1234", "" });
+    try expectMatches(
+        "^(?:\\+1[ -]?)?\\(?\\d{3}\\)?[ -]?\\d{3}-\\d{4}$",
+        &.{ "555-123-4567", "+1 (555) 123-4567", "(555)123-4567" },
+        &.{ "555-1234", "+2 555-123-4567" },
+    );
+    try expectMatches("^[\\w.+-]+@[\\w-]+(\\.[\\w-]+)+$", &.{ "a.b+c@example.co.uk", "x@y.z" }, &.{ "a@b", "@b.c", "a b@c.d" });
+    try expectMatches("^$", &.{""}, &.{"a"});
+}
+
+test "unanchored patterns search" {
+    try expectMatches("\\d+", &.{ "abc123", "7" }, &.{ "abc", "" });
+    try expectMatches("foo|bar", &.{ "xbarx", "food" }, &.{"fo ba"});
+    try expectMatches("colou?r$", &.{ "the color", "colour" }, &.{"colors"});
+    try expectMatches("^id_", &.{"id_42"}, &.{"uid_42"});
+    try expectMatches("", &.{ "", "anything" }, &.{});
+}
+
+test "classes, escapes and repetition" {
+    try expectMatches("^[^aeiou\\s]+$", &.{ "rhythm", "xyz!" }, &.{ "vowel", "dry run" });
+    try expectMatches("^[]a]+$", &.{"]a]"}, &.{"b"});
+    try expectMatches("^[a\\-z]$", &.{ "a", "-", "z" }, &.{"b"});
+    try expectMatches("^[\\d.]+$", &.{"3.14"}, &.{"3,14"});
+    try expectMatches("^\\x41.\\.$", &.{"AB."}, &.{ "A\n.", "ABC" });
+    try expectMatches("^a{2,3}$", &.{ "aa", "aaa" }, &.{ "a", "aaaa" });
+    try expectMatches("^(ab){2,}$", &.{ "abab", "ababab" }, &.{ "ab", "aba" });
+    try expectMatches("^a{0,2}b$", &.{ "b", "ab", "aab" }, &.{"aaab"});
+    try expectMatches("^\\$\\d+$", &.{"$100"}, &.{"100"});
+    try expectMatches("^a*?b+?$", &.{ "b", "aabb" }, &.{"ba"});
+    try expectMatches("^caf\xc3\xa9$", &.{"caf\xc3\xa9"}, &.{"cafe"});
+}
+
+test "hostile input stays linear" {
+    var input: [20000]u8 = undefined;
+    @memset(&input, 'a');
+    input[input.len - 1] = '!';
+    try expectMatches("^(a+)+$", &.{input[0 .. input.len - 1]}, &.{&input});
+    try expectMatches("^(a|a?)+$", &.{input[0 .. input.len - 1]}, &.{&input});
+    try expectMatches("(a|aa)*b", &.{"aaab"}, &.{&input});
+}
+
+test "rejected patterns" {
+    const allocator = std.testing.allocator;
+    for ([_][]const u8{ "(ab", "ab)", "*a", "a|+", "[a", "[z-a]", "a{2,1}", "a{", "a{x}", "\\" }) |pattern| {
+        try std.testing.expectError(error.InvalidPattern, compile(allocator, pattern));
+    }
+    for ([_][]const u8{ "(\\w)\\1", "(?=a)", "\\bword", "a^b", "a$b", "(a$)", "^a|b", "a|b$" }) |pattern| {
+        try std.testing.expectError(error.UnsupportedSyntax, compile(allocator, pattern));
+    }
+    // Subset construction would need 2^13 states
+    try std.testing.expectError(error.PatternTooComplex, compile(allocator, "(a|b)*a(a|b){12}$"));
+    try std.testing.expectError(error.PatternTooComplex, compile(allocator, "a{1001}"));
+}
+
+test "comptimeCompile" {
+    const re = comptimeCompile("^[a-z]+-\\d{2}$");
+    try std.testing.expect(re.isMatch("sku-42"));
+    try std.testing.expect(!re.isMatch("SKU-42"));
+    try std.testing.expect(!re.isMatch("sku-420"));
+}
+
+test "Cache compiles each pattern once" {
+    var cache = Cache.init(std.testing.allocator);
+    defer cache.deinit();
+
+    const a = try cache.get("^x+$");
+    const b = try cache.get("^x+$");
+    try std.testing.expect(a == b);
+    try std.testing.expect(a.isMatch("xxx"));
+    try std.testing.expect((try cache.get("^y$")) != a);
+    try std.testing.expectError(error.InvalidPattern, cache.get("("));
+    try std.testing.expectEqual(@as(u32, 2), cache.entries.count());
+}
@@ -9,6 +9,7 @@ pub const json_validator = @import("json_validator");
 pub const ValidationError = validator.ValidationError;
 pub const ValidationErrors = validator.ValidationErrors;
 pub const ValidationResult = validator.ValidationResult;
+pub const ErrorArena = validator.ErrorArena;
 
 pub const BoundedInt = validator.BoundedInt;
 pub const BoundedString = validator.BoundedString;
@@ -23,9 +24,16 @@ pub const Transform = combinators.Transform;
 
 pub const parseAndValidate = json_validator.parseAndValidate;
 pub const batchValidate = json_validator.batchValidate;
+pub const batchValidateArena = json_validator.batchValidateArena;
+pub const parseAndValidateBorrowed = json_validator.parseAndValidateBorrowed;
+pub const batchValidateInto = json_validator.batchValidateInto;
 pub const streamValidate = json_validator.streamValidate;
+pub const streamValidateBatches = json_validator.streamValidateBatches;
+pub const StreamOptions = json_validator.StreamOptions;
+pub const RecordBatch = json_validator.RecordBatch;
 
 pub const validateStruct = validator.validateStruct;
+pub const validateStructChanged = validator.validateStructChanged;
 pub const deriveValidator = validator.deriveValidator;
 
 test {
@@ -0,0 +1,211 @@
+/// Comptime-specialized batch validators for schemas known at build time
+/// `zig build -Dschema=schemas.json` turns a schema description into the
+/// `generated_schemas` module (see build.zig), and every schema in it gets its
+/// own exported kernels:
+///
+///   satya_validate_<name>_batch(columns, count, results) -> valid count
+///   satya_validate_<name>_batch_bitmap(columns, count, bits) -> valid count
+///
+/// Kinds and parameters are comptime constants, so each field check inlines
+/// to a few compares with no per-field dispatch. Columns use the
+/// column_validator.zig layout, one per schema field in order; their
+/// kind/param fields are ignored.
+///
+/// Schema JSON: an object, or an array of objects, shaped like
+///   {"name": "user", "fields": {"age": ["int", 18, 120], "email": ["email"]}}
+/// with the same validator names as the Python field_specs.
+const std = @import("std");
+const columns = @import("column_validator.zig");
+
+const Column = columns.Column;
+const Kind = columns.Kind;
+
+/// Validator names accepted in schema descriptions (same as _native.c)
+pub fn kindFromName(comptime name: []const u8) Kind {
+    const names = .{
+        .{ "int", Kind.Int },
+        .{ "int_gt", Kind.IntGt },
+        .{ "int_gte", Kind.IntGte },
+        .{ "int_lt", Kind.IntLt },
+        .{ "int_lte", Kind.IntLte },
+        .{ "int_positive", Kind.IntPositive },
+        .{ "int_non_negative", Kind.IntNonNegative },
+        .{ "int_multiple_of", Kind.IntMultipleOf },
+        .{ "string", Kind.String },
+        .{ "email", Kind.Email },
+        .{ "url", Kind.Url },
+        .{ "uuid", Kind.Uuid },
+        .{ "ipv4", Kind.Ipv4 },
+        .{ "base64", Kind.Base64 },
+        .{ "iso_date", Kind.IsoDate },
+        .{ "iso_datetime", Kind.IsoDatetime },
+    };
+    inline for (names) |entry| {
+        if (comptime std.mem.eql(u8, entry[0], name)) return entry[1];
+    }
+    @compileError("unknown validator '" ++ name ++ "' in schema");
+}
+
+/// Field description as seen by C callers (kind uses the column numbering)
+pub const GeneratedField = extern struct {
+    name: [*:0]const u8,
+    kind: Kind,
+    param1: i64,
+    param2: i64,
+};
+
+pub const Kernel = *const fn (cols: [*]const Column, count: usize, out: [*]u8) callconv(.c) usize;
+
+/// Registry entry for one generated schema
+pub const GeneratedSchema = extern struct {
+    name: [*:0]const u8,
+    fields: [*]const GeneratedField,
+    num_fields: usize,
+    validate: Kernel,
+    validate_bitmap: Kernel,
+};
+
+/// Kernels for `schema` (anything with `name` and `fields`, each field
+/// having `name`, `kind` (validator name), `param1` and `param2`)
+pub fn Specialized(comptime schema: anytype) type {
+    return struct {
+        pub const field_table = blk: {
+            var table: [schema.fields.len]GeneratedField = undefined;
+            for (schema.fields, 0..) |field, i| {
+                table[i] = .{
+                    .name = @as([:0]const u8, field.name).ptr,
+                    .kind = kindFromName(field.kind),
+                    .param1 = field.param1,
+                    .param2 = field.param2,
+                };
+            }
+            break :blk table;
+        };
+
+        /// Int fields are combined without branches; the (costlier) string
+        /// checks only run when every int field passed
+        inline fn validRow(cols: [*]const Column, i: usize) bool {
+            var ok: u1 = 1;
+            inline for (field_table, 0..) |field, c| {
+                if (comptime field.kind.isInt()) {
+                    const present: u1 = if (cols[c].present) |p| @intFromBool(p[i] != 0) else 1;
+                    ok &= present & @intFromBool(columns.checkInt(field.kind, cols[c].ints.?[i], field.param1, field.param2));
+                }
+            }
+            if (ok == 0) return false;
+
+            inline for (field_table, 0..) |field, c| {
+                if (comptime !field.kind.isInt()) {
+                    const col = cols[c];
+                    if (col.present) |p| {
+                        if (p[i] == 0) return false;
+                    }
+                    const str = col.str_ptrs.?[i][0..col.str_lens.?[i]];
+                    if (!columns.checkString(field.kind, str, field.param1, field.param2)) return false;
+                }
+            }
+            return true;
+        }
+
+        /// 0/1 per item into results; returns number of valid items
+        pub fn validateBatch(cols: [*]const Column, count: usize, results: [*]u8) callconv(.c) usize {
+            var valid_count: usize = 0;
+            for (0..count) |i| {
+                const is_valid = validRow(cols, i);
+                results[i] = @intFromBool(is_valid);
+                valid_count += @intFromBool(is_valid);
+            }
+            return valid_count;
+        }
+
+        /// Packed results (see bitmap.zig); returns number of valid items
+        pub fn validateBatchBitmap(cols: [*]const Column, count: usize, bits: [*]u8) callconv(.c) usize {
+            var valid_count: usize = 0;
+            var byte: u8 = 0;
+            for (0..count) |i| {
+                const is_valid = validRow(cols, i);
+                byte |= @as(u8, @intFromBool(is_valid)) << @intCast(i & 7);
+                valid_count += @intFromBool(is_valid);
+                if (i & 7 == 7) {
+                    bits[i >> 3] = byte;
+                    byte = 0;
+                }
+            }
+            if (count & 7 != 0) bits[count >> 3] = byte;
+            return valid_count;
+        }
+
+        pub const entry = GeneratedSchema{
+            .name = @as([:0]const u8, schema.name).ptr,
+            .fields = &field_table,
+            .num_fields = field_table.len,
+            .validate = &validateBatch,
+            .validate_bitmap = &validateBatchBitmap,
+        };
+    };
+}
+
+/// Export the kernels of every schema in `schemas` under their C names
+/// Call from a `comptime` block of the library root.
+pub fn exportAll(comptime schemas: anytype) void {
+    inline for (schemas) |schema| {
+        const kernels = Specialized(schema);
+        @export(&kernels.validateBatch, .{ .name = "satya_validate_" ++ schema.name ++ "_batch" });
+        @export(&kernels.validateBatchBitmap, .{ .name = "satya_validate_" ++ schema.name ++ "_batch_bitmap" });
+    }
+}
+
+/// Registry of `schemas` for runtime lookup by name
+pub fn registry(comptime schemas: anytype) [schemas.len]GeneratedSchema {
+    var entries: [schemas.len]GeneratedSchema = undefined;
+    inline for (schemas, 0..) |schema, i| entries[i] = Specialized(schema).entry;
+    return entries;
+}
+
+test "Specialized kernels match the generic column validator" {
+    const Field = struct { name: [:0]const u8, kind: []const u8, param1: i64 = 0, param2: i64 = 0 };
+    const schema = .{
+        .name = "user",
+        .fields = [_]Field{
+            .{ .name = "age", .kind = "int", .param1 = 18, .param2 = 120 },
+            .{ .name = "email", .kind = "email" },
+            .{ .name = "score", .kind = "int_multiple_of", .param1 = 5 },
+        },
+    };
+    const kernels = Specialized(schema);
+
+    const ages = [_]i64{ 25, 15, 40, 30, 99 };
+    const scores = [_]i64{ 10, 10, 7, 0, 5 };
+    const emails = [_][]const u8{ "a@b.co", "a@b.co", "c@d.io", "nope", "e@f.gh" };
+    var ptrs: [emails.len][*]const u8 = undefined;
+    var lens: [emails.len]usize = undefined;
+    for (emails, 0..) |e, i| {
+        ptrs[i] = e.ptr;
+        lens[i] = e.len;
+    }
+    const present = [_]u8{ 1, 1, 1, 1, 0 };
+
+    var cols: [3]Column = undefined;
+    for (&cols, kernels.field_table) |*col, field| {
+        col.* = .{ .kind = field.kind, .param1 = field.param1, .param2 = field.param2, .ints = null, .str_ptrs = null, .str_lens = null, .present = null };
+    }
+    cols[0].ints = &ages;
+    cols[1].str_ptrs = &ptrs;
+    cols[1].str_lens = &lens;
+    cols[2].ints = &scores;
+    cols[2].present = &present;
+
+    var expected: [ages.len]u8 = undefined;
+    var results: [ages.len]u8 = undefined;
+    var bits: [1]u8 = undefined;
+    const generic_valid = columns.validateRange(&cols, 0, ages.len, &expected);
+
+    try std.testing.expectEqual(generic_valid, kernels.validateBatch(&cols, ages.len, &results));
+    try std.testing.expectEqualSlices(u8, &expected, &results);
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 0, 0, 0 }, &results);
+    try std.testing.expectEqual(@as(usize, 1), kernels.validateBatchBitmap(&cols, ages.len, &bits));
+    try std.testing.expectEqual(@as(u8, 0b1), bits[0]);
+
+    try std.testing.expectEqualStrings("email", std.mem.span(kernels.entry.fields[1].name));
+    try std.testing.expectEqual(Kind.IntMultipleOf, kernels.entry.fields[2].kind);
+}
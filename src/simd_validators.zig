@@ -1,12 +1,48 @@
 const std = @import("std");
 
 /// SIMD-accelerated validators using Zig's @Vector
-/// These use CPU SIMD instructions for parallel validation
+/// These use CPU SIMD instructions for parallel validation.
+/// validators_comprehensive.zig forwards email, UUID, IPv4 and base64 here,
+/// so every exported C / WASM symbol uses these versions.
+/// Character classes are built from range compares (one wrapping subtract
+/// and one compare per range), which lower to SSE2/NEON/simd128 without
+/// target-specific code.
+
+const lanes = 16;
+const V = @Vector(lanes, u8);
+const Mask = u16;
+const full: Mask = std.math.maxInt(Mask);
+
+inline fn splat(c: u8) V {
+    return @splat(c);
+}
+
+inline fn eq(v: V, c: u8) Mask {
+    return @bitCast(v == splat(c));
+}
+
+/// Lanes with lo <= byte <= hi
+inline fn inRange(v: V, comptime lo: u8, comptime hi: u8) Mask {
+    return @bitCast(v -% splat(lo) <= splat(hi - lo));
+}
+
+inline fn alnum(v: V) Mask {
+    return inRange(v, '0', '9') | inRange(v | splat(0x20), 'a', 'z');
+}
+
+inline fn load(bytes: []const u8, offset: usize) V {
+    return bytes[offset..][0..lanes].*;
+}
+
+/// Mask with the low `n` bits set (n <= lanes)
+inline fn lowBits(n: usize) Mask {
+    return if (n >= lanes) full else (@as(Mask, 1) << @intCast(n)) - 1;
+}
 
 /// Validate ASCII-only strings (16 bytes at a time)
 pub fn isAscii(str: []const u8) bool {
     var i: usize = 0;
-    
+
     // Process 16 bytes at a time with SIMD
     while (i + 16 <= str.len) : (i += 16) {
         const chunk: @Vector(16, u8) = str[i..][0..16].*;
@@ -15,12 +51,12 @@ pub fn isAscii(str: []const u8) bool {
         const is_ascii = @reduce(.And, is_ascii_vec);
         if (!is_ascii) return false;
     }
-    
+
     // Handle remaining bytes
     while (i < str.len) : (i += 1) {
         if (str[i] >= 128) return false;
     }
-    
+
     return true;
 }
 
@@ -29,60 +65,133 @@ pub inline fn checkLength(str: []const u8, min: usize, max: usize) bool {
     return str.len >= min and str.len <= max;
 }
 
-/// Fast email validation using SIMD for character checks
-pub fn validateEmailFast(email: []const u8) bool {
-    if (!checkLength(email, 3, 320)) return false;
-    
-    var has_at = false;
-    var at_pos: usize = 0;
-    
-    // Quick scan for @ and .
-    for (email, 0..) |c, i| {
-        if (c == '@') {
-            if (has_at) return false; // Multiple @
-            has_at = true;
-            at_pos = i;
+inline fn isLocalChar(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '.' or c == '_' or c == '-' or c == '+';
+}
+
+/// Email validation (RFC 5322 simplified, same rules as before):
+/// a non-empty local part of [A-Za-z0-9._+-] before the first '@', and a
+/// domain after it that contains a '.'
+pub fn validateEmail(email: []const u8) bool {
+    if (email.len < 3) return false;
+
+    // Find the first '@', checking local-part characters on the way
+    var i: usize = 0;
+    const at_pos: usize = blk: {
+        while (i + lanes <= email.len) : (i += lanes) {
+            const v = load(email, i);
+            const local = alnum(v) | eq(v, '.') | eq(v, '_') | eq(v, '-') | eq(v, '+');
+            const at = eq(v, '@');
+            if (at != 0) {
+                const before = lowBits(@ctz(at));
+                if (local & before != before) return false;
+                break :blk i + @ctz(at);
+            }
+            if (local != full) return false;
         }
-        if (has_at and c == '.' and i > at_pos + 1) {
-            has_dot_after_at = true;
+        while (i < email.len) : (i += 1) {
+            if (email[i] == '@') break :blk i;
+            if (!isLocalChar(email[i])) return false;
         }
-    }
-    
-    if (!has_at or !has_dot_after_at) return false;
+        return false;
+    };
+
     if (at_pos == 0 or at_pos == email.len - 1) return false;
-    
-    // SIMD validation of characters (parallel check)
+    return std.mem.indexOfScalar(u8, email[at_pos + 1 ..], '.') != null;
+}
+
+/// Canonical 8-4-4-4-12 UUID in two overlapping 32-byte loads:
+/// bytes 0..32 and 4..36 must be hex except for the four hyphens
+pub fn validateUuid(uuid: []const u8) bool {
+    if (uuid.len != 36) return false;
+    const W = @Vector(32, u8);
+    const dashes = comptime dashBits(0) | (@as(u64, dashBits(4)) << 32);
+
+    const lo: W = uuid[0..32].*;
+    const hi: W = uuid[4..36].*;
+    const lo_dash: u32 = @bitCast(lo == @as(W, @splat('-')));
+    const hi_dash: u32 = @bitCast(hi == @as(W, @splat('-')));
+    const lo_hex = hexWide(lo);
+    const hi_hex = hexWide(hi);
+
+    const dash = @as(u64, lo_dash) | (@as(u64, hi_dash) << 32);
+    const ok = @as(u64, lo_hex) | (@as(u64, hi_hex) << 32);
+    return dash == dashes and ok | dashes == std.math.maxInt(u64);
+}
+
+/// Hyphen positions of a UUID as seen by a 32-byte load at `offset`
+fn dashBits(comptime offset: usize) u32 {
+    var bits: u32 = 0;
+    for ([_]usize{ 8, 13, 18, 23 }) |pos| bits |= @as(u32, 1) << @intCast(pos - offset);
+    return bits;
+}
+
+inline fn hexWide(v: @Vector(32, u8)) u32 {
+    const W = @Vector(32, u8);
+    const digit: u32 = @bitCast(v -% @as(W, @splat('0')) <= @as(W, @splat(9)));
+    const letter: u32 = @bitCast((v | @as(W, @splat(0x20))) -% @as(W, @splat('a')) <= @as(W, @splat(5)));
+    return digit | letter;
+}
+
+/// Dotted-quad IPv4 (four decimal parts of 0-255, leading zeros allowed).
+/// At most 15 bytes, so the whole address is one zero-padded vector.
+pub fn validateIpv4(ip: []const u8) bool {
+    if (ip.len < 7 or ip.len > 15) return false;
+    var padded = [_]u8{0} ** lanes;
+    @memcpy(padded[0..ip.len], ip);
+    const v: V = padded;
+
+    const digits = inRange(v, '0', '9');
+    var dots = eq(v, '.');
+    if ((digits | dots) != lowBits(ip.len) or @popCount(dots) != 3) return false;
+
+    // Parts are the runs between dots; each needs at least one digit
+    var start: usize = 0;
+    var part: usize = 0;
+    while (part < 4) : (part += 1) {
+        const end = if (dots != 0) @as(usize, @ctz(dots)) else ip.len;
+        if (end == start) return false;
+        var value: u32 = 0;
+        for (ip[start..end]) |c| value = value * 10 + (c - '0');
+        if (value > 255) return false;
+        dots &= dots -% 1;
+        start = end + 1;
+    }
+    return true;
+}
+
+/// Standard base64 ([A-Za-z0-9+/], length a multiple of 4, '=' only in
+/// the last two positions). 64 bytes per step for large payloads.
+pub fn validateBase64(str: []const u8) bool {
+    if (str.len == 0 or str.len % 4 != 0) return false;
+    const body = str.len - 2;
+
     var i: usize = 0;
-    while (i + 16 <= email.len) : (i += 16) {
-        const chunk: @Vector(16, u8) = email[i..][0..16].*;
-        
-        // Check if all chars are valid (a-z, A-Z, 0-9, @, ., -, _)
-        const is_lower = chunk >= @as(@Vector(16, u8), @splat('a')) and chunk <= @as(@Vector(16, u8), @splat('z'));
-        const is_upper = chunk >= @as(@Vector(16, u8), @splat('A')) and chunk <= @as(@Vector(16, u8), @splat('Z'));
-        const is_digit = chunk >= @as(@Vector(16, u8), @splat('0')) and chunk <= @as(@Vector(16, u8), @splat('9'));
-        const is_special = chunk == @as(@Vector(16, u8), @splat('@')) or 
-                          chunk == @as(@Vector(16, u8), @splat('.')) or
-                          chunk == @as(@Vector(16, u8), @splat('-')) or
-                          chunk == @as(@Vector(16, u8), @splat('_'));
-        
-        const valid = @reduce(.And, is_lower or is_upper or is_digit or is_special);
-        if (!valid) {
-            // Fallback to byte-by-byte for remaining
-            var j: usize = i;
-            while (j < i + 16 and j < email.len) : (j += 1) {
-                const c = email[j];
-                const is_valid_char = (c >= 'a' and c <= 'z') or
-                                     (c >= 'A' and c <= 'Z') or
-                                     (c >= '0' and c <= '9') or
-                                     c == '@' or c == '.' or c == '-' or c == '_';
-                if (!is_valid_char) return false;
-            }
-        }
+    while (i + 4 * lanes <= body) : (i += 4 * lanes) {
+        var ok = full;
+        inline for (0..4) |k| ok &= base64Class(load(str, i + k * lanes));
+        if (ok != full) return false;
+    }
+    while (i + lanes <= body) : (i += lanes) {
+        if (base64Class(load(str, i)) != full) return false;
+    }
+    while (i < body) : (i += 1) {
+        if (!isBase64Char(str[i])) return false;
+    }
+    for (str[body..]) |c| {
+        if (!isBase64Char(c) and c != '=') return false;
     }
-    
     return true;
 }
 
+inline fn base64Class(v: V) Mask {
+    return alnum(v) | eq(v, '+') | eq(v, '/');
+}
+
+inline fn isBase64Char(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '+' or c == '/';
+}
+
 /// SIMD string length check (faster than checking .len)
 pub fn isLengthInRange(str: []const u8, min: usize, max: usize) bool {
     return str.len >= min and str.len <= max;
@@ -94,3 +203,51 @@ pub fn validateLengthBatch(strings: []const []const u8, min: usize, max: usize,
         results[i] = isLengthInRange(str, min, max);
     }
 }
+
+test "validateEmail - vector and tail paths" {
+    try std.testing.expect(validateEmail("test@example.com"));
+    try std.testing.expect(validateEmail("user+tag@domain.co.uk"));
+    try std.testing.expect(validateEmail("first.last_name-1234567@example.org"));
+    try std.testing.expect(!validateEmail("invalid"));
+    try std.testing.expect(!validateEmail("@example.com"));
+    try std.testing.expect(!validateEmail("test@"));
+    try std.testing.expect(!validateEmail("test@example"));
+    try std.testing.expect(!validateEmail("first last name 1234@example.org"));
+    try std.testing.expect(!validateEmail("abcdefghijklmnopqrstuvwxyz"));
+}
+
+test "validateUuid - hyphens and hex digits" {
+    try std.testing.expect(validateUuid("550e8400-e29b-41d4-a716-446655440000"));
+    try std.testing.expect(validateUuid("550E8400-E29B-41D4-A716-446655440000"));
+    try std.testing.expect(!validateUuid("550e8400-e29b-41d4-a716-44665544000g"));
+    try std.testing.expect(!validateUuid("550e8400-e29b-41d4-a716-4466554400-0"));
+    try std.testing.expect(!validateUuid("550e8400e-29b-41d4-a716-446655440000"));
+    try std.testing.expect(!validateUuid("550e8400-e29b-41d4-a716"));
+}
+
+test "validateIpv4" {
+    try std.testing.expect(validateIpv4("192.168.1.1"));
+    try std.testing.expect(validateIpv4("0.0.0.0"));
+    try std.testing.expect(validateIpv4("255.255.255.255"));
+    try std.testing.expect(!validateIpv4("256.1.1.1"));
+    try std.testing.expect(!validateIpv4("192.168.1"));
+    try std.testing.expect(!validateIpv4("1..2.3.4"));
+    try std.testing.expect(!validateIpv4("1.2.3.4."));
+    try std.testing.expect(!validateIpv4("1.2.3.a"));
+}
+
+test "validateBase64 - long payloads match the scalar rules" {
+    try std.testing.expect(validateBase64("aGVsbG8="));
+    try std.testing.expect(validateBase64("aGk="));
+    try std.testing.expect(!validateBase64("aGVsbG8"));
+    try std.testing.expect(!validateBase64("a=Vs"));
+
+    var payload: [10000]u8 = undefined;
+    for (&payload, 0..) |*c, i| c.* = "ABCxyz019+/"[i % 11];
+    payload[payload.len - 1] = '=';
+    try std.testing.expect(validateBase64(&payload));
+    payload[4321] = '-';
+    try std.testing.expect(!validateBase64(&payload));
+    payload[4321] = '=';
+    try std.testing.expect(!validateBase64(&payload));
+}
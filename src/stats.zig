@@ -0,0 +1,330 @@
+/// Optional per-validator counters (`zig build -Dstats=true`)
+/// For every validator kind: checks run, failures, and cumulative time
+/// (rdtsc cycles on x86_64, the virtual counter on aarch64, ns elsewhere).
+/// Counts are exact; a per-value check is only timed once every
+/// `sample_every` calls and cycles are scaled up on read, while whole-column
+/// kernels are timed once per call.
+///
+/// Each thread writes its own block (plain single-writer stores, no shared
+/// cache lines); blocks are linked into one list on first use and summed by
+/// `snapshot`. Blocks of exited threads stay in the list so their counts are
+/// kept. With stats off (`enabled` false) Probe is void and every hook
+/// compiles to nothing.
+///
+/// The switch is read from the root file (`pub const satya_stats = true`),
+/// which c_api.zig sets from the build option, so tests and the WASM builds
+/// never carry counters.
+const std = @import("std");
+const builtin = @import("builtin");
+const root = @import("root");
+
+pub const enabled = @hasDecl(root, "satya_stats") and root.satya_stats;
+
+/// Counter slots; 0-19 share column_validator.Kind numbering so C callers
+/// can pass those kinds as they are
+pub const Slot = enum(u8) {
+    Int,
+    IntGt,
+    IntGte,
+    IntLt,
+    IntLte,
+    IntPositive,
+    IntNonNegative,
+    IntMultipleOf,
+    String,
+    Email,
+    Url,
+    Uuid,
+    Ipv4,
+    Base64,
+    IsoDate,
+    IsoDatetime,
+    Contains,
+    StartsWith,
+    EndsWith,
+    Pattern,
+    StringMinLen,
+    StringMaxLen,
+    Float,
+    FloatGt,
+    FloatGte,
+    FloatLt,
+    FloatLte,
+    FloatFinite,
+    FloatMultipleOf,
+    Boolean,
+    Nested,
+};
+
+pub const slot_count = @typeInfo(Slot).@"enum".fields.len;
+
+/// snake_case slot names, matching the Python field_spec type names
+pub const slot_names: [slot_count][:0]const u8 = blk: {
+    @setEvalBranchQuota(10_000);
+    var names: [slot_count][:0]const u8 = undefined;
+    for (@typeInfo(Slot).@"enum".fields, 0..) |field, i| {
+        var name: []const u8 = "";
+        for (field.name, 0..) |c, j| {
+            if (std.ascii.isUpper(c) and j > 0) name = name ++ "_";
+            name = name ++ &[_]u8{std.ascii.toLower(c)};
+        }
+        const terminated = name ++ "\x00";
+        names[i] = terminated[0..name.len :0];
+    }
+    break :blk names;
+};
+
+/// Slot of a validator kind whose tag names follow Slot (column_validator.Kind,
+/// json_batch_validator.ValidatorType); null for kinds without one
+pub fn slotOf(kind: anytype) ?Slot {
+    const E = @TypeOf(kind);
+    const table = comptime blk: {
+        const fields = @typeInfo(E).@"enum".fields;
+        var slots: [fields.len]?Slot = undefined;
+        for (fields, 0..) |field, i| {
+            if (field.value != i) @compileError("slotOf needs densely numbered kinds");
+            slots[i] = if (@hasField(Slot, field.name)) @field(Slot, field.name) else null;
+        }
+        break :blk slots;
+    };
+    const i = @intFromEnum(kind);
+    return if (i < table.len) table[i] else null;
+}
+
+/// Per-value checks timed: one in `sample_every`
+pub const sample_every = 16;
+
+const Counter = struct {
+    checks: u64 = 0,
+    failures: u64 = 0,
+    /// Checks that were timed, and their total ticks
+    timed: u64 = 0,
+    ticks: u64 = 0,
+};
+
+/// One thread's counters
+pub const Block = struct {
+    counters: [slot_count]Counter = [_]Counter{.{}} ** slot_count,
+    /// Result cache lookups and hits (column_validator.Memo and the bindings')
+    memo_lookups: u64 = 0,
+    memo_hits: u64 = 0,
+    calls: u32 = 0,
+    next: ?*Block = null,
+
+    /// Only the owning thread writes; readers may load concurrently
+    inline fn bump(field: *u64, n: u64) void {
+        @atomicStore(u64, field, field.* + n, .monotonic);
+    }
+
+    pub fn record(self: *Block, slot: Slot, checks: u64, failures: u64, timed: u64, elapsed: u64) void {
+        const counter = &self.counters[@intFromEnum(slot)];
+        bump(&counter.checks, checks);
+        if (failures != 0) bump(&counter.failures, failures);
+        if (timed != 0) {
+            bump(&counter.timed, timed);
+            bump(&counter.ticks, elapsed);
+        }
+    }
+
+    pub fn recordMemo(self: *Block, lookups: u64, hits: u64) void {
+        bump(&self.memo_lookups, lookups);
+        bump(&self.memo_hits, hits);
+    }
+};
+
+/// Totals of one slot as exported by satya_stats_snapshot
+pub const Snapshot = extern struct {
+    checks: u64,
+    failures: u64,
+    /// Estimated total ticks (timed ticks scaled to every check)
+    cycles: u64,
+};
+
+/// Result cache totals as exported by satya_stats_memo
+pub const MemoSnapshot = extern struct {
+    lookups: u64,
+    hits: u64,
+};
+
+/// Every thread's block
+pub const Registry = struct {
+    head: ?*Block = null,
+    mutex: std.Thread.Mutex = .{},
+
+    pub fn add(self: *Registry, block: *Block) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        block.next = self.head;
+        self.head = block;
+    }
+
+    /// Sum of all blocks into out[0..min(out.len, slot_count)]; returns that count
+    pub fn snapshot(self: *Registry, out: []Snapshot) usize {
+        const n = @min(out.len, slot_count);
+        var totals = [_]Counter{.{}} ** slot_count;
+        self.mutex.lock();
+        var it = self.head;
+        while (it) |block| : (it = block.next) {
+            for (&totals, &block.counters) |*total, *counter| {
+                total.checks += @atomicLoad(u64, &counter.checks, .monotonic);
+                total.failures += @atomicLoad(u64, &counter.failures, .monotonic);
+                total.timed += @atomicLoad(u64, &counter.timed, .monotonic);
+                total.ticks += @atomicLoad(u64, &counter.ticks, .monotonic);
+            }
+        }
+        self.mutex.unlock();
+
+        for (out[0..n], totals[0..n]) |*entry, total| {
+            const scaled: u128 = if (total.timed == 0) 0 else @as(u128, total.ticks) * total.checks / total.timed;
+            entry.* = .{ .checks = total.checks, .failures = total.failures, .cycles = std.math.lossyCast(u64, scaled) };
+        }
+        return n;
+    }
+
+    pub fn memoSnapshot(self: *Registry) MemoSnapshot {
+        var total: MemoSnapshot = .{ .lookups = 0, .hits = 0 };
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        var it = self.head;
+        while (it) |block| : (it = block.next) {
+            total.lookups += @atomicLoad(u64, &block.memo_lookups, .monotonic);
+            total.hits += @atomicLoad(u64, &block.memo_hits, .monotonic);
+        }
+        return total;
+    }
+
+    /// Zero every block; checks racing with the reset may survive it
+    pub fn reset(self: *Registry) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        var it = self.head;
+        while (it) |block| : (it = block.next) {
+            for (&block.counters) |*counter| {
+                inline for (.{ "checks", "failures", "timed", "ticks" }) |name| {
+                    @atomicStore(u64, &@field(counter, name), 0, .monotonic);
+                }
+            }
+            @atomicStore(u64, &block.memo_lookups, 0, .monotonic);
+            @atomicStore(u64, &block.memo_hits, 0, .monotonic);
+        }
+    }
+};
+
+pub var registry: Registry = .{};
+threadlocal var local: ?*Block = null;
+
+fn localBlock() ?*Block {
+    if (local) |block| return block;
+    const block = std.heap.page_allocator.create(Block) catch return null;
+    block.* = .{};
+    registry.add(block);
+    local = block;
+    return block;
+}
+
+pub fn ticks() u64 {
+    switch (builtin.cpu.arch) {
+        .x86_64 => {
+            var lo: u32 = undefined;
+            var hi: u32 = undefined;
+            asm volatile ("rdtsc"
+                : [lo] "={eax}" (lo),
+                  [hi] "={edx}" (hi),
+            );
+            return (@as(u64, hi) << 32) | lo;
+        },
+        .aarch64 => return asm volatile ("mrs %[ret], cntvct_el0"
+            : [ret] "=r" (-> u64),
+        ),
+        else => return @truncate(@as(u128, @bitCast(std.time.nanoTimestamp()))),
+    }
+}
+
+/// Start tick of a timed check, 0 when this one is not sampled
+pub const Probe = if (enabled) u64 else void;
+
+/// Before a single-value check
+pub inline fn begin() Probe {
+    return if (comptime enabled) sampleStart() else {};
+}
+
+/// After a single-value check started with `begin`
+pub inline fn end(slot: ?Slot, ok: bool, probe: Probe) void {
+    if (comptime enabled) finishCheck(slot, ok, probe);
+}
+
+/// Before a whole-column kernel (always timed)
+pub inline fn start() Probe {
+    return if (comptime enabled) ticks() else {};
+}
+
+/// After a column kernel started with `start`: `count` checks, `valid` passed
+pub inline fn column(slot: ?Slot, count: usize, valid: usize, probe: Probe) void {
+    if (comptime enabled) finishColumn(slot, count, valid, probe);
+}
+
+/// After a batch that used a result cache
+pub inline fn memo(lookups: usize, hits: usize) void {
+    if (comptime enabled) finishMemo(lookups, hits);
+}
+
+fn sampleStart() u64 {
+    const block = localBlock() orelse return 0;
+    block.calls +%= 1;
+    return if (block.calls % sample_every == 0) ticks() else 0;
+}
+
+fn finishCheck(slot: ?Slot, ok: bool, probe: u64) void {
+    const s = slot orelse return;
+    const block = local orelse return;
+    block.record(s, 1, @intFromBool(!ok), @intFromBool(probe != 0), if (probe != 0) ticks() -% probe else 0);
+}
+
+fn finishColumn(slot: ?Slot, count: usize, valid: usize, probe: u64) void {
+    const s = slot orelse return;
+    if (count == 0) return;
+    const block = localBlock() orelse return;
+    block.record(s, count, count - valid, count, ticks() -% probe);
+}
+
+fn finishMemo(lookups: usize, hits: usize) void {
+    if (lookups == 0) return;
+    const block = localBlock() orelse return;
+    block.recordMemo(lookups, hits);
+}
+
+test "slot names and kinds" {
+    try std.testing.expectEqualStrings("int_non_negative", slot_names[@intFromEnum(Slot.IntNonNegative)]);
+    try std.testing.expectEqualStrings("ipv4", slot_names[@intFromEnum(Slot.Ipv4)]);
+    try std.testing.expectEqualStrings("iso_datetime", slot_names[@intFromEnum(Slot.IsoDatetime)]);
+
+    const Kind = enum(u8) { Int, Email, Exotic };
+    try std.testing.expectEqual(@as(?Slot, .Email), slotOf(Kind.Email));
+    try std.testing.expectEqual(@as(?Slot, null), slotOf(Kind.Exotic));
+}
+
+test "Registry - merges every thread's block" {
+    var reg: Registry = .{};
+    var a: Block = .{};
+    var b: Block = .{};
+    reg.add(&a);
+    reg.add(&b);
+
+    a.record(.Email, 10, 2, 1, 50);
+    b.record(.Email, 30, 1, 3, 90);
+    b.record(.Int, 100, 0, 100, 400);
+
+    var out: [slot_count]Snapshot = undefined;
+    try std.testing.expectEqual(@as(usize, slot_count), reg.snapshot(&out));
+    try std.testing.expectEqual(Snapshot{ .checks = 40, .failures = 3, .cycles = 1400 }, out[@intFromEnum(Slot.Email)]);
+    try std.testing.expectEqual(Snapshot{ .checks = 100, .failures = 0, .cycles = 400 }, out[@intFromEnum(Slot.Int)]);
+
+    a.recordMemo(8, 6);
+    b.recordMemo(2, 1);
+    try std.testing.expectEqual(MemoSnapshot{ .lookups = 10, .hits = 7 }, reg.memoSnapshot());
+
+    reg.reset();
+    _ = reg.snapshot(&out);
+    try std.testing.expectEqual(@as(u64, 0), out[@intFromEnum(Slot.Email)].checks);
+    try std.testing.expectEqual(@as(u64, 0), reg.memoSnapshot().hits);
+}
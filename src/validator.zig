@@ -1,4 +1,5 @@
 const std = @import("std");
+pub const regex = @import("regex.zig");
 
 /// ValidationError represents a single validation failure with field path and message.
 /// Inspired by satya's ValidationError dataclass.
@@ -7,6 +8,8 @@ pub const ValidationError = struct {
     message: []const u8,
     path: []const []const u8,
     allocator: std.mem.Allocator,
+    /// False when the strings are borrowed (see ErrorArena); deinit is then a no-op
+    owned: bool = true,
 
     pub fn init(allocator: std.mem.Allocator, field: []const u8, message: []const u8) !ValidationError {
         const field_copy = try allocator.dupe(u8, field);
@@ -35,6 +38,7 @@ pub const ValidationError = struct {
     }
 
     pub fn deinit(self: *ValidationError) void {
+        if (!self.owned) return;
         self.allocator.free(self.field);
         self.allocator.free(self.message);
         for (self.path) |segment| {
@@ -69,6 +73,8 @@ pub const ValidationError = struct {
 pub const ValidationErrors = struct {
     errors: std.ArrayList(ValidationError),
     allocator: std.mem.Allocator,
+    /// Set for collectors from ErrorArena.errors(): strings are borrowed, not duped
+    arena: ?*ErrorArena = null,
 
     pub fn init(allocator: std.mem.Allocator) ValidationErrors {
         return .{ 
@@ -84,16 +90,53 @@ pub const ValidationErrors = struct {
         self.errors.deinit(self.allocator);
     }
 
+    /// In arena mode `field` and `message` must outlive the arena's next
+    /// reset (string literals, or text allocated from `self.allocator`)
     pub fn add(self: *ValidationErrors, field: []const u8, message: []const u8) !void {
+        if (self.arena != null) return self.addBorrowed(field, message, &.{});
         const err = try ValidationError.init(self.allocator, field, message);
         try self.errors.append(self.allocator, err);
     }
 
     pub fn addWithPath(self: *ValidationErrors, field: []const u8, message: []const u8, path: []const []const u8) !void {
+        if (self.arena) |arena| {
+            const interned = try self.allocator.alloc([]const u8, path.len);
+            for (path, 0..) |segment, i| {
+                interned[i] = try arena.intern(segment);
+            }
+            return self.addBorrowed(field, message, interned);
+        }
         const err = try ValidationError.initWithPath(self.allocator, field, message, path);
         try self.errors.append(self.allocator, err);
     }
 
+    /// Add an error whose message is formatted straight into `self.allocator`
+    /// (no temporary string and, in arena mode, no heap allocation)
+    pub fn addFmt(self: *ValidationErrors, field: []const u8, comptime fmt: []const u8, args: anytype) !void {
+        const message = try std.fmt.allocPrint(self.allocator, fmt, args);
+        if (self.arena != null) return self.addBorrowed(field, message, &.{});
+
+        errdefer self.allocator.free(message);
+        const field_copy = try self.allocator.dupe(u8, field);
+        errdefer self.allocator.free(field_copy);
+        try self.errors.append(self.allocator, .{
+            .field = field_copy,
+            .message = message,
+            .path = &.{},
+            .allocator = self.allocator,
+        });
+    }
+
+    fn addBorrowed(self: *ValidationErrors, field: []const u8, message: []const u8, path: []const []const u8) !void {
+        try self.errors.append(self.allocator, .{
+            .field = field,
+            .message = message,
+            .path = path,
+            .allocator = self.allocator,
+            .owned = false,
+        });
+    }
+
     pub fn hasErrors(self: ValidationErrors) bool {
         return self.errors.items.len > 0;
     }
@@ -114,6 +157,57 @@ pub const ValidationErrors = struct {
     }
 };
 
+/// ErrorArena backs ValidationErrors for high-error-rate batches.
+/// Collectors from errors() keep their lists and formatted messages in an
+/// arena, store field names and messages without copying them, and intern
+/// path segments once (interned segments survive resets). Call reset()
+/// between items or batches; after warm-up, adding errors does no heap
+/// allocation. Collectors and results from before a reset are invalid after it.
+/// The ErrorArena must not move while collectors exist.
+pub const ErrorArena = struct {
+    arena: std.heap.ArenaAllocator,
+    segments: std.StringHashMapUnmanaged(void) = .empty,
+
+    pub fn init(backing: std.mem.Allocator) ErrorArena {
+        return .{ .arena = std.heap.ArenaAllocator.init(backing) };
+    }
+
+    pub fn deinit(self: *ErrorArena) void {
+        const backing = self.arena.child_allocator;
+        var it = self.segments.keyIterator();
+        while (it.next()) |segment| backing.free(segment.*);
+        self.segments.deinit(backing);
+        self.arena.deinit();
+    }
+
+    /// New empty collector backed by this arena
+    pub fn errors(self: *ErrorArena) ValidationErrors {
+        return .{
+            .errors = .empty,
+            .allocator = self.arena.allocator(),
+            .arena = self,
+        };
+    }
+
+    /// Drop all errors, keeping the arena's memory for the next batch
+    pub fn reset(self: *ErrorArena) void {
+        _ = self.arena.reset(.retain_capacity);
+    }
+
+    /// Stable copy of `segment`, shared by every error that uses it
+    pub fn intern(self: *ErrorArena, segment: []const u8) ![]const u8 {
+        const backing = self.arena.child_allocator;
+        const entry = try self.segments.getOrPut(backing, segment);
+        if (!entry.found_existing) {
+            entry.key_ptr.* = backing.dupe(u8, segment) catch |err| {
+                self.segments.removeByPtr(entry.key_ptr);
+                return err;
+            };
+        }
+        return entry.key_ptr.*;
+    }
+};
+
 /// BoundedInt creates a validated integer type with compile-time bounds.
 /// Inspired by satya's Field(ge=min, le=max) pattern.
 ///
@@ -133,13 +227,7 @@ pub fn BoundedInt(comptime T: type, comptime min: T, comptime max: T) type {
 
         pub fn validate(v: T, errors: *ValidationErrors, field_name: []const u8) !T {
             if (v < min or v > max) {
-                const msg = try std.fmt.allocPrint(
-                    errors.allocator,
-                    "Value {d} must be >= {d} and <= {d}",
-                    .{ v, min, max },
-                );
-                defer errors.allocator.free(msg);
-                try errors.add(field_name, msg);
+                try errors.addFmt(field_name, "Value {d} must be >= {d} and <= {d}", .{ v, min, max });
                 return error.ValidationFailed;
             }
             return v;
@@ -171,23 +259,11 @@ pub fn BoundedString(comptime min_len: usize, comptime max_len: usize) type {
 
         pub fn validate(s: []const u8, errors: *ValidationErrors, field_name: []const u8) ![]const u8 {
             if (s.len < min_len) {
-                const msg = try std.fmt.allocPrint(
-                    errors.allocator,
-                    "String length {d} must be >= {d}",
-                    .{ s.len, min_len },
-                );
-                defer errors.allocator.free(msg);
-                try errors.add(field_name, msg);
+                try errors.addFmt(field_name, "String length {d} must be >= {d}", .{ s.len, min_len });
                 return error.ValidationFailed;
             }
             if (s.len > max_len) {
-                const msg = try std.fmt.allocPrint(
-                    errors.allocator,
-                    "String length {d} must be <= {d}",
-                    .{ s.len, max_len },
-                );
-                defer errors.allocator.free(msg);
-                try errors.add(field_name, msg);
+                try errors.addFmt(field_name, "String length {d} must be <= {d}", .{ s.len, max_len });
                 return error.ValidationFailed;
             }
             return s;
@@ -237,24 +313,27 @@ pub const Email = struct {
     }
 };
 
-/// Pattern validates strings against a regex pattern (conceptual - requires regex lib).
+/// Pattern validates strings against a regex pattern (syntax in regex.zig).
 /// Inspired by satya's Field(pattern=r"^[A-Z]{3}-\d{4}$") pattern.
 ///
-/// Note: Zig doesn't have std.regex yet. This is a placeholder for when you add
-/// a regex library like https://github.com/tiehuis/zig-regex or similar.
+/// The pattern is compiled to a DFA at comptime (an unsupported pattern is a
+/// compile error), so matching is linear in the input length.
 pub fn Pattern(comptime pattern: []const u8) type {
     return struct {
         const Self = @This();
+        const compiled = regex.comptimeCompile(pattern);
         value: []const u8,
 
         pub fn init(s: []const u8) !Self {
+            if (!compiled.isMatch(s)) return error.PatternMismatch;
             return .{ .value = s };
         }
 
         pub fn validate(s: []const u8, errors: *ValidationErrors, field_name: []const u8) ![]const u8 {
-            // TODO: Implement regex matching
-            _ = errors;
-            _ = field_name;
+            if (!compiled.isMatch(s)) {
+                try errors.addFmt(field_name, "String does not match pattern {s}", .{pattern});
+                return error.ValidationFailed;
+            }
             return s;
         }
 
@@ -317,24 +396,58 @@ pub fn validateStruct(comptime T: type, val: T, errors: *ValidationErrors) !void
     if (info != .@"struct") @compileError("validateStruct expects a struct");
 
     inline for (info.@"struct".fields) |f| {
-        const field_val = @field(val, f.name);
+        try validateField(T, f, val, errors);
+    }
+}
 
-        // Convention: fields ending with "_ne" must be non-empty strings
-        if (std.mem.endsWith(u8, f.name, "_ne")) {
-            if (@TypeOf(field_val) == []const u8 and field_val.len == 0) {
-                try errors.add(f.name, "Field cannot be empty");
-            }
+/// validateStruct for only the fields named in `changed` (unknown and repeated
+/// names are ignored), in declaration order. Revalidates a record after a
+/// partial update at a cost that follows the number of changed fields, not
+/// the width of T.
+pub fn validateStructChanged(comptime T: type, val: T, changed: []const []const u8, errors: *ValidationErrors) !void {
+    const info = @typeInfo(T);
+    if (info != .@"struct") @compileError("validateStructChanged expects a struct");
+    const fields = info.@"struct".fields;
+    if (fields.len == 0) return;
+
+    const index = comptime blk: {
+        var entries: [fields.len]struct { []const u8, usize } = undefined;
+        for (fields, 0..) |f, i| entries[i] = .{ f.name, i };
+        break :blk std.StaticStringMap(usize).initComptime(entries);
+    };
+    var marked = std.StaticBitSet(fields.len).initEmpty();
+    for (changed) |name| {
+        if (index.get(name)) |i| marked.set(i);
+    }
+
+    var it = marked.iterator(.{});
+    while (it.next()) |i| {
+        switch (i) {
+            inline 0...fields.len - 1 => |j| try validateField(T, fields[j], val, errors),
+            else => unreachable,
         }
+    }
+}
 
-        // Convention: fields named "email" or ending with "_email" must be valid emails
-        if (std.mem.eql(u8, f.name, "email") or std.mem.endsWith(u8, f.name, "_email")) {
-            if (@TypeOf(field_val) == []const u8) {
-                _ = Email.validate(field_val, errors, f.name) catch {};
-            }
+/// The naming-convention checks of validateStruct for one field
+fn validateField(comptime T: type, comptime f: std.builtin.Type.StructField, val: T, errors: *ValidationErrors) !void {
+    const field_val = @field(val, f.name);
+
+    // Convention: fields ending with "_ne" must be non-empty strings
+    if (std.mem.endsWith(u8, f.name, "_ne")) {
+        if (@TypeOf(field_val) == []const u8 and field_val.len == 0) {
+            try errors.add(f.name, "Field cannot be empty");
         }
+    }
 
-        // TODO: Add more conventions (min/max, regex, etc.)
+    // Convention: fields named "email" or ending with "_email" must be valid emails
+    if (std.mem.eql(u8, f.name, "email") or std.mem.endsWith(u8, f.name, "_email")) {
+        if (@TypeOf(field_val) == []const u8) {
+            _ = Email.validate(field_val, errors, f.name) catch {};
+        }
     }
+
+    // TODO: Add more conventions (min/max, regex, etc.)
 }
 
 /// deriveValidator generates a validation function for a struct at comptime.
@@ -356,6 +469,28 @@ pub fn deriveValidator(comptime T: type) type {
                 return ValidationResult(T){ .valid = val };
             }
         }
+
+        /// validate for a record that was valid before and of which only the
+        /// fields named in `changed` were modified (see validateStructChanged)
+        pub fn validateChanged(val: T, changed: []const []const u8, allocator: std.mem.Allocator) !ValidationResult(T) {
+            var errors = ValidationErrors.init(allocator);
+
+            validateStructChanged(T, val, changed, &errors) catch {};
+
+            if (errors.hasErrors()) return ValidationResult(T){ .invalid = errors };
+            errors.deinit();
+            return ValidationResult(T){ .valid = val };
+        }
+
+        /// Same as validate, with errors collected in `arena` (no per-error heap traffic)
+        pub fn validateArena(val: T, arena: *ErrorArena) !ValidationResult(T) {
+            var errors = arena.errors();
+
+            validateStruct(T, val, &errors) catch {};
+
+            if (errors.hasErrors()) return ValidationResult(T){ .invalid = errors };
+            return ValidationResult(T){ .valid = val };
+        }
     };
 }
 
@@ -418,6 +553,18 @@ test "Email - invalid format (no domain)" {
     try std.testing.expectError(error.InvalidEmail, result);
 }
 
+test "Pattern - matches the whole string when anchored" {
+    const Sku = Pattern("^[A-Z]{3}-\\d{4}$");
+    const sku = try Sku.init("ABC-1234");
+    try std.testing.expectEqualStrings("ABC-1234", sku.value);
+    try std.testing.expectError(error.PatternMismatch, Sku.init("ABC-12345"));
+
+    var errors = ValidationErrors.init(std.testing.allocator);
+    defer errors.deinit();
+    _ = Sku.validate("abc-1234", &errors, "sku") catch {};
+    try std.testing.expectEqual(@as(usize, 1), errors.count());
+}
+
 test "ValidationError - format with path" {
     var err = try ValidationError.initWithPath(
         std.testing.allocator,
@@ -508,3 +655,56 @@ test "deriveValidator - happy path" {
 
     try std.testing.expect(result.isValid());
 }
+
+test "deriveValidator - validateChanged only checks the changed fields" {
+    const User = struct {
+        name_ne: []const u8,
+        email: []const u8,
+        backup_email: []const u8,
+    };
+    const Validator = deriveValidator(User);
+    // Stale bad backup_email: only reported once that field is in the change set
+    const user = User{ .name_ne = "Rach", .email = "rach@example.com", .backup_email = "nope" };
+
+    var untouched = try Validator.validateChanged(user, &.{ "email", "no_such_field" }, std.testing.allocator);
+    defer untouched.deinit();
+    try std.testing.expect(untouched.isValid());
+
+    const patched = User{ .name_ne = "", .email = "bad", .backup_email = "nope" };
+    var result = try Validator.validateChanged(patched, &.{ "email", "name_ne", "email" }, std.testing.allocator);
+    defer result.deinit();
+    const errors = result.errors().?;
+    try std.testing.expectEqual(@as(usize, 2), errors.count());
+    try std.testing.expectEqualStrings("name_ne", errors.errors.items[0].field);
+    try std.testing.expectEqualStrings("email", errors.errors.items[1].field);
+}
+
+test "ErrorArena - reset reuses memory and interns path segments" {
+    var counting = std.testing.FailingAllocator.init(std.testing.allocator, .{});
+    var arena = ErrorArena.init(counting.allocator());
+    defer arena.deinit();
+
+    const Age = BoundedInt(u8, 18, 90);
+    var first_segment: ?[*]const u8 = null;
+    var allocations_after_warmup: usize = 0;
+    for (0..3) |batch| {
+        arena.reset();
+        var errors = arena.errors();
+        for (0..100) |_| {
+            _ = Age.validate(7, &errors, "age") catch {};
+            try errors.addWithPath("zip", "Required field missing", &.{ "user", "address" });
+        }
+        try std.testing.expectEqual(@as(usize, 200), errors.count());
+        try std.testing.expectEqualStrings("Value 7 must be >= 18 and <= 90", errors.errors.items[0].message);
+
+        // Same interned segment in every batch
+        const segment = errors.errors.items[1].path[0];
+        if (first_segment == null) first_segment = segment.ptr;
+        try std.testing.expectEqual(first_segment.?, segment.ptr);
+        try std.testing.expectEqualStrings("user", segment);
+        errors.deinit();
+
+        if (batch == 1) allocations_after_warmup = counting.allocations;
+        if (batch == 2) try std.testing.expectEqual(allocations_after_warmup, counting.allocations);
+    }
+}
@@ -1,6 +1,8 @@
 /// Comprehensive validators inspired by Pydantic and Zod
 /// Covers all common validation patterns for production use
 const std = @import("std");
+const simd = @import("simd_validators.zig");
+const regex = @import("regex.zig");
 
 // ============================================================================
 // STRING VALIDATORS
@@ -8,25 +10,7 @@ const std = @import("std");
 
 /// Email validation (RFC 5322 simplified)
 pub inline fn validateEmail(email: []const u8) bool {
-    if (email.len == 0) return false;
-    
-    const at_pos = std.mem.indexOf(u8, email, "@") orelse return false;
-    if (at_pos == 0 or at_pos == email.len - 1) return false;
-    
-    const local = email[0..at_pos];
-    const domain = email[at_pos + 1..];
-    
-    // Check domain has at least one dot
-    if (std.mem.indexOf(u8, domain, ".") == null) return false;
-    
-    // Basic character validation
-    for (local) |c| {
-        if (!std.ascii.isAlphanumeric(c) and c != '.' and c != '_' and c != '-' and c != '+') {
-            return false;
-        }
-    }
-    
-    return true;
+    return simd.validateEmail(email);
 }
 
 /// URL validation (basic HTTP/HTTPS)
@@ -46,65 +30,17 @@ pub inline fn validateUrl(url: []const u8) bool {
 
 /// UUID validation (v4 format: 8-4-4-4-12)
 pub inline fn validateUuid(uuid: []const u8) bool {
-    if (uuid.len != 36) return false;
-    
-    // Check format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
-    if (uuid[8] != '-' or uuid[13] != '-' or uuid[18] != '-' or uuid[23] != '-') {
-        return false;
-    }
-    
-    // Check all other characters are hex
-    const segments = [_][]const u8{
-        uuid[0..8],
-        uuid[9..13],
-        uuid[14..18],
-        uuid[19..23],
-        uuid[24..36],
-    };
-    
-    for (segments) |segment| {
-        for (segment) |c| {
-            if (!std.ascii.isHex(c)) return false;
-        }
-    }
-    
-    return true;
+    return simd.validateUuid(uuid);
 }
 
 /// IPv4 validation
 pub inline fn validateIpv4(ip: []const u8) bool {
-    var parts: u8 = 0;
-    var current: u32 = 0;
-    var has_digit = false;
-    
-    for (ip) |c| {
-        if (c == '.') {
-            if (!has_digit or current > 255) return false;
-            parts += 1;
-            current = 0;
-            has_digit = false;
-        } else if (std.ascii.isDigit(c)) {
-            current = current * 10 + (c - '0');
-            has_digit = true;
-        } else {
-            return false;
-        }
-    }
-    
-    return parts == 3 and has_digit and current <= 255;
+    return simd.validateIpv4(ip);
 }
 
 /// Base64 validation
 pub fn validateBase64(str: []const u8) bool {
-    if (str.len == 0 or str.len % 4 != 0) return false;
-    
-    for (str, 0..) |c, i| {
-        const is_valid = std.ascii.isAlphanumeric(c) or c == '+' or c == '/' or 
-                        (c == '=' and i >= str.len - 2);
-        if (!is_valid) return false;
-    }
-    
-    return true;
+    return simd.validateBase64(str);
 }
 
 /// String contains check
@@ -122,12 +58,12 @@ pub fn validateEndsWith(str: []const u8, suffix: []const u8) bool {
     return std.mem.endsWith(u8, str, suffix);
 }
 
-/// Regex pattern validation (simplified - checks if matches pattern)
-pub fn validatePattern(str: []const u8, pattern: []const u8) bool {
-    // TODO: Full regex support - for now, simple wildcard matching
-    _ = str;
-    _ = pattern;
-    return true; // Placeholder
+/// Regex pattern validation (syntax in regex.zig)
+/// The pattern is compiled to a DFA at comptime; for patterns only known at
+/// runtime compile a regex.Regex once and call isMatch.
+pub fn validatePattern(str: []const u8, comptime pattern: []const u8) bool {
+    const compiled = comptime regex.comptimeCompile(pattern);
+    return compiled.isMatch(str);
 }
 
 // ============================================================================
@@ -287,6 +223,12 @@ test "IPv4 validation" {
     try std.testing.expect(!validateIpv4("192.168.1"));
 }
 
+test "pattern validation" {
+    try std.testing.expect(validatePattern("ABC-1234", "^[A-Z]{3}-\\d{4}$"));
+    try std.testing.expect(!validatePattern("ABC-12", "^[A-Z]{3}-\\d{4}$"));
+    try std.testing.expect(validatePattern("order #42", "#\\d+"));
+}
+
 test "number validators" {
     try std.testing.expect(validateGt(i32, 10, 5));
     try std.testing.expect(!validateGt(i32, 5, 10));
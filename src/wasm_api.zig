@@ -1,5 +1,17 @@
 const std = @import("std");
+const builtin = @import("builtin");
 const validators = @import("validators_comprehensive.zig");
+const batch = @import("batch_validator.zig");
+const bitmap = @import("bitmap.zig");
+const columns = @import("column_validator.zig");
+const codegen = @import("schema_codegen.zig");
+const regex = @import("regex.zig");
+const error_report = @import("error_report.zig");
+const generated = @import("generated_schemas");
+
+// Every allocation handed to or taken back from JavaScript. The unit tests
+// run natively, where wasm_allocator is unavailable.
+const heap = if (builtin.is_test) std.testing.allocator else std.heap.wasm_allocator;
 
 // WASM exports for JavaScript
 // All functions use simple types that work across WASM boundary
@@ -145,31 +157,19 @@ export fn validate_string_lengths_batch(
     max: u32,
     results_ptr: [*]u8
 ) void {
-    const lengths = lengths_ptr[0..count];
-    const results = results_ptr[0..count];
-    
-    var i: usize = 0;
-    while (i < count) : (i += 1) {
-        results[i] = if (lengths[i] >= min and lengths[i] <= max) 1 else 0;
-    }
+    _ = batch.validateRangeBatch(u32, lengths_ptr[0..count], min, max, results_ptr[0..count]);
 }
 
-// ULTRA-FAST: Batch number validation
+// ULTRA-FAST: Batch number validation (vectorized, SIMD128 in dhi-simd.wasm)
+// Returns number of valid items
 export fn validate_numbers_batch(
     count: u32,
     numbers_ptr: [*]const f64,
     min: f64,
     max: f64,
     results_ptr: [*]u8
-) void {
-    const numbers = numbers_ptr[0..count];
-    const results = results_ptr[0..count];
-    
-    var i: usize = 0;
-    while (i < count) : (i += 1) {
-        const n = numbers[i];
-        results[i] = if (n >= min and n <= max) 1 else 0;
-    }
+) u32 {
+    return @intCast(batch.validateRangeBatch(f64, numbers_ptr[0..count], min, max, results_ptr[0..count]));
 }
 
 // Batch validation - validates multiple items at once
@@ -183,7 +183,7 @@ export fn validate_batch(
     _: i64,
 ) ?[*]u8 {
     // Allocate result array
-    const results = std.heap.wasm_allocator.alloc(u8, num_items) catch return null;
+    const results = heap.alloc(u8, num_items) catch return null;
     
     // For now, simple implementation - can be optimized further
     var offset: usize = 0;
@@ -225,90 +225,419 @@ export fn validate_batch_optimized(
 ) ?[*]u8 {
     _ = spec_len;
     
-    // Parse field specs
+    const field_specs = parseFieldSpecs(spec_ptr) orelse return null;
+    defer heap.free(field_specs);
+    
+    const item_count = readU32(items_ptr, 0);
+    
+    // Allocate results
+    const results = heap.alloc(u8, item_count) catch return null;
+    validateItems(.bytes, .text, field_specs, items_ptr, items_len, results);
+    
+    return results.ptr;
+}
+
+// Same input format as validate_batch_optimized, packed results:
+// bit i of byte i / 8 is 1 when item i is valid ((num_items + 7) / 8 bytes,
+// free with dealloc). Use bitmap_valid_count / bitmap_next_invalid to read it.
+export fn validate_batch_optimized_bitmap(
+    spec_ptr: [*]const u8,
+    spec_len: usize,
+    items_ptr: [*]const u8,
+    items_len: usize,
+) ?[*]u8 {
+    _ = spec_len;
+    
+    const field_specs = parseFieldSpecs(spec_ptr) orelse return null;
+    defer heap.free(field_specs);
+    
+    const item_count = readU32(items_ptr, 0);
+    
+    const bits = heap.alloc(u8, bitmap.byteLen(item_count)) catch return null;
+    validateItems(.bitmap, .text, field_specs, items_ptr, items_len, bits);
+    
+    return bits.ptr;
+}
+
+// Every violation instead of one flag per item: returns
+// [u32 violations][u32 valid_count] followed by the error_report.zig layout
+// (dealloc 8 + 11 * violations bytes), or null on allocation failure
+export fn validate_batch_errors(
+    spec_ptr: [*]const u8,
+    spec_len: usize,
+    items_ptr: [*]const u8,
+    items_len: usize,
+) ?[*]u8 {
+    _ = spec_len;
+    const field_specs = parseFieldSpecs(spec_ptr) orelse return null;
+    defer heap.free(field_specs);
+    return reportErrors(.text, field_specs, items_ptr, items_len, null);
+}
+
+// Compiled schemas: the spec bytes of validate_batch_optimized parsed once,
+// plus a grow-only output region reused by every call on the handle. Results
+// point into that region and stay valid until the next call on the same
+// handle (copy them out first) or free_schema.
+const SchemaHandle = struct {
+    fields: []FieldSpec,
+    out: []u8 = &.{},
+
+    /// The first `len` bytes of the output region, grown when too small
+    /// (never empty, so results of empty batches are still a non-null pointer)
+    fn output(self: *SchemaHandle, len: usize) ?[]u8 {
+        if (self.out.len < len or self.out.len == 0) {
+            const allocator = heap;
+            const grown = allocator.alloc(u8, @max(len, 2 * self.out.len, 64)) catch return null;
+            allocator.free(self.out);
+            self.out = grown;
+        }
+        return self.out[0..len];
+    }
+};
+
+// Returns 0 if the spec is truncated or allocation fails; free with free_schema
+export fn compile_schema(spec_ptr: [*]const u8, spec_len: usize) ?*SchemaHandle {
+    if (spec_len < 1 or spec_len < 1 + @as(usize, spec_ptr[0]) * 9) return null;
+    const allocator = heap;
+    const handle = allocator.create(SchemaHandle) catch return null;
+    const fields = parseFieldSpecs(spec_ptr) orelse {
+        allocator.destroy(handle);
+        return null;
+    };
+    handle.* = .{ .fields = fields };
+    return handle;
+}
+
+export fn free_schema(handle: ?*SchemaHandle) void {
+    const schema = handle orelse return;
+    const allocator = heap;
+    allocator.free(schema.out);
+    allocator.free(schema.fields);
+    allocator.destroy(schema);
+}
+
+// validate_batch_optimized over a compiled schema: one byte per item
+export fn validate_with(handle: *SchemaHandle, items_ptr: [*]const u8, items_len: usize) ?[*]u8 {
+    return validateWith(.bytes, .text, handle, items_ptr, items_len);
+}
+
+// validate_batch_optimized_bitmap over a compiled schema
+export fn validate_with_bitmap(handle: *SchemaHandle, items_ptr: [*]const u8, items_len: usize) ?[*]u8 {
+    return validateWith(.bitmap, .text, handle, items_ptr, items_len);
+}
+
+// validate_batch_errors over a compiled schema (same header and layout)
+export fn validate_with_errors(handle: *SchemaHandle, items_ptr: [*]const u8, items_len: usize) ?[*]u8 {
+    return reportErrors(.text, handle.fields, items_ptr, items_len, handle);
+}
+
+// The validate_with* family over shape-encoded items (see Encoding): numbers
+// and booleans arrive as raw f64 / u8, strings as UTF-8, absent values as a tag
+export fn validate_shape_with(handle: *SchemaHandle, items_ptr: [*]const u8, items_len: usize) ?[*]u8 {
+    return validateWith(.bytes, .shape, handle, items_ptr, items_len);
+}
+
+export fn validate_shape_with_bitmap(handle: *SchemaHandle, items_ptr: [*]const u8, items_len: usize) ?[*]u8 {
+    return validateWith(.bitmap, .shape, handle, items_ptr, items_len);
+}
+
+export fn validate_shape_with_errors(handle: *SchemaHandle, items_ptr: [*]const u8, items_len: usize) ?[*]u8 {
+    return reportErrors(.shape, handle.fields, items_ptr, items_len, handle);
+}
+
+// Vectorized number range check with packed results; returns valid count
+export fn validate_numbers_batch_bitmap(
+    count: u32,
+    numbers_ptr: [*]const f64,
+    min: f64,
+    max: f64,
+    bitmap_ptr: [*]u8
+) u32 {
+    return @intCast(batch.validateRangeBitmap(f64, numbers_ptr[0..count], min, max, bitmap_ptr[0..bitmap.byteLen(count)]));
+}
+
+// One contiguous string column: item i is data[offsets[i]..offsets[i + 1]]
+// (count + 1 u32 offsets). kind uses the column_validator.Kind numbering:
+// 8 = byte length in [param1, param2], 9-15 = email, url, uuid, ipv4,
+// base64, iso_date, iso_datetime, 16-18 = contains / starts_with / ends_with
+// `needle`. Packed results; returns valid count
+export fn validate_string_column_bitmap(
+    kind: u8,
+    param1: i32,
+    param2: i32,
+    needle_ptr: [*]const u8,
+    needle_len: u32,
+    offsets_ptr: [*]const u32,
+    count: u32,
+    data_ptr: [*]const u8,
+    data_len: u32,
+    bitmap_ptr: [*]u8,
+) u32 {
+    const spec = columns.StringSpec{
+        .kind = @enumFromInt(kind),
+        .param1 = param1,
+        .param2 = param2,
+        .needle = needle_ptr,
+        .needle_len = needle_len,
+    };
+    return @intCast(columns.validateStringColumn(u32, .bitmap, spec, offsets_ptr[0 .. count + 1], data_ptr[0..data_len], null, bitmap_ptr[0..bitmap.byteLen(count)]));
+}
+
+// Regex patterns (syntax in regex.zig), compiled to a DFA once: pass the
+// handle to pattern_match / validate_pattern_column_bitmap, or as param1 of
+// a type 9 field in validate_batch_optimized. Returns 0 if the pattern is
+// invalid, unsupported or too complex; free with pattern_free
+export fn pattern_compile(ptr: [*]const u8, len: usize) ?*regex.Regex {
+    const re = heap.create(regex.Regex) catch return null;
+    re.* = regex.compile(heap, ptr[0..len]) catch {
+        heap.destroy(re);
+        return null;
+    };
+    return re;
+}
+
+export fn pattern_free(re: ?*regex.Regex) void {
+    const compiled = re orelse return;
+    compiled.deinit(heap);
+    heap.destroy(compiled);
+}
+
+export fn pattern_match(re: *const regex.Regex, ptr: [*]const u8, len: usize) bool {
+    return re.isMatch(ptr[0..len]);
+}
+
+// Same column layout as validate_string_column_bitmap; returns valid count
+export fn validate_pattern_column_bitmap(
+    re: *const regex.Regex,
+    offsets_ptr: [*]const u32,
+    count: u32,
+    data_ptr: [*]const u8,
+    data_len: u32,
+    bitmap_ptr: [*]u8,
+) u32 {
+    const spec = columns.StringSpec{ .kind = .Pattern, .pattern = re };
+    return @intCast(columns.validateStringColumn(u32, .bitmap, spec, offsets_ptr[0 .. count + 1], data_ptr[0..data_len], null, bitmap_ptr[0..bitmap.byteLen(count)]));
+}
+
+// Bitmap helpers (count = number of items, not bytes)
+export fn bitmap_valid_count(bitmap_ptr: [*]const u8, count: u32) u32 {
+    return @intCast(bitmap.countValid(bitmap_ptr[0..bitmap.byteLen(count)], count));
+}
+
+// Index of first invalid item at or after `from`; returns `count` if none
+export fn bitmap_next_invalid(bitmap_ptr: [*]const u8, count: u32, from: u32) u32 {
+    const index = bitmap.nextInvalid(bitmap_ptr[0..bitmap.byteLen(count)], count, from) orelse return count;
+    return @intCast(index);
+}
+
+inline fn readU32(ptr: [*]const u8, offset: usize) u32 {
+    return std.mem.readInt(u32, ptr[offset..][0..4], .little);
+}
+
+// Parse [num_fields][type][param1][param2]... into a new FieldSpec array
+// Negative byte length bounds (type 7) clamp to 0.
+fn parseFieldSpecs(spec_ptr: [*]const u8) ?[]FieldSpec {
     var offset: usize = 0;
     const num_fields = spec_ptr[offset];
     offset += 1;
     
-    // Allocate space for field specs
-    const field_specs = std.heap.wasm_allocator.alloc(FieldSpec, num_fields) catch return null;
-    defer std.heap.wasm_allocator.free(field_specs);
+    const field_specs = heap.alloc(FieldSpec, num_fields) catch return null;
     
-    // Parse each field spec
-    for (0..num_fields) |i| {
-        field_specs[i].validator_type = spec_ptr[offset];
+    for (field_specs) |*spec| {
+        spec.validator_type = spec_ptr[offset];
         offset += 1;
-        field_specs[i].param1 = @as(i32, @bitCast([4]u8{
-            spec_ptr[offset],
-            spec_ptr[offset + 1],
-            spec_ptr[offset + 2],
-            spec_ptr[offset + 3],
-        }));
+        spec.param1 = @bitCast(readU32(spec_ptr, offset));
         offset += 4;
-        field_specs[i].param2 = @as(i32, @bitCast([4]u8{
-            spec_ptr[offset],
-            spec_ptr[offset + 1],
-            spec_ptr[offset + 2],
-            spec_ptr[offset + 3],
-        }));
+        spec.param2 = @bitCast(readU32(spec_ptr, offset));
         offset += 4;
+        if (spec.validator_type == 7) {
+            spec.param1 = @max(spec.param1, 0);
+            spec.param2 = @max(spec.param2, 0);
+        }
     }
     
-    // Parse item count
-    const item_count = @as(u32, @bitCast([4]u8{
-        items_ptr[0],
-        items_ptr[1],
-        items_ptr[2],
-        items_ptr[3],
-    }));
-    
-    // Allocate results
-    const results = std.heap.wasm_allocator.alloc(u8, item_count) catch return null;
-    
-    // Initialize all to valid
-    for (0..item_count) |i| {
-        results[i] = 1;
+    return field_specs;
+}
+
+const ResultFormat = enum { bytes, bitmap };
+
+// Item encodings; both start with [u32 num_items], then one value per
+// schema field per item, in field order (integers and floats little-endian):
+//   text:  [u32 len][bytes], every value as text (validate_batch_optimized)
+//   shape: a u8 tag, then 0 = missing / null (no payload),
+//          1 = [u32 len][UTF-8 bytes], 2 = f64, 3 = u8 bool (validate_shape_with*)
+const Encoding = enum { text, shape };
+
+const Value = union(enum) {
+    missing,
+    string: []const u8,
+    number: f64,
+    boolean: bool,
+};
+
+// Next field value at offset.*, or null when the buffer ends (or a tag is unknown)
+fn nextValue(comptime encoding: Encoding, items: []const u8, offset: *usize) ?Value {
+    var at = offset.*;
+    if (encoding == .shape) {
+        if (at >= items.len) return null;
+        const tag = items[at];
+        at += 1;
+        switch (tag) {
+            0 => {
+                offset.* = at;
+                return .missing;
+            },
+            1 => {},
+            2 => {
+                if (at + 8 > items.len) return null;
+                offset.* = at + 8;
+                return .{ .number = @bitCast(std.mem.readInt(u64, items[at..][0..8], .little)) };
+            },
+            3 => {
+                if (at >= items.len) return null;
+                offset.* = at + 1;
+                return .{ .boolean = items[at] != 0 };
+            },
+            else => return null,
+        }
     }
+    if (at + 4 > items.len) return null;
+    const len = std.mem.readInt(u32, items[at..][0..4], .little);
+    if (len > items.len - at - 4) return null;
+    offset.* = at + 4 + len;
+    return .{ .string = items[at + 4 .. at + 4 + len] };
+}
+
+// Write one result per item of `items_ptr` into `out`
+fn validateItems(
+    comptime format: ResultFormat,
+    comptime encoding: Encoding,
+    field_specs: []const FieldSpec,
+    items_ptr: [*]const u8,
+    items_len: usize,
+    out: []u8,
+) void {
+    const items = items_ptr[0..items_len];
+    const item_count = readU32(items_ptr, 0);
+    if (format == .bitmap) @memset(out, 0);
     
-    // Validate each item
     var item_offset: usize = 4;
     for (0..item_count) |item_idx| {
+        var item_valid = true;
+        
         // For each field in this item
         for (field_specs) |spec| {
-            // Read field data length
-            if (item_offset + 4 > items_len) break;
-            const field_len = @as(u32, @bitCast([4]u8{
-                items_ptr[item_offset],
-                items_ptr[item_offset + 1],
-                items_ptr[item_offset + 2],
-                items_ptr[item_offset + 3],
-            }));
-            item_offset += 4;
+            const value = nextValue(encoding, items, &item_offset) orelse break;
             
-            if (item_offset + field_len > items_len) break;
-            const field_data = items_ptr[item_offset..item_offset + field_len];
-            item_offset += field_len;
-            
-            // Validate field (early exit on failure)
-            const is_valid = validateField(field_data, spec);
-            if (!is_valid) {
-                results[item_idx] = 0;
-                // Skip remaining fields for this item
-                break;
+            // Validate field (after a failure, remaining fields are only skipped
+            // over so the next item starts at the right offset)
+            if (item_valid and !validateField(value, spec)) {
+                item_valid = false;
             }
         }
+        
+        switch (format) {
+            .bytes => out[item_idx] = @intFromBool(item_valid),
+            .bitmap => if (item_valid) bitmap.set(out, item_idx, true),
+        }
     }
-    
-    return results.ptr;
 }
 
+// validateItems over a compiled schema, into its output region
+fn validateWith(
+    comptime format: ResultFormat,
+    comptime encoding: Encoding,
+    handle: *SchemaHandle,
+    items_ptr: [*]const u8,
+    items_len: usize,
+) ?[*]u8 {
+    const count = readU32(items_ptr, 0);
+    const out = handle.output(if (format == .bytes) count else bitmap.byteLen(count)) orelse return null;
+    validateItems(format, encoding, handle.fields, items_ptr, items_len, out);
+    return out.ptr;
+}
+
+// Header plus packed report (see validate_batch_errors), written into the
+// output region of `handle`, or a new allocation without one
+fn reportErrors(
+    comptime encoding: Encoding,
+    field_specs: []const FieldSpec,
+    items_ptr: [*]const u8,
+    items_len: usize,
+    handle: ?*SchemaHandle,
+) ?[*]u8 {
+    const allocator = heap;
+    var report: error_report.ErrorReport = .{};
+    defer report.deinit(allocator);
+    const invalid_items = collectItemErrors(encoding, field_specs, items_ptr, items_len, &report) catch return null;
+
+    const len = 8 + report.packedLen();
+    const out = if (handle) |h|
+        h.output(len) orelse return null
+    else
+        allocator.alloc(u8, len) catch return null;
+    std.mem.writeInt(u32, out[0..4], @intCast(report.len()), .little);
+    std.mem.writeInt(u32, out[4..8], readU32(items_ptr, 0) - invalid_items, .little);
+    report.packInto(out[8..]);
+    return out.ptr;
+}
+
+// validateItems without the early exit; fields cut off by a truncated
+// buffer are reported missing. Returns number of items with violations.
+fn collectItemErrors(
+    comptime encoding: Encoding,
+    field_specs: []const FieldSpec,
+    items_ptr: [*]const u8,
+    items_len: usize,
+    report: *error_report.ErrorReport,
+) !u32 {
+    const allocator = heap;
+    const items = items_ptr[0..items_len];
+    const item_count = readU32(items_ptr, 0);
+    var invalid_items: u32 = 0;
+
+    var item_offset: usize = 4;
+    for (0..item_count) |item_idx| {
+        const before = report.len();
+        for (field_specs, 0..) |spec, field_idx| {
+            const value = nextValue(encoding, items, &item_offset) orelse .missing;
+            const failure = fieldFailure(value, spec) orelse continue;
+            try report.add(allocator, item_idx, field_idx, failure);
+        }
+        invalid_items += @intFromBool(report.len() != before);
+    }
+    return invalid_items;
+}
+
+// validator_type: 0 email, 1 url, 2 uuid, 3 ipv4, 4 iso_date, 5 iso_datetime,
+// 6 base64, 7 string byte length in [param1, param2], 8 positive number,
+// 9 pattern (param1 = pattern_compile handle), 10 boolean
 const FieldSpec = struct {
     validator_type: u8,
     param1: i32,
     param2: i32,
 };
 
-inline fn validateField(data: []const u8, spec: FieldSpec) bool {
+inline fn validateField(value: Value, spec: FieldSpec) bool {
+    return switch (spec.validator_type) {
+        8 => switch (value) { // positive number; text is parsed as an integer
+            .number => |num| validators.validatePositive(f64, num),
+            .string => |data| if (std.fmt.parseInt(i64, data, 10)) |num| validators.validatePositive(i64, num) else |_| false,
+            else => false,
+        },
+        10 => switch (value) { // boolean
+            .boolean => true,
+            .string => |data| std.mem.eql(u8, data, "true") or std.mem.eql(u8, data, "false"),
+            else => false,
+        },
+        else => switch (value) {
+            .string => |data| validateString(data, spec),
+            else => false,
+        },
+    };
+}
+
+inline fn validateString(data: []const u8, spec: FieldSpec) bool {
     return switch (spec.validator_type) {
         0 => validators.validateEmail(data),
         1 => validators.validateUrl(data),
@@ -318,21 +647,204 @@ inline fn validateField(data: []const u8, spec: FieldSpec) bool {
         5 => validators.validateIsoDatetime(data),
         6 => validators.validateBase64(data),
         7 => data.len >= @as(usize, @intCast(spec.param1)) and data.len <= @as(usize, @intCast(spec.param2)),
-        8 => blk: { // positive number
-            const num = std.fmt.parseInt(i64, data, 10) catch break :blk false;
-            break :blk validators.validatePositive(i64, num);
+        9 => blk: { // pattern; param1 is a pattern_compile handle
+            const re: ?*const regex.Regex = @ptrFromInt(@as(u32, @bitCast(spec.param1)));
+            break :blk if (re) |r| r.isMatch(data) else false;
         },
         else => false,
     };
 }
 
+// Why validateField rejects `value` (null when it does not)
+fn fieldFailure(value: Value, spec: FieldSpec) ?error_report.Failure {
+    const Failure = error_report.Failure;
+    if (validateField(value, spec)) return null;
+    const data = switch (value) {
+        .missing => return Failure.of(.missing),
+        .string => |data| data,
+        .number => return if (spec.validator_type == 8) Failure.bound(.too_small, 0) else Failure.of(.wrong_type),
+        .boolean => return Failure.of(.wrong_type),
+    };
+    return switch (spec.validator_type) {
+        7 => if (data.len < @as(usize, @intCast(spec.param1)))
+            Failure.bound(.too_small, spec.param1)
+        else
+            Failure.bound(.too_large, spec.param2),
+        8 => if (std.fmt.parseInt(i64, data, 10)) |_| Failure.bound(.too_small, 0) else |_| Failure.of(.wrong_type),
+        9 => Failure.of(.pattern_mismatch),
+        10 => Failure.of(.wrong_type),
+        else => Failure.of(.invalid_format),
+    };
+}
+
 // Memory allocation for JavaScript
 export fn alloc(size: usize) ?[*]u8 {
-    const slice = std.heap.wasm_allocator.alloc(u8, size) catch return null;
+    const slice = heap.alloc(u8, size) catch return null;
     return slice.ptr;
 }
 
 export fn dealloc(ptr: [*]u8, size: usize) void {
     const slice = ptr[0..size];
-    std.heap.wasm_allocator.free(slice);
+    heap.free(slice);
+}
+
+// Specialized kernels from `zig build -Dschema=...` (see schema_codegen.zig):
+// satya_validate_<name>_batch(columns, count, results) and _batch_bitmap
+comptime {
+    codegen.exportAll(generated.schemas);
+}
+
+// Spec and item buffers as JavaScript lays them out (little-endian)
+const TestBuffer = struct {
+    bytes: std.ArrayList(u8) = .empty,
+
+    fn deinit(self: *TestBuffer) void {
+        self.bytes.deinit(std.testing.allocator);
+    }
+
+    fn byte(self: *TestBuffer, value: u8) !void {
+        try self.bytes.append(std.testing.allocator, value);
+    }
+
+    fn int(self: *TestBuffer, comptime T: type, value: T) !void {
+        var raw: [@sizeOf(T)]u8 = undefined;
+        std.mem.writeInt(T, &raw, value, .little);
+        try self.bytes.appendSlice(std.testing.allocator, &raw);
+    }
+
+    fn field(self: *TestBuffer, validator_type: u8, param1: i32, param2: i32) !void {
+        try self.byte(validator_type);
+        try self.int(i32, param1);
+        try self.int(i32, param2);
+    }
+
+    fn text(self: *TestBuffer, str: []const u8) !void {
+        try self.int(u32, @intCast(str.len));
+        try self.bytes.appendSlice(std.testing.allocator, str);
+    }
+
+    fn shapeText(self: *TestBuffer, str: []const u8) !void {
+        try self.byte(1);
+        try self.text(str);
+    }
+
+    fn shapeNumber(self: *TestBuffer, num: f64) !void {
+        try self.byte(2);
+        try self.int(u64, @bitCast(num));
+    }
+
+    fn shapeBool(self: *TestBuffer, value: bool) !void {
+        try self.byte(3);
+        try self.byte(@intFromBool(value));
+    }
+
+    fn compile(self: *const TestBuffer) !*SchemaHandle {
+        return compile_schema(self.bytes.items.ptr, self.bytes.items.len) orelse error.CompileFailed;
+    }
+};
+
+test "validate_with - text encoding round trip" {
+    var spec: TestBuffer = .{};
+    defer spec.deinit();
+    try spec.byte(2);
+    try spec.field(0, 0, 0); // email
+    try spec.field(7, 2, 5); // string byte length
+    const handle = try spec.compile();
+    defer free_schema(handle);
+
+    var items: TestBuffer = .{};
+    defer items.deinit();
+    try items.int(u32, 3);
+    for ([_][2][]const u8{ .{ "a@b.io", "abc" }, .{ "nope", "abc" }, .{ "a@b.io", "x" } }) |item| {
+        try items.text(item[0]);
+        try items.text(item[1]);
+    }
+
+    const results = validate_with(handle, items.bytes.items.ptr, items.bytes.items.len) orelse return error.OutOfMemory;
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0, 0 }, results[0..3]);
+    const bits = validate_with_bitmap(handle, items.bytes.items.ptr, items.bytes.items.len) orelse return error.OutOfMemory;
+    try std.testing.expectEqual(@as(u8, 0b001), bits[0]);
+}
+
+test "validate_shape_with - typed values and text" {
+    var spec: TestBuffer = .{};
+    defer spec.deinit();
+    try spec.byte(2);
+    try spec.field(8, 0, 0); // positive
+    try spec.field(10, 0, 0); // boolean
+    const handle = try spec.compile();
+    defer free_schema(handle);
+
+    var items: TestBuffer = .{};
+    defer items.deinit();
+    try items.int(u32, 5);
+    try items.shapeNumber(5);
+    try items.shapeBool(true);
+    try items.shapeText("5"); // text is parsed
+    try items.shapeText("false");
+    try items.shapeNumber(0);
+    try items.shapeBool(true);
+    try items.byte(0); // missing
+    try items.shapeBool(false);
+    try items.shapeNumber(1.5);
+    try items.shapeText("yes");
+
+    const results = validate_shape_with(handle, items.bytes.items.ptr, items.bytes.items.len) orelse return error.OutOfMemory;
+    try std.testing.expectEqualSlices(u8, &.{ 1, 1, 0, 0, 0 }, results[0..5]);
+    const bits = validate_shape_with_bitmap(handle, items.bytes.items.ptr, items.bytes.items.len) orelse return error.OutOfMemory;
+    try std.testing.expectEqual(@as(u8, 0b00011), bits[0]);
+}
+
+test "validate_shape_with_errors - header and packed report" {
+    var spec: TestBuffer = .{};
+    defer spec.deinit();
+    try spec.byte(3);
+    try spec.field(8, 0, 0); // positive
+    try spec.field(10, 0, 0); // boolean
+    try spec.field(7, 1, 3); // string byte length
+    const handle = try spec.compile();
+    defer free_schema(handle);
+
+    var items: TestBuffer = .{};
+    defer items.deinit();
+    try items.int(u32, 2);
+    try items.shapeNumber(1);
+    try items.shapeBool(true);
+    try items.shapeText("ab");
+    try items.shapeNumber(-1);
+    try items.byte(0);
+    try items.shapeText("abcd");
+
+    const out = validate_shape_with_errors(handle, items.bytes.items.ptr, items.bytes.items.len) orelse return error.OutOfMemory;
+    const n = std.mem.readInt(u32, out[0..4], .little);
+    try std.testing.expectEqual(@as(u32, 3), n);
+    try std.testing.expectEqual(@as(u32, 1), std.mem.readInt(u32, out[4..8], .little));
+    const report = out[8 .. 8 + n * error_report.bytes_per_violation];
+    const expected = [_]error_report.Violation{
+        .{ .item_index = 1, .field_index = 0, .code = .too_small, .param = 0 },
+        .{ .item_index = 1, .field_index = 1, .code = .missing, .param = 0 },
+        .{ .item_index = 1, .field_index = 2, .code = .too_large, .param = 3 },
+    };
+    for (expected, 0..) |want, i| try std.testing.expectEqual(want, error_report.get(report, n, i));
+}
+
+test "compile_schema - negative length bounds clamp, truncated specs fail" {
+    var spec: TestBuffer = .{};
+    defer spec.deinit();
+    try spec.byte(1);
+    try spec.field(7, -5, -1);
+    const handle = try spec.compile();
+    defer free_schema(handle);
+    try std.testing.expectEqual(@as(i32, 0), handle.fields[0].param1);
+    try std.testing.expectEqual(@as(i32, 0), handle.fields[0].param2);
+
+    var items: TestBuffer = .{};
+    defer items.deinit();
+    try items.int(u32, 2);
+    try items.text("");
+    try items.text("a");
+    const results = validate_with(handle, items.bytes.items.ptr, items.bytes.items.len) orelse return error.OutOfMemory;
+    try std.testing.expectEqualSlices(u8, &.{ 1, 0 }, results[0..2]);
+
+    try std.testing.expect(compile_schema(spec.bytes.items.ptr, spec.bytes.items.len - 1) == null);
 }